@@ -0,0 +1,234 @@
+// Checks the playback path's building blocks on the host: AudioRing
+// wraparound and overrun, the Resampler's output length and values from
+// the chimes' 44.1 kHz to AUDIO_OUTPUT_RATE, and AudioMixer mixing,
+// clipping, voice stealing and preemption. Then times mixing both chimes
+// a block at a time, the playback task's work per ring block. Exits
+// non-zero on failure.
+//
+//   g++ -O2 -std=c++17 -Isrc bench/audio_mix_bench.cpp src/audio_mixer.cpp src/sound_asset.cpp -o audio_mix_bench
+//   ./audio_mix_bench [iterations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "734443__universfield__system-notification-4.h"
+#include "734446__universfield__error-10.h"
+#include "audio_mixer.h"
+#include "audio_player.h"
+#include "audio_ring.h"
+
+using Clock = std::chrono::steady_clock;
+
+static int failures = 0;
+
+static void check(bool ok, const char *what) {
+    if (!ok) {
+        printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+// a PCM8 asset over data, one byte per sample
+static SoundAsset pcm8(const std::vector<uint8_t> &data, uint32_t rate) {
+    return {SOUND_PCM8, rate, (uint32_t)data.size(), data.data(), data.size()};
+}
+
+static void checkRing() {
+    AudioRing<4, 3> ring;
+    int16_t next_write = 0, next_read = 0;
+    // the producer runs ahead by up to all blocks, for many laps
+    for (int round = 0; round < 20; round++) {
+        int writes = round % 4;
+        for (int i = 0; i < writes; i++) {
+            int16_t *block = ring.writeBlock();
+            if (!block) {
+                // overrun: a full ring refuses, it doesn't overwrite
+                check(ring.full() && ring.filled() == 3, "ring refused a write while not full");
+                break;
+            }
+            for (size_t s = 0; s < ring.blockSamples(); s++) {
+                block[s] = next_write;
+            }
+            next_write++;
+            ring.commit();
+        }
+        check(ring.filled() <= 3, "ring holds more blocks than it has");
+        size_t filled = ring.filled();
+        check(filled == 0 || ring.readBlock(filled - 1), "ring hides a filled block");
+        check(!ring.readBlock(filled), "ring reads past the filled blocks");
+        size_t reads = round % 3 == 0 ? filled : (filled + 1) / 2;
+        for (size_t i = 0; i < reads; i++) {
+            int16_t *block = ring.readBlock();
+            check(block && block[0] == next_read && block[3] == next_read,
+                  "ring blocks out of order across the wrap");
+            next_read++;
+            ring.consume();
+        }
+    }
+    check(next_read > 3 * 3, "ring didn't wrap");
+    while (ring.writeBlock()) {
+        ring.commit();
+    }
+    check(ring.full() && !ring.writeBlock(), "full ring accepted a write");
+    ring.clear();
+    check(ring.filled() == 0 && !ring.readBlock() && ring.writeBlock(),
+          "cleared ring not empty");
+}
+
+static size_t drain(Resampler &r, SoundStream &s, std::vector<int16_t> &out) {
+    int16_t buf[100]; // not a multiple of the input chunk
+    size_t n;
+    out.clear();
+    while ((n = r.process(s, buf, sizeof(buf) / sizeof(buf[0])))) {
+        out.insert(out.end(), buf, buf + n);
+    }
+    return out.size();
+}
+
+// Output sample j sits at input position j * step (16.16, as in
+// Resampler::reset()) and needs the input sample after it, so the count
+// is the number of positions before the last input sample.
+static size_t resampledLength(uint32_t samples, uint32_t in_rate, uint32_t out_rate) {
+    uint64_t step = ((uint64_t)in_rate << 16) / out_rate;
+    return (size_t)((((uint64_t)samples - 1) << 16) + step - 1) / step;
+}
+
+static void checkResampler() {
+    // a slow ramp, so interpolated values are predictable
+    std::vector<uint8_t> ramp(4410);
+    for (size_t i = 0; i < ramp.size(); i++) {
+        ramp[i] = (uint8_t)(i * 255 / (ramp.size() - 1));
+    }
+    SoundAsset asset = pcm8(ramp, 44100);
+    static const uint32_t rates[] = {44100, AUDIO_OUTPUT_RATE, 16000, 48000};
+    std::vector<int16_t> out;
+    for (uint32_t rate : rates) {
+        SoundStream stream;
+        stream.start(&asset);
+        Resampler r;
+        r.reset(asset.sample_rate, rate);
+        size_t n = drain(r, stream, out);
+        size_t expected = resampledLength(asset.samples, asset.sample_rate, rate);
+        printf("resample 44100 -> %5u: %zu -> %zu samples (expected %zu)\n", rate,
+               (size_t)asset.samples, n, expected);
+        check(n == expected, "resampler output length");
+        bool close = true;
+        for (size_t j = 0; j < n; j++) {
+            double pos = (double)j * asset.sample_rate / rate;
+            double value = ((int)(pos * 255 / (ramp.size() - 1)) - 128) * 256.0;
+            close = close && out[j] >= value - 512 && out[j] <= value + 512;
+        }
+        check(close, "resampled ramp off the ramp");
+        if (rate == asset.sample_rate) {
+            bool same = n == asset.samples - 1;
+            for (size_t j = 0; same && j < n; j++) {
+                same = out[j] == (int16_t)((ramp[j] - 128) << 8);
+            }
+            check(same, "resampling at the same rate isn't the identity");
+        }
+    }
+
+    // the real chime at the device rate
+    SoundStream stream;
+    stream.start(&sound_system_notification_4);
+    Resampler r;
+    r.reset(sound_system_notification_4.sample_rate, AUDIO_OUTPUT_RATE);
+    size_t n = drain(r, stream, out);
+    size_t expected = resampledLength(sound_system_notification_4.samples,
+                                      sound_system_notification_4.sample_rate, AUDIO_OUTPUT_RATE);
+    printf("chime %u Hz -> %u Hz: %u -> %zu samples\n", sound_system_notification_4.sample_rate,
+           AUDIO_OUTPUT_RATE, sound_system_notification_4.samples, n);
+    check(n == expected, "chime resampled to the wrong length");
+}
+
+// renders until the mixer goes idle, at most limit samples
+static std::vector<int16_t> renderAll(AudioMixer &mixer, size_t limit) {
+    std::vector<int16_t> out;
+    int16_t block[AUDIO_BLOCK_SAMPLES];
+    while (out.size() < limit && mixer.render(block, AUDIO_BLOCK_SAMPLES)) {
+        out.insert(out.end(), block, block + AUDIO_BLOCK_SAMPLES);
+    }
+    return out;
+}
+
+static void checkMixer() {
+    // constant tones, so the mix is plain arithmetic
+    std::vector<uint8_t> a(1000, 128 + 32), b(600, 128 + 16), c(800, 128 - 8), loud(300, 255);
+    SoundAsset sa = pcm8(a, AUDIO_OUTPUT_RATE), sb = pcm8(b, AUDIO_OUTPUT_RATE),
+               sc = pcm8(c, AUDIO_OUTPUT_RATE), sl = pcm8(loud, AUDIO_OUTPUT_RATE);
+    AudioMixer mixer(AUDIO_OUTPUT_RATE);
+    int16_t block[AUDIO_BLOCK_SAMPLES];
+    check(!mixer.render(block, AUDIO_BLOCK_SAMPLES) && !mixer.active(), "idle mixer rendered");
+
+    // two voices add up, the shorter one stops on its own
+    mixer.play(sa, false);
+    mixer.play(sb, false);
+    std::vector<int16_t> out = renderAll(mixer, 10000);
+    check(out.size() >= a.size() && !mixer.active(), "mix didn't end");
+    check(out[0] == (32 + 16) * 256 && out[b.size() - 2] == (32 + 16) * 256,
+          "two voices don't add");
+    check(out[b.size() + 10] == 32 * 256 && out[a.size() + 10] == 0,
+          "ended voice still audible");
+
+    // a third sound steals the oldest voice
+    mixer.play(sa, false);
+    mixer.play(sb, false);
+    mixer.play(sc, false);
+    out = renderAll(mixer, 10000);
+    check(out[0] == (16 - 8) * 256, "third sound didn't replace the oldest voice");
+    // and the next one the voice now oldest, whichever slot it is in
+    mixer.play(sa, false);
+    mixer.play(sb, false);
+    mixer.play(sc, false);
+    mixer.play(sa, false);
+    out = renderAll(mixer, 10000);
+    check(out[0] == (32 - 8) * 256, "fourth sound didn't replace the oldest voice");
+
+    // preempt silences everything else
+    mixer.play(sa, false);
+    mixer.play(sb, false);
+    mixer.play(sc, true);
+    out = renderAll(mixer, 10000);
+    check(out[0] == -8 * 256 && out[c.size() + 10] == 0, "preempting sound mixed with others");
+
+    // loud voices clip instead of wrapping
+    mixer.play(sl, false);
+    mixer.play(sl, false);
+    out = renderAll(mixer, 10000);
+    check(out[0] == 32767, "mix wrapped instead of clipping");
+
+    mixer.play(sa, false);
+    mixer.stopAll();
+    check(!mixer.render(block, AUDIO_BLOCK_SAMPLES), "stopped mixer rendered");
+}
+
+int main(int argc, char **argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : 200;
+    checkRing();
+    checkResampler();
+    checkMixer();
+    if (failures) {
+        printf("%d checks failed\n", failures);
+        return 1;
+    }
+
+    // both chimes at once, the worst case of the playback task
+    AudioMixer mixer(AUDIO_OUTPUT_RATE);
+    int16_t block[AUDIO_BLOCK_SAMPLES];
+    size_t blocks = 0;
+    auto t0 = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        mixer.play(sound_system_notification_4, true);
+        mixer.play(sound_error_10, false);
+        while (mixer.render(block, AUDIO_BLOCK_SAMPLES)) {
+            blocks++;
+        }
+    }
+    double us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+    printf("mix two chimes: %.1f us per %d-sample block (%.1f ms of audio)\n", us / blocks,
+           AUDIO_BLOCK_SAMPLES, AUDIO_BLOCK_SAMPLES * 1000.0 / AUDIO_OUTPUT_RATE);
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Checks the selected binarization backend bit-for-bit against the scalar
+// reference (random data, odd lengths, unaligned buffers), then times
+// both over a VGA frame. Exits non-zero on any mismatch.
+//
+//   g++ -O2 -std=c++17 -Isrc bench/binarize_bench.cpp src/binarize.cpp -o binarize_bench          # sse2
+//   g++ -O2 -mavx2 -std=c++17 -Isrc bench/binarize_bench.cpp src/binarize.cpp -o binarize_bench   # avx2
+//   ./binarize_bench [iterations]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "binarize.h"
+
+using Clock = std::chrono::steady_clock;
+
+static bool checkEquivalence(std::mt19937 &rng) {
+    std::uniform_int_distribution<int> byte(0, 255);
+    std::vector<uint8_t> src(4096 + 64), thr(src.size()), ref(src.size()), out(src.size());
+    for (int round = 0; round < 2000; round++) {
+        size_t n = rng() % 4096;
+        size_t so = rng() % 32, to = rng() % 32, doff = rng() % 32;
+        for (size_t i = 0; i < src.size(); i++) {
+            src[i] = (uint8_t)byte(rng);
+            thr[i] = (uint8_t)byte(rng);
+        }
+        // make the interesting cases (equal, off by one) common
+        for (size_t i = 0; i < n; i += 3) {
+            thr[to + i] = (uint8_t)(src[so + i] + (int)(rng() % 3) - 1);
+        }
+        uint8_t t = (uint8_t)byte(rng);
+
+        binarizeScalar(&src[so], &ref[doff], n, t);
+        binarize(&src[so], &out[doff], n, t);
+        if (memcmp(&ref[doff], &out[doff], n) != 0) {
+            printf("binarize mismatch: n=%zu offset=%zu/%zu t=%u\n", n, so, doff, t);
+            return false;
+        }
+        binarizeMapScalar(&src[so], &thr[to], &ref[doff], n);
+        binarizeMap(&src[so], &thr[to], &out[doff], n);
+        if (memcmp(&ref[doff], &out[doff], n) != 0) {
+            printf("binarizeMap mismatch: n=%zu offsets=%zu/%zu/%zu\n", n, so, to, doff);
+            return false;
+        }
+    }
+    return true;
+}
+
+template <typename F>
+static double usPerFrame(int iterations, F fn) {
+    auto t0 = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        fn();
+    }
+    return std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / iterations;
+}
+
+int main(int argc, char **argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : 500;
+    std::mt19937 rng(42);
+
+    printf("backend: %s\n", binarizeBackend());
+    if (!checkEquivalence(rng)) {
+        return 1;
+    }
+    printf("bit-exact against scalar reference\n");
+
+    const size_t n = 640 * 480;
+    std::vector<uint8_t> src(n), thr(n), dst(n);
+    for (size_t i = 0; i < n; i++) {
+        src[i] = (uint8_t)rng();
+        thr[i] = (uint8_t)(96 + rng() % 64);
+    }
+    printf("VGA global threshold: scalar %.1f us, %s %.1f us\n",
+           usPerFrame(iterations, [&] { binarizeScalar(src.data(), dst.data(), n, 128); }),
+           binarizeBackend(),
+           usPerFrame(iterations, [&] { binarize(src.data(), dst.data(), n, 128); }));
+    printf("VGA threshold map:    scalar %.1f us, %s %.1f us\n",
+           usPerFrame(iterations, [&] { binarizeMapScalar(src.data(), thr.data(), dst.data(), n); }),
+           binarizeBackend(),
+           usPerFrame(iterations, [&] { binarizeMap(src.data(), thr.data(), dst.data(), n); }));
+    return 0;
+}
@@ -0,0 +1,371 @@
+// Decode rate, time per frame and peak heap of the decode path over the
+// recorded frame corpus (see corpus/README.md), for each configuration in
+// configs[]. Every clip is run through a fresh DecodeSession in frame
+// order, as the decode task would see it.
+//
+//   cc -O2 -c -DQUIRC_FLOAT_TYPE=float -I$QUIRC/lib $QUIRC/lib/*.c
+//   SRC="src/decode_session.cpp src/qr_scanner.cpp src/qr_decoder.cpp src/local_threshold.cpp"
+//   SRC="$SRC src/binarize.cpp src/pyramid.cpp src/sharpness.cpp src/roi_tracker.cpp"
+//   SRC="$SRC src/resolution_controller.cpp src/payload_cache.cpp src/module_voter.cpp"
+//   SRC="$SRC src/worker_pool.cpp src/stage_timer.cpp src/pipeline.cpp src/pgm.cpp"
+//   WRAP="-Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc,--wrap=free"
+//   g++ -O2 -std=gnu++17 -pthread -DQR_ZERO_COPY=1 -Isrc -I$QUIRC/lib bench/corpus_bench.cpp $SRC *.o -lm $WRAP -o corpus_bench
+//   ./corpus_bench corpus/vN/manifest.tsv
+//
+// frame% and clip% only cover clips with an expected payload; frames of
+// clips without one (tag empty) that decode anything are counted as false.
+//
+// Compile-time options (QR_ZERO_COPY, QR_PYRAMID_FACTOR, QR_SHARPNESS_RATIO,
+// ...) are compared by building the bench once per setting. Peak heap is
+// the most the decode path held above what was allocated before the
+// configuration started, counted through the --wrap'ed allocator.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <malloc.h>
+#include <map>
+#include <new>
+#include <quirc.h>
+#include <string>
+#include <vector>
+
+#include "decode_session.h"
+#include "pgm.h"
+#include "worker_pool.h"
+
+using Clock = std::chrono::steady_clock;
+
+// heap accounting, fed by the linker-wrapped allocator
+static std::atomic<size_t> heap_current{0};
+static std::atomic<size_t> heap_peak{0};
+
+static void heapAdd(void *p) {
+    size_t now = heap_current += malloc_usable_size(p);
+    size_t peak = heap_peak;
+    while (now > peak && !heap_peak.compare_exchange_weak(peak, now)) {
+    }
+}
+
+static void heapSub(void *p) {
+    heap_current -= malloc_usable_size(p);
+}
+
+extern "C" {
+void *__real_malloc(size_t n);
+void *__real_calloc(size_t n, size_t size);
+void *__real_realloc(void *p, size_t n);
+void __real_free(void *p);
+
+void *__wrap_malloc(size_t n) {
+    void *p = __real_malloc(n);
+    if (p) {
+        heapAdd(p);
+    }
+    return p;
+}
+
+void *__wrap_calloc(size_t n, size_t size) {
+    void *p = __real_calloc(n, size);
+    if (p) {
+        heapAdd(p);
+    }
+    return p;
+}
+
+void *__wrap_realloc(void *p, size_t n) {
+    size_t old = p ? malloc_usable_size(p) : 0;
+    void *q = __real_realloc(p, n);
+    if (q || !n) {
+        heap_current -= old;
+    }
+    if (q) {
+        heapAdd(q);
+    }
+    return q;
+}
+
+void __wrap_free(void *p) {
+    if (p) {
+        heapSub(p);
+    }
+    __real_free(p);
+}
+}
+
+// libstdc++'s operator new calls malloc from inside the shared library,
+// which --wrap doesn't reach
+void *operator new(size_t n) {
+    void *p = malloc(n ? n : 1);
+    if (!p) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void *operator new[](size_t n) {
+    return operator new(n);
+}
+
+void operator delete(void *p) noexcept {
+    free(p);
+}
+
+void operator delete[](void *p) noexcept {
+    free(p);
+}
+
+void operator delete(void *p, size_t) noexcept {
+    free(p);
+}
+
+void operator delete[](void *p, size_t) noexcept {
+    free(p);
+}
+
+struct Image {
+    std::vector<uint8_t> pixels;
+    int width;
+    int height;
+};
+
+struct Clip {
+    std::string name;
+    std::vector<std::string> tags;
+    std::string payload; // expected, empty for clips without a code
+    std::vector<Image> frames;
+};
+
+struct BenchConfig {
+    const char *name;
+    int workers;
+    bool local_threshold;
+};
+
+static const BenchConfig configs[] = {
+    {"1 worker", 1, false},
+    {"2 workers", 2, false},
+    {"1 worker, local threshold", 1, true},
+    {"2 workers, local threshold", 2, true},
+};
+
+struct Tally {
+    int clips;        // with a code
+    int clips_ok;     // expected payload decoded at least once
+    int frames;       // all frames, the time columns
+    int code_frames;  // frames of clips with a code
+    int frames_ok;    // of those, a code decoded or recognized in the frame
+    int false_frames; // frames of clips without a code that decoded something
+    int wrong;        // payloads other than the expected one
+    std::vector<double> ms;
+};
+
+// manifest fields use \t, \n and \\ escapes
+static std::string unescape(const std::string &s) {
+    std::string out;
+    for (size_t i = 0; i < s.size(); i++) {
+        if (s[i] == '\\' && i + 1 < s.size()) {
+            char c = s[++i];
+            out += c == 't' ? '\t' : c == 'n' ? '\n' : c;
+        } else {
+            out += s[i];
+        }
+    }
+    return out;
+}
+
+static std::vector<std::string> split(const std::string &s, char sep) {
+    std::vector<std::string> fields;
+    size_t start = 0;
+    for (;;) {
+        size_t end = s.find(sep, start);
+        fields.push_back(s.substr(start, end - start));
+        if (end == std::string::npos) {
+            return fields;
+        }
+        start = end + 1;
+    }
+}
+
+static bool loadClip(const std::string &dir, Clip &clip) {
+    DIR *d = opendir(dir.c_str());
+    if (!d) {
+        return false;
+    }
+    std::vector<std::string> names;
+    while (struct dirent *e = readdir(d)) {
+        size_t len = strlen(e->d_name);
+        if (len > 4 && !strcmp(e->d_name + len - 4, ".pgm")) {
+            names.push_back(e->d_name);
+        }
+    }
+    closedir(d);
+    std::sort(names.begin(), names.end());
+    for (const std::string &name : names) {
+        Image image;
+        if (!readPgm((dir + "/" + name).c_str(), image.pixels, image.width, image.height)) {
+            fprintf(stderr, "%s/%s: not a binary PGM\n", dir.c_str(), name.c_str());
+            return false;
+        }
+        clip.frames.push_back(std::move(image));
+    }
+    return !clip.frames.empty();
+}
+
+// manifest.tsv: clip directory, comma separated tags, expected payload
+static bool loadManifest(const char *path, std::vector<Clip> &clips) {
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        return false;
+    }
+    std::string base = path;
+    size_t slash = base.rfind('/');
+    base = slash == std::string::npos ? "." : base.substr(0, slash);
+    bool ok = true;
+    char line[4096];
+    while (ok && fgets(line, sizeof(line), f)) {
+        std::string s = line;
+        while (!s.empty() && (s.back() == '\n' || s.back() == '\r')) {
+            s.pop_back();
+        }
+        if (s.empty() || s[0] == '#') {
+            continue;
+        }
+        std::vector<std::string> fields = split(s, '\t');
+        if (fields.size() != 3) {
+            fprintf(stderr, "%s: bad line '%s'\n", path, s.c_str());
+            ok = false;
+            break;
+        }
+        Clip clip;
+        clip.name = fields[0];
+        clip.tags = split(fields[1], ',');
+        clip.payload = unescape(fields[2]);
+        if (!loadClip(base + "/" + clip.name, clip)) {
+            fprintf(stderr, "%s: no frames in %s\n", path, clip.name.c_str());
+            ok = false;
+        }
+        clips.push_back(std::move(clip));
+    }
+    fclose(f);
+    return ok;
+}
+
+static void runClip(const Clip &clip, const BenchConfig &cfg, WorkerPool *pool,
+                    Tally &t) {
+    DecodeSession session(pool, 1);
+    session.scanner().setLocalThreshold(cfg.local_threshold);
+    bool found = false;
+    int wrong = 0;
+    bool empty = clip.payload.empty();
+    auto post = [&](const ScanResult &result) {
+        if (result.err || empty) {
+            return; // empty clips count false frames below
+        }
+        std::string payload((const char *)result.data.payload, result.data.payload_len);
+        if (payload == clip.payload) {
+            found = true;
+        } else {
+            wrong++;
+        }
+    };
+    std::vector<uint8_t> buf;
+    for (const Image &image : clip.frames) {
+        // zero copy binarizes in place, like in the camera's buffer
+        buf = image.pixels;
+        Frame frame;
+        frame.buf = buf.data();
+        frame.len = buf.size();
+        frame.width = image.width;
+        frame.height = image.height;
+        uint32_t before = session.stats().decoded;
+        auto t0 = Clock::now();
+        frame.timestamp_us = monotonicUs();
+        session.decode(frame, [] {}, post);
+        t.ms.push_back(std::chrono::duration<double, std::milli>(Clock::now() - t0).count());
+        t.frames++;
+        bool decoded = session.stats().decoded != before;
+        if (empty) {
+            t.false_frames += decoded;
+        } else {
+            t.code_frames++;
+            t.frames_ok += decoded;
+        }
+    }
+    t.clips += !empty;
+    t.clips_ok += found;
+    t.wrong += wrong;
+}
+
+static void printTally(const std::string &label, Tally &t) {
+    std::sort(t.ms.begin(), t.ms.end());
+    double sum = 0;
+    for (double ms : t.ms) {
+        sum += ms;
+    }
+    double p95 = t.ms.empty() ? 0 : t.ms[std::min(t.ms.size() - 1, t.ms.size() * 95 / 100)];
+    printf("  %-20s %5d %6d %6.1f%% %6.1f%% %5d %5d %8.2f %8.2f\n", label.c_str(),
+           t.clips, t.frames, t.code_frames ? 100.0 * t.frames_ok / t.code_frames : 0,
+           t.clips ? 100.0 * t.clips_ok / t.clips : 0, t.false_frames, t.wrong,
+           t.frames ? sum / t.frames : 0, p95);
+}
+
+int main(int argc, char **argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s corpus/vN/manifest.tsv\n", argv[0]);
+        return 2;
+    }
+    std::vector<Clip> clips;
+    if (!loadManifest(argv[1], clips)) {
+        return 1;
+    }
+    if (clips.empty()) {
+        fprintf(stderr, "%s: no clips, see corpus/README.md for making a version\n", argv[1]);
+        return 1;
+    }
+
+    for (const BenchConfig &cfg : configs) {
+        // clips without an expected payload count false frames only
+        std::map<std::string, Tally> tallies;
+        size_t base = heap_current;
+        heap_peak = base;
+        {
+            WorkerPool pool(cfg.workers - 1, 0, 16384, 1);
+            for (const Clip &clip : clips) {
+                Tally t = {};
+                runClip(clip, cfg, &pool, t);
+                auto add = [&](const std::string &tag) {
+                    Tally &sum = tallies[tag];
+                    sum.clips += t.clips;
+                    sum.clips_ok += t.clips_ok;
+                    sum.frames += t.frames;
+                    sum.code_frames += t.code_frames;
+                    sum.frames_ok += t.frames_ok;
+                    sum.false_frames += t.false_frames;
+                    sum.wrong += t.wrong;
+                    sum.ms.insert(sum.ms.end(), t.ms.begin(), t.ms.end());
+                };
+                add("all");
+                for (const std::string &tag : clip.tags) {
+                    if (!tag.empty()) {
+                        add(tag);
+                    }
+                }
+            }
+        }
+        printf("%s: peak heap %zu KiB\n", cfg.name, (heap_peak - base) / 1024);
+        printf("  %-20s %5s %6s %7s %7s %5s %5s %8s %8s\n", "tag", "clips", "frames",
+               "frame%", "clip%", "false", "wrong", "ms/frame", "p95 ms");
+        printTally("all", tallies["all"]);
+        for (auto &it : tallies) {
+            if (it.first != "all") {
+                printTally(it.first, it.second);
+            }
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,91 @@
+// Cost per frame of the local threshold stage, and decode rate with and
+// without it over a set of screen-captured frames (binary PGM).
+//
+//   cc -O2 -c -DQUIRC_FLOAT_TYPE=float -I$QUIRC/lib $QUIRC/lib/*.c
+//   SRC="src/local_threshold.cpp src/binarize.cpp src/qr_decoder.cpp src/pgm.cpp"
+//   g++ -O2 -std=c++17 -Isrc -I$QUIRC/lib bench/local_threshold_bench.cpp $SRC *.o -lm -o local_threshold_bench
+//   ./local_threshold_bench [-mean] frame.pgm...
+//
+// Without frames only the cost on a synthetic VGA frame is reported.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <quirc.h>
+#include <vector>
+
+#include "local_threshold.h"
+#include "pgm.h"
+#include "qr_decoder.h"
+
+using Clock = std::chrono::steady_clock;
+
+static int decodedCodes(QrDecoder &decoder, int num_codes) {
+    static struct quirc_code code;
+    static struct quirc_data data;
+    int ok = 0;
+    for (int i = 0; i < num_codes; i++) {
+        decoder.extract(i, &code);
+        if (QrDecoder::decode(&code, &data) == QUIRC_SUCCESS) {
+            ok++;
+        }
+    }
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    LocalThreshold::Method method = LocalThreshold::SAUVOLA;
+    int first = 1;
+    if (argc > 1 && strcmp(argv[1], "-mean") == 0) {
+        method = LocalThreshold::MEAN;
+        first = 2;
+    }
+    LocalThreshold threshold(method);
+
+    if (first >= argc) {
+        const int w = 640, h = 480, iterations = 50;
+        std::vector<uint8_t> src(w * h), dst(w * h);
+        for (int i = 0; i < w * h; i++) {
+            src[i] = (uint8_t)((i * 2654435761u) >> 24);
+        }
+        auto t0 = Clock::now();
+        for (int i = 0; i < iterations; i++) {
+            threshold.apply(src.data(), w, h, w, dst.data());
+        }
+        double us = std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+        printf("VGA local threshold: %.1f us/frame\n", us / iterations);
+        return 0;
+    }
+
+    QrDecoder plain(false), thresholded(false);
+    int frames = 0, plain_ok = 0, thresholded_ok = 0;
+    double threshold_us = 0;
+    std::vector<uint8_t> pixels;
+    for (int i = first; i < argc; i++) {
+        int w, h;
+        if (!readPgm(argv[i], pixels, w, h)) {
+            fprintf(stderr, "%s: not a binary PGM\n", argv[i]);
+            continue;
+        }
+        frames++;
+        int a = decodedCodes(plain, plain.detect(pixels.data(), pixels.size(), w, h));
+
+        auto t0 = Clock::now();
+        uint8_t *buf = thresholded.begin(w, h);
+        threshold.apply(pixels.data(), w, h, w, buf);
+        threshold_us += std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+        int b = decodedCodes(thresholded, thresholded.detect());
+
+        plain_ok += a > 0;
+        thresholded_ok += b > 0;
+        printf("%-40s %dx%d plain %d local %d\n", argv[i], w, h, a, b);
+    }
+    if (frames) {
+        printf("%d frames: decoded plain %d (%.0f%%), local threshold %d (%.0f%%), "
+               "threshold cost %.1f us/frame\n",
+               frames, plain_ok, 100.0 * plain_ok / frames,
+               thresholded_ok, 100.0 * thresholded_ok / frames,
+               threshold_us / frames);
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+// Host check of the capture/decode pipeline: a simulated camera delivers
+// frames at a fixed rate, a simulated decoder burns a fixed time per frame.
+// Reports decoded frames per second and how many frames the bounded queue
+// dropped.
+//
+//   g++ -O2 -std=c++17 -pthread -Isrc bench/pipeline_bench.cpp src/pipeline.cpp -o pipeline_bench
+//   ./pipeline_bench [camera_fps] [decode_ms] [queue_depth] [seconds]
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <thread>
+
+#include "pipeline.h"
+
+using Clock = std::chrono::steady_clock;
+
+static void busyWait(std::chrono::microseconds d) {
+    auto until = Clock::now() + d;
+    while (Clock::now() < until) {
+    }
+}
+
+int main(int argc, char **argv) {
+    int camera_fps = argc > 1 ? atoi(argv[1]) : 30;
+    int decode_ms = argc > 2 ? atoi(argv[2]) : 60;
+    int depth = argc > 3 ? atoi(argv[3]) : 1;
+    int seconds = argc > 4 ? atoi(argv[4]) : 5;
+
+    static uint8_t pixels[640 * 480];
+    std::atomic<int> outstanding{0};
+    auto frame_period = std::chrono::microseconds(1000000 / camera_fps);
+    auto next_frame = Clock::now();
+
+    PipelineConfig cfg;
+    cfg.queue_depth = depth;
+    cfg.capture = [&](Frame &f) {
+        // like esp_camera_fb_get(): wait for the sensor
+        next_frame += frame_period;
+        std::this_thread::sleep_until(next_frame);
+        f.buf = pixels;
+        f.len = sizeof(pixels);
+        f.width = 640;
+        f.height = 480;
+        f.timestamp_us = std::chrono::duration_cast<std::chrono::microseconds>(
+                             Clock::now().time_since_epoch()).count();
+        outstanding++;
+        return true;
+    };
+    cfg.decode = [&](Frame &) {
+        busyWait(std::chrono::milliseconds(decode_ms));
+    };
+    cfg.release = [&](Frame &) {
+        outstanding--;
+    };
+
+    Pipeline pipeline(cfg);
+    auto t0 = Clock::now();
+    pipeline.start();
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+    pipeline.stop();
+    double elapsed = std::chrono::duration<double>(Clock::now() - t0).count();
+
+    PipelineStats st = pipeline.stats();
+    double serial_fps = 1000.0 / (1000.0 / camera_fps + decode_ms);
+    printf("camera %d fps, decode %d ms, queue depth %d, %.1f s\n",
+           camera_fps, decode_ms, depth, elapsed);
+    printf("captured %u decoded %u dropped %u\n", st.captured, st.decoded, st.dropped);
+    printf("decoded %.1f fps (serial loop would reach %.1f fps)\n",
+           st.decoded / elapsed, serial_fps);
+    if (outstanding != 0) {
+        printf("ERROR: %d frames never released\n", outstanding.load());
+        return 1;
+    }
+    if (st.captured != st.decoded + st.dropped) {
+        printf("ERROR: frame accounting mismatch\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,270 @@
+// Compression ratio and speed of the frame recorder's codec
+// (src/frame_codec.*), and a round trip of whole recordings through
+// FrameRecorder and the host unpacker's RecordReader, intact and damaged.
+//
+//   SRC="src/frame_codec.cpp src/frame_recorder.cpp src/pipeline.cpp src/pgm.cpp"
+//   NATIVE="src/native/record_reader.cpp src/native/synth_frame.cpp src/native/qr_encoder.cpp"
+//   g++ -O2 -std=gnu++17 -pthread -Isrc -Isrc/native bench/recorder_bench.cpp $SRC $NATIVE -o recorder_bench
+//   ./recorder_bench [-n frames] [-fps N] [frame.pgm...]
+//
+// Without files it records a synthetic clip: a code drifting across a
+// VGA frame with sensor noise, -n frames long (default 120). -fps paces
+// the captures like the camera (default 15), so skipped frames show
+// whether the packer would keep up. Exits non-zero if any frame doesn't
+// come back exactly.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "frame_codec.h"
+#include "frame_recorder.h"
+#include "pgm.h"
+#include "record_reader.h"
+#include "synth_frame.h"
+
+using Clock = std::chrono::steady_clock;
+
+struct Clip {
+    int width = 0;
+    int height = 0;
+    std::vector<std::vector<uint8_t>> frames;
+};
+
+// fail_every > 0 fails every so many records whole, like an SD write
+// error or a full USB-CDC buffer
+class MemorySink : public FrameSink {
+  public:
+    explicit MemorySink(int fail_every = 0) : fail_every_(fail_every) {}
+
+    bool write(const uint8_t *data, size_t len) override {
+        std::lock_guard<std::mutex> lock(mutex_);
+        // a record goes out as the packed record, then its CRC
+        if (len > 4 && fail_every_ && ++records_ % fail_every_ == 0) {
+            return false;
+        }
+        bytes_.insert(bytes_.end(), data, data + len);
+        return true;
+    }
+
+    std::vector<uint8_t> bytes() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return bytes_;
+    }
+
+  private:
+    int fail_every_;
+    int records_ = 0;
+    std::mutex mutex_;
+    std::vector<uint8_t> bytes_;
+};
+
+static void synthClip(Clip &clip, int frames) {
+    static const char payload[] = "WIFI:T:WPA;S:recorder-bench;P:correct horse battery;;";
+    QrSymbol symbol;
+    qrEncode((const uint8_t *)payload, strlen(payload), QR_ECC_M, symbol);
+    clip.width = 640;
+    clip.height = 480;
+    for (int i = 0; i < frames; i++) {
+        SynthParams p;
+        p.center_x = 0.35f + 0.3f * i / frames;
+        p.center_y = 0.45f + 0.1f * i / frames;
+        p.rotate_deg = 5 + 10.0f * i / frames;
+        p.noise = 2;
+        p.seed = i + 1;
+        clip.frames.emplace_back((size_t)clip.width * clip.height);
+        renderQrFrame(symbol, p, clip.frames.back().data());
+    }
+}
+
+static double mbPerSecond(size_t bytes, Clock::duration d) {
+    return bytes / 1e6 / std::chrono::duration<double>(d).count();
+}
+
+// packs every frame as a key frame and against its predecessor
+static bool codecBench(const Clip &clip) {
+    size_t len = (size_t)clip.width * clip.height;
+    std::vector<uint8_t> packed(packBound(len)), out(len);
+    bool ok = true;
+    for (int delta = 0; delta < 2; delta++) {
+        size_t raw = 0, total = 0;
+        Clock::duration pack_time{}, unpack_time{};
+        for (size_t i = delta; i < clip.frames.size(); i++) {
+            const uint8_t *prev = delta ? clip.frames[i - 1].data() : nullptr;
+            auto t0 = Clock::now();
+            size_t n = packFrame(clip.frames[i].data(), prev, clip.width, clip.height,
+                                 packed.data());
+            auto t1 = Clock::now();
+            bool unpacked = unpackFrame(packed.data(), n, prev, clip.width, clip.height,
+                                        out.data());
+            unpack_time += Clock::now() - t1;
+            pack_time += t1 - t0;
+            if (!unpacked || memcmp(out.data(), clip.frames[i].data(), len)) {
+                printf("FAIL: %s frame %zu doesn't round trip\n", delta ? "delta" : "key", i);
+                ok = false;
+            }
+            raw += len;
+            total += n;
+        }
+        if (raw) {
+            printf("%-5s ratio %5.2f pack %7.1f MB/s unpack %7.1f MB/s\n",
+                   delta ? "delta" : "key", (double)raw / total,
+                   mbPerSecond(raw, pack_time), mbPerSecond(raw, unpack_time));
+        }
+    }
+    return ok;
+}
+
+// reads a recording back, every frame must match the clip frame of its seq
+static bool readBack(const Clip &clip, const std::vector<uint8_t> &bytes, const char *what,
+                     RecordReaderStats &st) {
+    FILE *f = fmemopen((void *)bytes.data(), bytes.size(), "rb");
+    if (!f) {
+        perror("fmemopen");
+        return false;
+    }
+    RecordReader reader(f);
+    RecordHeader h;
+    std::vector<uint8_t> payload, pixels;
+    bool ok = true;
+    while (reader.next(h, payload, pixels)) {
+        if (h.seq >= clip.frames.size() || h.width != clip.width ||
+            h.height != clip.height || pixels != clip.frames[h.seq] ||
+            h.codes != h.seq % 3 || payload.size() != h.payload_len) {
+            printf("FAIL: %s frame %u doesn't match\n", what, h.seq);
+            ok = false;
+        }
+    }
+    fclose(f);
+    st = reader.stats();
+    printf("%-8s %7zu bytes frames %4u damaged %u unreferenced %u skipped bytes %llu\n", what,
+           bytes.size(), st.records, st.damaged, st.unreferenced,
+           (unsigned long long)st.skipped_bytes);
+    return ok;
+}
+
+static bool record(const Clip &clip, float fps, MemorySink &sink, RecorderStats &rs) {
+    FrameRecorder recorder((size_t)clip.width * clip.height);
+    if (!recorder.start(&sink, 0, 1)) {
+        printf("FAIL: recorder start\n");
+        return false;
+    }
+    static const char text[] = "https://example.com/recorded";
+    auto period = std::chrono::microseconds((int64_t)(1e6 / fps));
+    auto next = Clock::now();
+    for (size_t i = 0; i < clip.frames.size(); i++) {
+        std::this_thread::sleep_until(next);
+        next += period;
+        Frame frame;
+        frame.buf = (uint8_t *)clip.frames[i].data();
+        frame.len = clip.frames[i].size();
+        frame.width = clip.width;
+        frame.height = clip.height;
+        frame.timestamp_us = i + 1;
+        recorder.capture(frame);
+        RecordOutcome outcome = {};
+        outcome.codes = i % 3;
+        outcome.decoded = outcome.codes ? 1 : 0;
+        outcome.decode_us = 1000 + i;
+        if (outcome.decoded) {
+            outcome.payload_len = sizeof(text) - 1;
+            memcpy(outcome.payload, text, outcome.payload_len);
+        }
+        recorder.submit(frame.timestamp_us, outcome);
+    }
+    recorder.stop();
+    rs = recorder.stats();
+    printf("recorder at %g fps: recorded %u skipped %u dropped %u failed %u ratio %.2f\n", fps,
+           rs.recorded, rs.skipped, rs.dropped, rs.failed,
+           rs.packed_bytes ? (double)rs.raw_bytes / rs.packed_bytes : 0.0);
+    return true;
+}
+
+static bool recorderBench(const Clip &clip, float fps) {
+    MemorySink sink;
+    RecorderStats rs;
+    if (!record(clip, fps, sink, rs)) {
+        return false;
+    }
+    std::vector<uint8_t> bytes = sink.bytes();
+    RecordReaderStats st;
+    bool ok = readBack(clip, bytes, "intact", st);
+    if (st.records != rs.recorded || st.damaged || st.unreferenced || st.skipped_bytes) {
+        printf("FAIL: intact recording didn't read back whole\n");
+        ok = false;
+    }
+
+    // like a serial capture: log lines between records, a few flipped bytes
+    std::vector<uint8_t> damaged;
+    const std::string log = "[  1234][I][main.cpp:300] decodeFrame(): frames 100 QRFR\r\n";
+    size_t step = bytes.size() / 7 + 1;
+    for (size_t i = 0; i < bytes.size(); i += step) {
+        damaged.insert(damaged.end(), log.begin(), log.end());
+        damaged.insert(damaged.end(), bytes.begin() + i,
+                       bytes.begin() + std::min(i + step, bytes.size()));
+    }
+    for (size_t i = 1; i < 4; i++) {
+        damaged[damaged.size() * i / 4] ^= 0x5a;
+    }
+    ok = readBack(clip, damaged, "damaged", st) && ok;
+    if (!st.damaged || !st.records) {
+        printf("FAIL: damage not detected or nothing recovered\n");
+        ok = false;
+    }
+
+    // records lost whole: the next one must not be a delta against them
+    MemorySink failing(10);
+    if (!record(clip, fps, failing, rs)) {
+        return false;
+    }
+    ok = readBack(clip, failing.bytes(), "failed", st) && ok;
+    if (!rs.failed || st.records != rs.recorded || st.unreferenced) {
+        printf("FAIL: records after a failed write didn't read back\n");
+        ok = false;
+    }
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    int frames = 120;
+    float fps = 15;
+    Clip clip;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-fps") && i + 1 < argc) {
+            fps = atof(argv[++i]);
+        } else if (argv[i][0] != '-') {
+            std::vector<uint8_t> pixels;
+            int w, h;
+            if (!readPgm(argv[i], pixels, w, h) ||
+                (!clip.frames.empty() && (w != clip.width || h != clip.height))) {
+                fprintf(stderr, "%s: not a binary PGM of the clip's size\n", argv[i]);
+                return 2;
+            }
+            clip.width = w;
+            clip.height = h;
+            clip.frames.push_back(pixels);
+        } else {
+            fprintf(stderr, "usage: %s [-n frames] [-fps N] [frame.pgm...]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (clip.frames.empty()) {
+        synthClip(clip, frames);
+    }
+    if (clip.frames.empty() || fps <= 0) {
+        fprintf(stderr, "nothing to record\n");
+        return 2;
+    }
+    printf("%zu frames %dx%d\n", clip.frames.size(), clip.width, clip.height);
+    bool ok = codecBench(clip);
+    ok = recorderBench(clip, fps) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+// Drives ScanTable with a simulated scan feed: a handful of networks on
+// different channels with noisy RSSI and missed beacons, swept one
+// channel per interval like WiFiPrescan does, plus enough clutter to
+// force evictions. Checks that selection settles on the strongest access
+// point, follows it when it disappears and expires stale entries. Exits
+// non-zero on failure.
+//
+//   g++ -O2 -std=c++17 -Isrc bench/scan_table_sim.cpp src/scan_table.cpp -o scan_table_sim
+//   ./scan_table_sim
+
+#include <cstdio>
+#include <cstring>
+#include <random>
+#include <vector>
+
+#include "scan_table.h"
+#include "wifi_prescan.h"
+
+struct SimAp {
+    const char *ssid;
+    uint8_t bssid[6];
+    uint8_t channel;
+    int rssi; // mean
+    bool on;
+};
+
+static std::vector<SimAp> makeAps(std::mt19937 &rng) {
+    std::vector<SimAp> aps = {
+        {"home", {0x02, 0, 0, 0, 0, 1}, 1, -72, true},
+        {"home", {0x02, 0, 0, 0, 0, 2}, 6, -55, true},
+        {"home", {0x02, 0, 0, 0, 0, 3}, 11, -80, true},
+        {"guest", {0x02, 0, 0, 0, 1, 1}, 6, -60, true},
+    };
+    // mostly weaker neighbours, more than the table holds
+    for (int i = 0; i < 24; i++) {
+        SimAp ap = {"neighbour", {0x02, 1, 0, 0, 0, (uint8_t)i},
+                    (uint8_t)(1 + rng() % PRESCAN_CHANNELS), -68 - (int)(rng() % 30), true};
+        aps.push_back(ap);
+    }
+    return aps;
+}
+
+// one single-channel scan, beacons are missed now and then
+static void scanChannel(ScanTable &table, const std::vector<SimAp> &aps,
+                        uint8_t channel, uint32_t now, std::mt19937 &rng) {
+    std::normal_distribution<float> noise(0, 4);
+    for (const SimAp &ap : aps) {
+        if (ap.on && ap.channel == channel && rng() % 10 >= 2) {
+            table.update(ap.ssid, ap.bssid, ap.channel, (int8_t)(ap.rssi + noise(rng)), now);
+        }
+    }
+}
+
+// sweep all channels once, returns the time afterwards
+static uint32_t sweep(ScanTable &table, const std::vector<SimAp> &aps,
+                      uint32_t now, std::mt19937 &rng) {
+    for (uint8_t ch = 1; ch <= PRESCAN_CHANNELS; ch++) {
+        now += PRESCAN_INTERVAL_MS;
+        scanChannel(table, aps, ch, now, rng);
+    }
+    return now;
+}
+
+int main() {
+    std::mt19937 rng(1);
+    const int trials = 2000;
+    int best = 0, followed = 0, expired = 0, absent = 0;
+    for (int t = 0; t < trials; t++) {
+        std::vector<SimAp> aps = makeAps(rng);
+        ScanTable table(16, 60000);
+        uint32_t now = rng();
+        // a few sweeps to average out the noise
+        for (int i = 0; i < 3; i++) {
+            now = sweep(table, aps, now, rng);
+        }
+
+        const ScanEntry *e = table.select("home", now);
+        if (e && e->channel == 6 && e->bssid[5] == 2) {
+            best++;
+        }
+        if (!table.select("elsewhere", now)) {
+            absent++;
+        }
+
+        // the strongest AP goes away; once its entry ages out the next
+        // best one is picked
+        aps[1].on = false;
+        for (int i = 0; i < 6; i++) {
+            now = sweep(table, aps, now, rng);
+        }
+        e = table.select("home", now);
+        if (e && e->bssid[5] != 2) {
+            followed++;
+        }
+
+        // nothing seen for longer than max_age
+        if (!table.select("home", now + 60000 + 1)) {
+            expired++;
+        }
+    }
+    printf("strongest AP picked       %5.1f%%\n", 100.0 * best / trials);
+    printf("followed a vanished AP    %5.1f%%\n", 100.0 * followed / trials);
+    printf("unknown SSID not selected %5.1f%%\n", 100.0 * absent / trials);
+    printf("stale entries expired     %5.1f%%\n", 100.0 * expired / trials);
+    printf("sweep time %u ms, radio busy %u%%\n", PRESCAN_CHANNELS * PRESCAN_INTERVAL_MS,
+           100 * PRESCAN_CHANNEL_MS / PRESCAN_INTERVAL_MS);
+    bool ok = best >= trials * 98 / 100 && followed >= trials * 98 / 100 &&
+              absent == trials && expired == trials;
+    return ok ? 0 : 1;
+}
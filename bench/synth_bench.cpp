@@ -0,0 +1,172 @@
+// Decode rate and time per frame of the decode path over synthetic frames
+// (src/native/synth_frame.*), one degradation at a time. Every frame
+// carries a fresh random payload at a random rotation and position and
+// goes straight from the renderer into a DecodeSession, without files.
+//
+//   cc -O2 -c -DQUIRC_FLOAT_TYPE=float -I$QUIRC/lib $QUIRC/lib/*.c
+//   SRC="src/decode_session.cpp src/qr_scanner.cpp src/qr_decoder.cpp src/local_threshold.cpp"
+//   SRC="$SRC src/binarize.cpp src/pyramid.cpp src/sharpness.cpp src/roi_tracker.cpp"
+//   SRC="$SRC src/resolution_controller.cpp src/payload_cache.cpp src/module_voter.cpp"
+//   SRC="$SRC src/worker_pool.cpp src/stage_timer.cpp src/pipeline.cpp src/pgm.cpp"
+//   NATIVE="src/native/synth_frame.cpp src/native/qr_encoder.cpp"
+//   g++ -O2 -std=gnu++17 -pthread -DQR_ZERO_COPY=1 -Isrc -Isrc/native -I$QUIRC/lib bench/synth_bench.cpp $SRC $NATIVE *.o -lm -o synth_bench
+//   ./synth_bench [-n frames] [-size WxH] [-local] [-write dir]
+//
+// -n sets the frames per point (default 50), -local feeds quirc the local
+// threshold, -write saves every frame as PGM for the native build and the
+// corpus. Exits non-zero if an undegraded code fails to decode.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <quirc.h>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "decode_session.h"
+#include "pgm.h"
+#include "synth_frame.h"
+
+using Clock = std::chrono::steady_clock;
+
+struct Axis {
+    const char *name;
+    float SynthParams::*param;
+    std::vector<float> values;
+    QrEcc ecc;
+};
+
+static const Axis axes[] = {
+    {"module_px", &SynthParams::module_px, {1.5f, 2, 2.5f, 3, 4, 6}, QR_ECC_M},
+    {"tilt_deg", &SynthParams::tilt_x_deg, {0, 20, 35, 50, 60}, QR_ECC_M},
+    {"blur_px", &SynthParams::blur_px, {0, 0.5f, 1, 1.5f, 2, 3}, QR_ECC_M},
+    {"noise", &SynthParams::noise, {0, 4, 8, 16, 32}, QR_ECC_M},
+    {"gamma", &SynthParams::gamma, {0.4f, 0.7f, 1, 1.5f, 2.2f}, QR_ECC_M},
+    {"moire", &SynthParams::moire, {0, 0.1f, 0.2f, 0.3f, 0.5f}, QR_ECC_M},
+    // a center overlay needs the strongest level, like the iPhone shortcut
+    {"logo", &SynthParams::logo, {0, 0.1f, 0.2f, 0.25f, 0.3f}, QR_ECC_H},
+};
+
+static std::string randomText(std::mt19937 &rng, int min_len, int max_len) {
+    static const char chars[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789-_ ";
+    int len = min_len + rng() % (max_len - min_len + 1);
+    std::string s;
+    for (int i = 0; i < len; i++) {
+        s += chars[rng() % (sizeof(chars) - 1)];
+    }
+    return s;
+}
+
+// mostly WIFI: codes, the rest URLs and text
+static std::string randomPayload(std::mt19937 &rng) {
+    switch (rng() % 4) {
+        case 0:
+            return "https://example.com/" + randomText(rng, 4, 40);
+        case 1:
+            return randomText(rng, 1, 60);
+        default:
+            return "WIFI:T:WPA;S:" + randomText(rng, 1, 32) + ";P:" +
+                   randomText(rng, 8, 63) + ";;";
+    }
+}
+
+int main(int argc, char **argv) {
+    int frames = 50;
+    int width = 640, height = 480;
+    bool local = false;
+    const char *dir = nullptr;
+    for (int i = 1; i < argc; i++) {
+        if (!strcmp(argv[i], "-n") && i + 1 < argc) {
+            frames = atoi(argv[++i]);
+        } else if (!strcmp(argv[i], "-size") && i + 1 < argc &&
+                   sscanf(argv[i + 1], "%dx%d", &width, &height) == 2) {
+            i++;
+        } else if (!strcmp(argv[i], "-local")) {
+            local = true;
+        } else if (!strcmp(argv[i], "-write") && i + 1 < argc) {
+            dir = argv[++i];
+        } else {
+            fprintf(stderr, "usage: %s [-n frames] [-size WxH] [-local] [-write dir]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    std::mt19937 rng(1);
+    std::uniform_real_distribution<float> unit(0, 1);
+    std::vector<uint8_t> pixels((size_t)width * height);
+    bool baseline_ok = true;
+    printf("%-10s %6s %7s %5s %8s %9s\n", "axis", "value", "decoded", "wrong", "ms/frame",
+           "render ms");
+    for (const Axis &axis : axes) {
+        for (float value : axis.values) {
+            int ok = 0, wrong = 0;
+            double decode_ms = 0, render_ms = 0;
+            for (int n = 0; n < frames; n++) {
+                std::string payload = randomPayload(rng);
+                QrSymbol symbol;
+                qrEncode((const uint8_t *)payload.data(), payload.size(), axis.ecc, symbol);
+                SynthParams p;
+                p.width = width;
+                p.height = height;
+                p.rotate_deg = 360 * unit(rng);
+                p.center_x = 0.4f + 0.2f * unit(rng);
+                p.center_y = 0.4f + 0.2f * unit(rng);
+                p.seed = rng();
+                p.*axis.param = value;
+                // keep the code in the frame however large it gets
+                float fit = 0.9f * std::min(width, height) / ((symbol.size + 2 * p.quiet) * M_SQRT2);
+                p.module_px = std::min(p.module_px, fit);
+
+                auto t0 = Clock::now();
+                renderQrFrame(symbol, p, pixels.data());
+                render_ms += std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+                if (dir) {
+                    char path[512];
+                    snprintf(path, sizeof(path), "%s/%s_%g_%04d.pgm", dir, axis.name, value, n);
+                    writePgm(path, pixels.data(), width, height);
+                }
+
+                // a session per frame, the frames are unrelated
+                DecodeSession session(nullptr, 1);
+                session.scanner().setLocalThreshold(local);
+                bool found = false;
+                Frame frame;
+                frame.buf = pixels.data();
+                frame.len = pixels.size();
+                frame.width = width;
+                frame.height = height;
+                t0 = Clock::now();
+                frame.timestamp_us = monotonicUs();
+                session.decode(frame, [] {}, [&](const ScanResult &result) {
+                    if (result.err) {
+                        return;
+                    }
+                    const struct quirc_data &d = result.data;
+                    if (payload.compare(0, std::string::npos, (const char *)d.payload,
+                                        d.payload_len) == 0) {
+                        found = true;
+                    } else {
+                        wrong++;
+                    }
+                });
+                decode_ms += std::chrono::duration<double, std::milli>(Clock::now() - t0).count();
+                ok += found;
+            }
+            printf("%-10s %6g %6.1f%% %5d %8.2f %9.2f\n", axis.name, value,
+                   100.0 * ok / frames, wrong, decode_ms / frames, render_ms / frames);
+            SynthParams defaults;
+            if (value == defaults.*axis.param && (ok < frames || wrong)) {
+                baseline_ok = false;
+            }
+        }
+    }
+    if (!baseline_ok) {
+        printf("FAIL: undegraded codes didn't all decode\n");
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,280 @@
+// Fuzzes parseWiFiUri() against the String-based parser it replaced
+// (kept below on a minimal Arduino String stand-in), then times both on
+// a typical WIFI: URI. Exits non-zero on any mismatch.
+//
+// The old parser split on every ';', so values containing an escaped
+// semicolon came out wrong; those inputs are counted but not compared.
+// Values over the SSID/password limits must be rejected by the new one.
+//
+//   g++ -O2 -std=c++17 -Isrc bench/wifi_uri_bench.cpp src/wifi_uri.cpp -o wifi_uri_bench
+//   ./wifi_uri_bench [iterations]
+
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+#include "wifi_uri.h"
+
+using Clock = std::chrono::steady_clock;
+
+// Arduino String semantics as far as the old parser relies on them.
+class String {
+  public:
+    String(const char *s = "") : s_(s) {}
+    String(const std::string &s) : s_(s) {}
+    unsigned length() const {
+        return (unsigned)s_.size();
+    }
+    char operator[](unsigned i) const {
+        return i < s_.size() ? s_[i] : 0;
+    }
+    String &operator+=(char c) {
+        s_ += c;
+        return *this;
+    }
+    bool operator==(const char *o) const {
+        return s_ == o;
+    }
+    bool startsWith(const String &p) const {
+        return s_.compare(0, p.s_.size(), p.s_) == 0 && s_.size() >= p.s_.size();
+    }
+    bool endsWith(const String &p) const {
+        return s_.size() >= p.s_.size() &&
+               s_.compare(s_.size() - p.s_.size(), p.s_.size(), p.s_) == 0;
+    }
+    int indexOf(char c, unsigned from = 0) const {
+        if (from >= s_.size()) {
+            return -1;
+        }
+        size_t i = s_.find(c, from);
+        return i == std::string::npos ? -1 : (int)i;
+    }
+    String substring(unsigned left) const {
+        return substring(left, length());
+    }
+    String substring(unsigned left, unsigned right) const {
+        if (left > right) {
+            std::swap(left, right);
+        }
+        if (left >= s_.size()) {
+            return String();
+        }
+        if (right > s_.size()) {
+            right = (unsigned)s_.size();
+        }
+        return String(s_.substr(left, right - left));
+    }
+    const std::string &str() const {
+        return s_;
+    }
+
+  private:
+    std::string s_;
+};
+
+struct LegacyWiFiConfig {
+    String SSID;
+    String type;
+    String password;
+};
+
+// ---- the previous implementation, unchanged ----
+
+String unescape(const String& str) {
+    String result = "";
+    int i = 0;
+    while (i < str.length()) {
+        if (str[i] == '\\' && i + 1 < str.length()) {
+            char next = str[i + 1];
+            if (next == '\\') {
+                result += '\\';
+            } else if (next == ';') {
+                result += ';';
+            } else if (next == ',') {
+                result += ',';
+            } else if (next == '"') {
+                result += '"';
+            } else if (next == ':') {
+                result += ':';
+            } else {
+                // Unknown escape, add both
+                result += '\\';
+                result += next;
+            }
+            i += 2; // Skip both \\ and next
+        } else {
+            result += str[i];
+            i++;
+        }
+    }
+    return result;
+}
+
+void processPair(const String& pair, LegacyWiFiConfig& config) {
+    int colon = pair.indexOf(':');
+    if (colon != -1) {
+        String key = pair.substring(0, colon);
+        String value = pair.substring(colon + 1);
+        value = unescape(value);
+        if (value.startsWith("\"") && value.endsWith("\"")) {
+            value = value.substring(1, value.length() - 1);
+        }
+        if (key == "S") {
+            config.SSID = value;
+        } else if (key == "T") {
+            config.type = value;
+        } else if (key == "P") {
+            config.password = value;
+        }
+    }
+}
+
+LegacyWiFiConfig parseWiFiQR(const String& qrText) {
+    LegacyWiFiConfig config;
+    if (!qrText.startsWith("WIFI:")) {
+        return config;
+    }
+    String content = qrText.substring(5);
+    while (content.endsWith(";")) {
+        content = content.substring(0, content.length() - 1);
+    }
+    int start = 0;
+    int end = content.indexOf(';');
+    while (end != -1) {
+        String pair = content.substring(start, end);
+        processPair(pair, config);
+        start = end + 1;
+        end = content.indexOf(';', start);
+    }
+    String lastPair = content.substring(start);
+    processPair(lastPair, config);
+    return config;
+}
+
+// ---- end of the previous implementation ----
+
+// a semicolon after an odd run of backslashes
+static bool hasEscapedSemicolon(const std::string &s) {
+    for (size_t i = 0; i < s.size(); i++) {
+        if (s[i] == '\\' && i + 1 < s.size()) {
+            if (s[i + 1] == ';') {
+                return true;
+            }
+            i++;
+        }
+    }
+    return false;
+}
+
+static std::string randomUri(std::mt19937 &rng) {
+    static const char *tokens[] = {
+        "S:", "T:", "P:", "H:", "X:", ";", ";;", "\\", "\\\\", "\\;", "\\:",
+        "\\,", "\\\"", "\\n", "\"", ":", ",", "WPA", "nopass", "home", "a",
+        "0123456789abcdef", "Ω", " ",
+    };
+    std::string s = rng() % 16 ? "WIFI:" : (rng() % 2 ? "WIFI" : "wifi:");
+    int n = rng() % 24;
+    for (int i = 0; i < n; i++) {
+        s += tokens[rng() % (sizeof(tokens) / sizeof(tokens[0]))];
+    }
+    return s;
+}
+
+static bool checkEquivalence(std::mt19937 &rng, int rounds) {
+    int compared = 0, escaped = 0, rejected = 0, failures = 0;
+    for (int round = 0; round < rounds; round++) {
+        std::string uri = randomUri(rng);
+        WiFiConfig cfg;
+        bool ok = parseWiFiUri(uri.data(), uri.size(), cfg);
+        if (hasEscapedSemicolon(uri)) {
+            escaped++;
+            continue;
+        }
+        // the old parser only took an upper case scheme, the new one any
+        std::string legacy = uri;
+        for (size_t i = 0; i < 4 && i < legacy.size(); i++) {
+            legacy[i] = toupper((unsigned char)legacy[i]);
+        }
+        bool wifi = legacy.compare(0, 5, "WIFI:") == 0;
+        LegacyWiFiConfig ref = parseWiFiQR(String(legacy));
+        bool fits = ref.SSID.length() <= WIFI_SSID_MAX &&
+                    ref.type.length() <= WIFI_TYPE_MAX &&
+                    ref.password.length() <= WIFI_PASSWORD_MAX;
+        bool match;
+        if (!wifi) {
+            match = !ok && !cfg.ssid[0] && !ref.SSID.length();
+        } else if (!fits) {
+            rejected++;
+            match = !ok;
+        } else {
+            match = ok && ref.SSID.str() == cfg.ssid && ref.type.str() == cfg.type &&
+                    ref.password.str() == cfg.password;
+        }
+        compared++;
+        if (!match && failures++ < 10) {
+            printf("mismatch: '%s'\n  old S '%s' T '%s' P '%s'\n  new %d S '%s' T '%s' P '%s'\n",
+                   uri.c_str(), ref.SSID.str().c_str(), ref.type.str().c_str(),
+                   ref.password.str().c_str(), ok, cfg.ssid, cfg.type, cfg.password);
+        }
+    }
+    printf("fuzz: %d compared (%d over limits), %d with escaped ';' skipped, %d mismatches\n",
+           compared, rejected, escaped, failures);
+    return failures == 0;
+}
+
+// cases the old parser got wrong
+static bool checkEscapes() {
+    static const struct {
+        const char *uri, *ssid, *password;
+    } cases[] = {
+        {"WIFI:S:a\\;b;P:x;;", "a;b", "x"},
+        {"WIFI:S:net;P:pa\\;ss\\;;", "net", "pa;ss;"},
+        {"WIFI:S:\"q\\;\";;", "q;", ""},
+        {"wifi:S:net;P:x;;", "net", "x"},
+    };
+    bool ok = true;
+    for (const auto &c : cases) {
+        WiFiConfig cfg;
+        if (!parseWiFiUri(c.uri, strlen(c.uri), cfg) || strcmp(cfg.ssid, c.ssid) ||
+                strcmp(cfg.password, c.password)) {
+            printf("escape case failed: '%s' -> S '%s' P '%s'\n", c.uri, cfg.ssid,
+                   cfg.password);
+            ok = false;
+        }
+    }
+    return ok;
+}
+
+int main(int argc, char **argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : 200000;
+    std::mt19937 rng(1);
+    if (!checkEquivalence(rng, 200000) || !checkEscapes()) {
+        return 1;
+    }
+
+    const char *uri = "WIFI:T:WPA;S:\"Guest Network\";P:correct\\;horse\\:battery;H:false;;";
+    size_t len = strlen(uri);
+    volatile size_t sink = 0;
+
+    auto t0 = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        LegacyWiFiConfig c = parseWiFiQR(String(uri));
+        sink += c.SSID.length();
+    }
+    auto t1 = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        WiFiConfig c;
+        parseWiFiUri(uri, len, c);
+        sink += c.ssid[0];
+    }
+    auto t2 = Clock::now();
+    double old_ns = std::chrono::duration<double, std::nano>(t1 - t0).count() / iterations;
+    double new_ns = std::chrono::duration<double, std::nano>(t2 - t1).count() / iterations;
+    printf("String parser  %8.1f ns/uri\n", old_ns);
+    printf("single pass    %8.1f ns/uri  (%.1fx)\n", new_ns, old_ns / new_ns);
+    return 0;
+}
@@ -0,0 +1,92 @@
+// Per-frame cost of handing a camera frame to quirc with and without the
+// copy into quirc's own buffer, at QVGA, VGA and SVGA.
+//
+//   cc -O2 -c -DQUIRC_FLOAT_TYPE=float -I$QUIRC/lib $QUIRC/lib/*.c
+//   g++ -O2 -std=c++17 -Isrc -I$QUIRC/lib bench/zerocopy_bench.cpp src/qr_decoder.cpp *.o -lm -o zerocopy_bench
+//   ./zerocopy_bench [iterations]
+//
+// The host numbers are a lower bound for the copy: on the CoreS3 both the
+// frame buffer and quirc's image live in PSRAM, so the memcpy competes with
+// the camera DMA for the same bus.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+#include "qr_decoder.h"
+
+using Clock = std::chrono::steady_clock;
+
+struct Resolution {
+    const char *name;
+    int width;
+    int height;
+};
+
+static const Resolution resolutions[] = {
+    {"QVGA", 320, 240},
+    {"VGA", 640, 480},
+    {"SVGA", 800, 600},
+};
+
+static void fillFrame(std::vector<uint8_t> &frame, int width, int height, unsigned seed) {
+    srand(seed);
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            frame[y * width + x] = (uint8_t)(((x ^ y) & 0x20 ? 200 : 40) + rand() % 16);
+        }
+    }
+}
+
+// mean microseconds per frame for detect() over a fresh frame each time
+static double timeDetect(QrDecoder &decoder, std::vector<uint8_t> &frame,
+                         const std::vector<uint8_t> &pristine,
+                         int width, int height, int iterations) {
+    double total = 0;
+    for (int i = 0; i < iterations; i++) {
+        // zero-copy clobbers the frame, restore it outside the timed region
+        memcpy(frame.data(), pristine.data(), frame.size());
+        auto t0 = Clock::now();
+        decoder.detect(frame.data(), frame.size(), width, height);
+        decoder.release();
+        total += std::chrono::duration<double, std::micro>(Clock::now() - t0).count();
+    }
+    return total / iterations;
+}
+
+static double timeCopy(std::vector<uint8_t> &dst, const std::vector<uint8_t> &src,
+                       int iterations) {
+    auto t0 = Clock::now();
+    for (int i = 0; i < iterations; i++) {
+        memcpy(dst.data(), src.data(), src.size());
+        __asm__ __volatile__("" : : "r"(dst.data()) : "memory");
+    }
+    return std::chrono::duration<double, std::micro>(Clock::now() - t0).count() / iterations;
+}
+
+int main(int argc, char **argv) {
+    int iterations = argc > 1 ? atoi(argv[1]) : 50;
+
+    printf("%-5s %9s %12s %12s %12s\n", "size", "bytes", "memcpy us",
+           "copy us", "zero-copy us");
+    for (const Resolution &r : resolutions) {
+        size_t len = (size_t)r.width * r.height;
+        std::vector<uint8_t> pristine(len), frame(len), scratch(len);
+        fillFrame(pristine, r.width, r.height, 1);
+
+        QrDecoder copying(false);
+        QrDecoder zero_copy(true);
+        // first call allocates, keep it out of the numbers
+        timeDetect(copying, frame, pristine, r.width, r.height, 1);
+        timeDetect(zero_copy, frame, pristine, r.width, r.height, 1);
+
+        double copy_us = timeCopy(scratch, pristine, iterations);
+        double with_copy = timeDetect(copying, frame, pristine, r.width, r.height, iterations);
+        double without = timeDetect(zero_copy, frame, pristine, r.width, r.height, iterations);
+        printf("%-5s %9zu %12.1f %12.1f %12.1f  saved %.1f us/frame\n",
+               r.name, len, copy_us, with_copy, without, with_copy - without);
+    }
+    return 0;
+}
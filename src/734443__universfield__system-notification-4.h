@@ -1,5198 +1,1308 @@
-unsigned char __734443__universfield__system_notification_4_wav[] = {
-  0x52, 0x49, 0x46, 0x46, 0x72, 0xf3, 0x00, 0x00, 0x57, 0x41, 0x56, 0x45,
-  0x66, 0x6d, 0x74, 0x20, 0x10, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
-  0x44, 0xac, 0x00, 0x00, 0x44, 0xac, 0x00, 0x00, 0x01, 0x00, 0x08, 0x00,
-  0x4c, 0x49, 0x53, 0x54, 0x46, 0x00, 0x00, 0x00, 0x49, 0x4e, 0x46, 0x4f,
-  0x49, 0x43, 0x52, 0x44, 0x05, 0x00, 0x00, 0x00, 0x32, 0x30, 0x32, 0x34,
-  0x00, 0x00, 0x49, 0x53, 0x46, 0x54, 0x0d, 0x00, 0x00, 0x00, 0x4c, 0x61,
-  0x76, 0x66, 0x36, 0x31, 0x2e, 0x37, 0x2e, 0x31, 0x30, 0x30, 0x00, 0x00,
-  0x49, 0x54, 0x43, 0x48, 0x15, 0x00, 0x00, 0x00, 0x4c, 0x41, 0x4d, 0x45,
-  0x20, 0x69, 0x6e, 0x20, 0x46, 0x4c, 0x20, 0x53, 0x74, 0x75, 0x64, 0x69,
-  0x6f, 0x20, 0x32, 0x30, 0x00, 0x00, 0x64, 0x61, 0x74, 0x61, 0x00, 0xf3,
-  0x00, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x7f, 0x80, 0x7f, 0x81,
-  0x82, 0x7f, 0x7f, 0x81, 0x82, 0x80, 0x7d, 0x7f, 0x84, 0x85, 0x84, 0x84,
-  0x82, 0x78, 0x75, 0x81, 0x86, 0x85, 0x82, 0x82, 0x83, 0x7e, 0x7e, 0x84,
-  0x7f, 0x75, 0x77, 0x83, 0x86, 0x86, 0x7f, 0x72, 0x76, 0x7f, 0x7d, 0x7f,
-  0x7e, 0x7d, 0x81, 0x7b, 0x75, 0x7a, 0x76, 0x6e, 0x76, 0x82, 0x82, 0x81,
-  0x83, 0x81, 0x79, 0x78, 0x80, 0x7b, 0x71, 0x73, 0x84, 0x8d, 0x7f, 0x7a,
-  0x87, 0x87, 0x7d, 0x7d, 0x7e, 0x7a, 0x76, 0x7a, 0x88, 0x87, 0x7f, 0x7f,
-  0x7a, 0x7c, 0x8b, 0x90, 0x8c, 0x86, 0x81, 0x87, 0x8b, 0x8c, 0x88, 0x78,
-  0x6f, 0x7d, 0x8f, 0x8f, 0x89, 0x8d, 0x89, 0x79, 0x75, 0x89, 0x95, 0x8b,
-  0x86, 0x8b, 0x8f, 0x88, 0x7c, 0x79, 0x75, 0x70, 0x78, 0x83, 0x85, 0x85,
-  0x86, 0x83, 0x7c, 0x77, 0x7d, 0x82, 0x86, 0x8e, 0x8d, 0x83, 0x7d, 0x7a,
-  0x7b, 0x83, 0x8b, 0x8d, 0x85, 0x7d, 0x81, 0x83, 0x73, 0x66, 0x6c, 0x73,
-  0x76, 0x83, 0x95, 0x99, 0x89, 0x83, 0x8a, 0x8c, 0x88, 0x88, 0x8b, 0x89,
-  0x83, 0x88, 0x8f, 0x87, 0x7b, 0x75, 0x78, 0x85, 0x8e, 0x8f, 0x8c, 0x86,
-  0x85, 0x85, 0x80, 0x82, 0x88, 0x81, 0x7a, 0x7f, 0x84, 0x82, 0x7b, 0x78,
-  0x7b, 0x7a, 0x7a, 0x82, 0x87, 0x81, 0x7d, 0x7f, 0x78, 0x6b, 0x6b, 0x75,
-  0x78, 0x78, 0x7b, 0x7f, 0x81, 0x7d, 0x7b, 0x79, 0x6b, 0x5d, 0x5c, 0x63,
-  0x6d, 0x77, 0x76, 0x71, 0x71, 0x75, 0x7a, 0x7c, 0x7e, 0x7e, 0x79, 0x74,
-  0x7a, 0x7d, 0x76, 0x70, 0x76, 0x7f, 0x84, 0x8a, 0x90, 0x8c, 0x7f, 0x78,
-  0x7c, 0x80, 0x7d, 0x7c, 0x83, 0x85, 0x83, 0x82, 0x81, 0x7f, 0x81, 0x83,
-  0x8a, 0x91, 0x96, 0x9a, 0x9a, 0x94, 0x90, 0x8d, 0x88, 0x87, 0x88, 0x86,
-  0x83, 0x81, 0x80, 0x7e, 0x7d, 0x82, 0x86, 0x81, 0x7d, 0x7f, 0x7f, 0x79,
-  0x73, 0x72, 0x72, 0x72, 0x7a, 0x87, 0x8b, 0x84, 0x7b, 0x75, 0x6f, 0x67,
-  0x65, 0x66, 0x63, 0x62, 0x65, 0x6b, 0x71, 0x75, 0x76, 0x75, 0x76, 0x76,
-  0x76, 0x71, 0x6d, 0x69, 0x63, 0x61, 0x66, 0x6b, 0x6b, 0x69, 0x6d, 0x73,
-  0x75, 0x76, 0x7a, 0x7e, 0x7f, 0x80, 0x85, 0x8a, 0x8b, 0x8c, 0x8e, 0x8c,
-  0x87, 0x85, 0x85, 0x85, 0x84, 0x87, 0x8b, 0x8b, 0x89, 0x88, 0x88, 0x89,
-  0x8b, 0x8c, 0x8f, 0x96, 0x9c, 0xa1, 0xa2, 0xa1, 0xa1, 0xa1, 0xa1, 0xa3,
-  0xa0, 0x97, 0x8e, 0x8c, 0x8d, 0x8c, 0x8c, 0x90, 0x95, 0x98, 0x9c, 0xa0,
-  0x9e, 0x94, 0x8b, 0x87, 0x86, 0x86, 0x89, 0x8c, 0x8d, 0x8e, 0x8f, 0x90,
-  0x8f, 0x8c, 0x8b, 0x8c, 0x8e, 0x90, 0x8e, 0x88, 0x84, 0x82, 0x81, 0x82,
-  0x85, 0x8a, 0x8e, 0x8d, 0x8b, 0x86, 0x7e, 0x7a, 0x7c, 0x81, 0x84, 0x85,
-  0x87, 0x85, 0x80, 0x7d, 0x7c, 0x7c, 0x7d, 0x81, 0x88, 0x8d, 0x8c, 0x88,
-  0x82, 0x7c, 0x78, 0x78, 0x7a, 0x7c, 0x7c, 0x7d, 0x7f, 0x80, 0x7e, 0x79,
-  0x73, 0x71, 0x71, 0x6f, 0x6b, 0x66, 0x60, 0x5b, 0x58, 0x5c, 0x64, 0x6c,
-  0x74, 0x7c, 0x7f, 0x7c, 0x74, 0x6c, 0x63, 0x5b, 0x57, 0x59, 0x5c, 0x5e,
-  0x5e, 0x5d, 0x5b, 0x57, 0x55, 0x55, 0x56, 0x59, 0x5d, 0x5e, 0x5d, 0x5d,
-  0x5f, 0x63, 0x68, 0x6d, 0x71, 0x72, 0x74, 0x75, 0x72, 0x6c, 0x67, 0x66,
-  0x67, 0x6b, 0x72, 0x78, 0x7d, 0x7e, 0x80, 0x82, 0x83, 0x85, 0x88, 0x8d,
-  0x91, 0x95, 0x99, 0x97, 0x90, 0x87, 0x81, 0x80, 0x83, 0x89, 0x90, 0x97,
-  0x9e, 0xa3, 0xa6, 0xa7, 0xa7, 0xa7, 0xa7, 0xa7, 0xa6, 0xa3, 0x9f, 0x9b,
-  0x98, 0x96, 0x97, 0x9a, 0x9e, 0x9f, 0x9d, 0x9a, 0x94, 0x8c, 0x86, 0x85,
-  0x88, 0x8c, 0x91, 0x97, 0x9c, 0x9e, 0x9e, 0x9a, 0x94, 0x8d, 0x88, 0x87,
-  0x88, 0x88, 0x86, 0x83, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x7e, 0x7c, 0x7b, 0x7c, 0x7d, 0x7f, 0x81, 0x81, 0x7f, 0x7d,
-  0x7f, 0x83, 0x87, 0x8a, 0x8c, 0x8c, 0x8a, 0x86, 0x81, 0x7b, 0x75, 0x72,
-  0x73, 0x77, 0x7c, 0x82, 0x8a, 0x8e, 0x8e, 0x8b, 0x86, 0x82, 0x7e, 0x7b,
-  0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7d, 0x80, 0x81, 0x82, 0x82, 0x81, 0x7e,
-  0x7a, 0x75, 0x71, 0x6f, 0x72, 0x79, 0x81, 0x85, 0x85, 0x82, 0x7d, 0x76,
-  0x70, 0x6b, 0x67, 0x64, 0x64, 0x66, 0x69, 0x6a, 0x6b, 0x6c, 0x6f, 0x73,
-  0x7a, 0x81, 0x85, 0x86, 0x84, 0x82, 0x7f, 0x7d, 0x79, 0x74, 0x71, 0x6f,
-  0x6e, 0x6e, 0x6d, 0x6d, 0x6d, 0x71, 0x78, 0x7f, 0x84, 0x88, 0x8a, 0x89,
-  0x85, 0x80, 0x7e, 0x7f, 0x83, 0x87, 0x8b, 0x8d, 0x8c, 0x88, 0x83, 0x7e,
-  0x79, 0x76, 0x75, 0x76, 0x79, 0x7e, 0x82, 0x83, 0x84, 0x87, 0x8b, 0x8e,
-  0x8f, 0x8b, 0x84, 0x7c, 0x75, 0x70, 0x6c, 0x6a, 0x6b, 0x6f, 0x75, 0x7a,
-  0x7e, 0x7e, 0x7b, 0x79, 0x77, 0x77, 0x79, 0x7b, 0x7c, 0x7b, 0x79, 0x76,
-  0x72, 0x6e, 0x6b, 0x6a, 0x6d, 0x72, 0x76, 0x77, 0x76, 0x73, 0x71, 0x6f,
-  0x70, 0x73, 0x78, 0x7c, 0x80, 0x81, 0x80, 0x80, 0x82, 0x87, 0x8c, 0x8f,
-  0x91, 0x90, 0x8e, 0x89, 0x83, 0x7e, 0x7d, 0x7f, 0x85, 0x8e, 0x96, 0x9b,
-  0x9c, 0x9a, 0x95, 0x91, 0x8f, 0x8f, 0x91, 0x93, 0x98, 0x9d, 0xa1, 0xa3,
-  0xa3, 0xa2, 0xa3, 0xa5, 0xa5, 0xa4, 0x9f, 0x99, 0x92, 0x8b, 0x88, 0x88,
-  0x8c, 0x93, 0x9a, 0x9f, 0xa1, 0xa0, 0x9d, 0x99, 0x96, 0x95, 0x95, 0x96,
-  0x96, 0x94, 0x90, 0x8a, 0x84, 0x7e, 0x7c, 0x7d, 0x7f, 0x82, 0x85, 0x87,
-  0x87, 0x86, 0x85, 0x83, 0x81, 0x7f, 0x7f, 0x80, 0x81, 0x7f, 0x7c, 0x77,
-  0x73, 0x71, 0x70, 0x6e, 0x6d, 0x6b, 0x68, 0x66, 0x64, 0x63, 0x66, 0x6b,
-  0x74, 0x7c, 0x84, 0x89, 0x89, 0x82, 0x78, 0x6d, 0x64, 0x5f, 0x5c, 0x5c,
-  0x5f, 0x61, 0x63, 0x64, 0x65, 0x67, 0x6a, 0x6c, 0x6f, 0x72, 0x74, 0x74,
-  0x74, 0x72, 0x70, 0x6f, 0x6f, 0x72, 0x73, 0x73, 0x71, 0x6d, 0x68, 0x63,
-  0x61, 0x62, 0x65, 0x69, 0x6e, 0x73, 0x76, 0x76, 0x73, 0x71, 0x6f, 0x71,
-  0x75, 0x7a, 0x7d, 0x7d, 0x7a, 0x75, 0x71, 0x6c, 0x69, 0x69, 0x6d, 0x72,
-  0x78, 0x7c, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x85, 0x85, 0x84, 0x82, 0x7f,
-  0x7c, 0x7c, 0x7e, 0x82, 0x87, 0x8d, 0x92, 0x95, 0x94, 0x92, 0x8e, 0x8a,
-  0x86, 0x84, 0x86, 0x8b, 0x92, 0x98, 0x9c, 0x9d, 0x9b, 0x99, 0x99, 0x99,
-  0x9a, 0x9b, 0x9c, 0x9c, 0x9c, 0x99, 0x95, 0x92, 0x90, 0x91, 0x95, 0x97,
-  0x98, 0x97, 0x95, 0x92, 0x90, 0x91, 0x94, 0x99, 0x9d, 0x9e, 0x9e, 0x9c,
-  0x99, 0x95, 0x92, 0x90, 0x90, 0x91, 0x90, 0x8e, 0x89, 0x82, 0x7b, 0x75,
-  0x73, 0x75, 0x7c, 0x85, 0x8d, 0x92, 0x94, 0x94, 0x93, 0x8f, 0x8b, 0x87,
-  0x84, 0x81, 0x7d, 0x79, 0x74, 0x6e, 0x6c, 0x6d, 0x72, 0x78, 0x7d, 0x81,
-  0x81, 0x7d, 0x79, 0x77, 0x77, 0x79, 0x7d, 0x81, 0x85, 0x85, 0x82, 0x7c,
-  0x74, 0x6d, 0x68, 0x67, 0x68, 0x6b, 0x6d, 0x6f, 0x70, 0x71, 0x73, 0x76,
-  0x7a, 0x7e, 0x81, 0x82, 0x81, 0x7e, 0x7a, 0x74, 0x6e, 0x6a, 0x67, 0x67,
-  0x69, 0x69, 0x68, 0x67, 0x67, 0x68, 0x6b, 0x6f, 0x77, 0x7d, 0x80, 0x80,
-  0x7e, 0x7b, 0x76, 0x70, 0x6d, 0x6c, 0x6e, 0x71, 0x74, 0x75, 0x75, 0x72,
-  0x70, 0x6e, 0x6f, 0x70, 0x72, 0x74, 0x76, 0x76, 0x77, 0x7a, 0x7e, 0x80,
-  0x83, 0x85, 0x88, 0x88, 0x85, 0x81, 0x7c, 0x78, 0x76, 0x78, 0x7c, 0x82,
-  0x86, 0x8a, 0x8c, 0x8b, 0x87, 0x83, 0x81, 0x81, 0x82, 0x85, 0x89, 0x8c,
-  0x8c, 0x8b, 0x8a, 0x89, 0x8a, 0x8d, 0x90, 0x92, 0x92, 0x8f, 0x8b, 0x86,
-  0x82, 0x80, 0x82, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x89, 0x8b, 0x8e,
-  0x92, 0x96, 0x97, 0x95, 0x8f, 0x87, 0x80, 0x7b, 0x79, 0x7a, 0x7d, 0x81,
-  0x84, 0x86, 0x87, 0x87, 0x85, 0x83, 0x82, 0x85, 0x89, 0x8c, 0x8e, 0x8f,
-  0x8e, 0x8d, 0x8b, 0x8a, 0x88, 0x86, 0x82, 0x7e, 0x79, 0x74, 0x6f, 0x6f,
-  0x72, 0x79, 0x81, 0x8a, 0x91, 0x95, 0x96, 0x94, 0x90, 0x8c, 0x88, 0x86,
-  0x85, 0x84, 0x81, 0x7e, 0x7a, 0x76, 0x72, 0x71, 0x73, 0x76, 0x79, 0x7e,
-  0x83, 0x87, 0x89, 0x89, 0x88, 0x87, 0x87, 0x87, 0x87, 0x85, 0x81, 0x7e,
-  0x7b, 0x79, 0x77, 0x77, 0x79, 0x7c, 0x7e, 0x7f, 0x7e, 0x7d, 0x7a, 0x79,
-  0x7c, 0x82, 0x89, 0x8f, 0x92, 0x92, 0x8f, 0x87, 0x7e, 0x76, 0x72, 0x71,
-  0x73, 0x77, 0x7a, 0x7c, 0x7e, 0x81, 0x83, 0x84, 0x85, 0x86, 0x88, 0x88,
-  0x87, 0x84, 0x80, 0x7c, 0x7a, 0x7c, 0x7f, 0x82, 0x83, 0x83, 0x81, 0x7c,
-  0x76, 0x72, 0x71, 0x72, 0x75, 0x79, 0x7d, 0x7e, 0x7b, 0x77, 0x74, 0x72,
-  0x73, 0x76, 0x7a, 0x7e, 0x80, 0x7e, 0x7b, 0x75, 0x6f, 0x6c, 0x6c, 0x6e,
-  0x6f, 0x70, 0x70, 0x6f, 0x6d, 0x6b, 0x6c, 0x6e, 0x72, 0x74, 0x76, 0x77,
-  0x74, 0x71, 0x6f, 0x70, 0x73, 0x78, 0x7c, 0x80, 0x81, 0x7f, 0x79, 0x73,
-  0x6c, 0x67, 0x65, 0x69, 0x6f, 0x75, 0x7b, 0x80, 0x83, 0x84, 0x86, 0x87,
-  0x8a, 0x8b, 0x8c, 0x8c, 0x8a, 0x86, 0x81, 0x7e, 0x7d, 0x7d, 0x7e, 0x82,
-  0x86, 0x88, 0x88, 0x88, 0x88, 0x89, 0x8c, 0x91, 0x97, 0x9c, 0x9e, 0x9e,
-  0x9b, 0x96, 0x91, 0x8d, 0x8a, 0x89, 0x89, 0x89, 0x8a, 0x89, 0x86, 0x83,
-  0x82, 0x83, 0x86, 0x8b, 0x91, 0x97, 0x9b, 0x9c, 0x9b, 0x99, 0x95, 0x92,
-  0x8f, 0x8c, 0x88, 0x84, 0x7f, 0x7b, 0x78, 0x76, 0x79, 0x7f, 0x87, 0x8e,
-  0x92, 0x93, 0x91, 0x8c, 0x88, 0x85, 0x85, 0x87, 0x89, 0x8c, 0x8c, 0x8a,
-  0x87, 0x83, 0x7f, 0x7d, 0x7c, 0x7e, 0x80, 0x82, 0x82, 0x83, 0x83, 0x85,
-  0x87, 0x8a, 0x8d, 0x90, 0x90, 0x8e, 0x8b, 0x86, 0x81, 0x7d, 0x7c, 0x7c,
-  0x7e, 0x80, 0x82, 0x81, 0x7f, 0x7b, 0x79, 0x78, 0x7a, 0x7d, 0x81, 0x83,
-  0x84, 0x81, 0x7d, 0x78, 0x74, 0x71, 0x71, 0x73, 0x74, 0x76, 0x77, 0x76,
-  0x73, 0x70, 0x6e, 0x6d, 0x6d, 0x6c, 0x6a, 0x68, 0x66, 0x65, 0x66, 0x68,
-  0x6c, 0x71, 0x77, 0x7a, 0x7b, 0x79, 0x75, 0x70, 0x6c, 0x68, 0x67, 0x6a,
-  0x6d, 0x70, 0x72, 0x73, 0x73, 0x70, 0x6e, 0x6e, 0x6f, 0x73, 0x77, 0x7c,
-  0x7f, 0x81, 0x83, 0x84, 0x85, 0x85, 0x86, 0x88, 0x88, 0x86, 0x81, 0x7d,
-  0x79, 0x78, 0x78, 0x7c, 0x80, 0x84, 0x87, 0x89, 0x8a, 0x8a, 0x8b, 0x8c,
-  0x90, 0x94, 0x96, 0x97, 0x95, 0x8f, 0x87, 0x7f, 0x78, 0x74, 0x73, 0x76,
-  0x7a, 0x80, 0x85, 0x87, 0x87, 0x86, 0x85, 0x85, 0x86, 0x87, 0x88, 0x87,
-  0x86, 0x84, 0x80, 0x7c, 0x7b, 0x7b, 0x7c, 0x7c, 0x7b, 0x78, 0x73, 0x6e,
-  0x6c, 0x6f, 0x75, 0x7e, 0x86, 0x8e, 0x91, 0x91, 0x8d, 0x87, 0x82, 0x7f,
-  0x7e, 0x7f, 0x81, 0x82, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7e, 0x83, 0x88,
-  0x8d, 0x90, 0x91, 0x91, 0x90, 0x8f, 0x90, 0x91, 0x92, 0x92, 0x91, 0x8f,
-  0x8c, 0x88, 0x86, 0x86, 0x89, 0x8d, 0x91, 0x94, 0x93, 0x8f, 0x89, 0x85,
-  0x82, 0x82, 0x85, 0x8a, 0x90, 0x93, 0x94, 0x92, 0x8c, 0x86, 0x82, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x82, 0x83,
-  0x82, 0x7f, 0x7b, 0x79, 0x77, 0x77, 0x7a, 0x7f, 0x84, 0x86, 0x86, 0x84,
-  0x80, 0x7a, 0x75, 0x73, 0x74, 0x77, 0x7a, 0x7c, 0x7d, 0x7d, 0x7b, 0x7a,
-  0x7a, 0x7d, 0x82, 0x88, 0x8d, 0x90, 0x8e, 0x8b, 0x86, 0x82, 0x7f, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7a, 0x78, 0x76, 0x76, 0x78, 0x7d, 0x82, 0x87, 0x89,
-  0x89, 0x86, 0x82, 0x7e, 0x7b, 0x7a, 0x7c, 0x7d, 0x7e, 0x7e, 0x7a, 0x74,
-  0x6c, 0x66, 0x62, 0x60, 0x62, 0x66, 0x6b, 0x6f, 0x72, 0x73, 0x73, 0x72,
-  0x73, 0x74, 0x75, 0x73, 0x70, 0x6b, 0x65, 0x5f, 0x5b, 0x5a, 0x5c, 0x61,
-  0x65, 0x69, 0x6b, 0x6b, 0x6a, 0x6a, 0x6b, 0x6f, 0x74, 0x7a, 0x7e, 0x80,
-  0x7e, 0x7a, 0x76, 0x72, 0x70, 0x71, 0x74, 0x78, 0x7b, 0x7e, 0x7f, 0x80,
-  0x82, 0x83, 0x86, 0x89, 0x8d, 0x91, 0x94, 0x96, 0x96, 0x96, 0x96, 0x97,
-  0x97, 0x98, 0x98, 0x98, 0x96, 0x92, 0x8e, 0x8b, 0x8b, 0x8d, 0x92, 0x99,
-  0x9f, 0xa2, 0xa2, 0xa0, 0x9b, 0x96, 0x93, 0x92, 0x92, 0x94, 0x96, 0x98,
-  0x98, 0x96, 0x93, 0x90, 0x8f, 0x8e, 0x8e, 0x8e, 0x8d, 0x8b, 0x88, 0x86,
-  0x84, 0x84, 0x86, 0x8a, 0x8d, 0x8f, 0x8f, 0x8e, 0x8b, 0x88, 0x85, 0x85,
-  0x86, 0x89, 0x8b, 0x8c, 0x8a, 0x86, 0x81, 0x7c, 0x7a, 0x7b, 0x7e, 0x84,
-  0x89, 0x8b, 0x8b, 0x89, 0x87, 0x85, 0x85, 0x85, 0x88, 0x8b, 0x8b, 0x8a,
-  0x87, 0x84, 0x80, 0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7a, 0x77, 0x75, 0x74,
-  0x76, 0x7b, 0x80, 0x86, 0x8a, 0x8b, 0x88, 0x81, 0x78, 0x70, 0x6a, 0x66,
-  0x65, 0x66, 0x68, 0x69, 0x67, 0x65, 0x63, 0x61, 0x62, 0x64, 0x68, 0x6d,
-  0x70, 0x71, 0x71, 0x6e, 0x6b, 0x68, 0x68, 0x68, 0x67, 0x66, 0x63, 0x5f,
-  0x5b, 0x59, 0x59, 0x5c, 0x62, 0x68, 0x6e, 0x72, 0x73, 0x73, 0x72, 0x72,
-  0x74, 0x77, 0x7c, 0x80, 0x82, 0x81, 0x7e, 0x7a, 0x74, 0x70, 0x6f, 0x72,
-  0x77, 0x7d, 0x83, 0x88, 0x8c, 0x8e, 0x90, 0x92, 0x93, 0x94, 0x95, 0x95,
-  0x94, 0x90, 0x8c, 0x8a, 0x8a, 0x8c, 0x8f, 0x93, 0x95, 0x96, 0x94, 0x90,
-  0x8c, 0x89, 0x88, 0x8b, 0x8f, 0x94, 0x98, 0x98, 0x96, 0x91, 0x8d, 0x89,
-  0x87, 0x86, 0x87, 0x88, 0x88, 0x87, 0x84, 0x81, 0x7e, 0x7d, 0x7e, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x80, 0x7e, 0x7d, 0x7d, 0x7f, 0x82, 0x83, 0x82,
-  0x80, 0x7d, 0x79, 0x78, 0x79, 0x7b, 0x7e, 0x82, 0x83, 0x83, 0x7f, 0x7b,
-  0x76, 0x73, 0x74, 0x79, 0x80, 0x86, 0x8a, 0x8d, 0x8e, 0x8e, 0x8d, 0x8c,
-  0x8b, 0x8b, 0x8a, 0x89, 0x87, 0x85, 0x81, 0x80, 0x81, 0x84, 0x87, 0x8a,
-  0x8d, 0x8e, 0x8e, 0x8d, 0x8c, 0x8c, 0x8d, 0x8f, 0x92, 0x94, 0x94, 0x92,
-  0x8f, 0x89, 0x84, 0x7f, 0x7d, 0x7c, 0x7d, 0x7f, 0x81, 0x83, 0x82, 0x80,
-  0x80, 0x81, 0x84, 0x87, 0x89, 0x8b, 0x8b, 0x88, 0x84, 0x80, 0x7c, 0x78,
-  0x76, 0x75, 0x75, 0x73, 0x71, 0x71, 0x71, 0x73, 0x77, 0x7d, 0x82, 0x87,
-  0x89, 0x89, 0x86, 0x82, 0x7d, 0x79, 0x78, 0x78, 0x79, 0x7b, 0x7c, 0x7b,
-  0x79, 0x77, 0x75, 0x74, 0x74, 0x76, 0x7a, 0x7e, 0x81, 0x83, 0x84, 0x84,
-  0x83, 0x82, 0x83, 0x83, 0x82, 0x7f, 0x7c, 0x77, 0x72, 0x6e, 0x6d, 0x6f,
-  0x72, 0x75, 0x78, 0x79, 0x77, 0x74, 0x71, 0x70, 0x6f, 0x70, 0x71, 0x73,
-  0x73, 0x71, 0x6e, 0x69, 0x66, 0x63, 0x63, 0x64, 0x66, 0x68, 0x69, 0x69,
-  0x68, 0x66, 0x65, 0x65, 0x66, 0x67, 0x68, 0x69, 0x6a, 0x69, 0x69, 0x6a,
-  0x6c, 0x70, 0x73, 0x77, 0x79, 0x78, 0x75, 0x71, 0x6f, 0x6e, 0x70, 0x75,
-  0x7c, 0x82, 0x86, 0x88, 0x88, 0x87, 0x86, 0x86, 0x89, 0x8d, 0x92, 0x96,
-  0x98, 0x99, 0x99, 0x99, 0x9a, 0x9a, 0x9b, 0x9b, 0x9b, 0x9a, 0x98, 0x96,
-  0x95, 0x96, 0x99, 0x9d, 0xa3, 0xa8, 0xab, 0xac, 0xab, 0xa8, 0xa5, 0xa3,
-  0xa2, 0xa2, 0xa2, 0xa2, 0xa0, 0x9c, 0x97, 0x91, 0x8c, 0x8b, 0x8b, 0x8e,
-  0x92, 0x97, 0x99, 0x99, 0x97, 0x95, 0x93, 0x92, 0x91, 0x91, 0x90, 0x8d,
-  0x89, 0x85, 0x82, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7d, 0x7b,
-  0x7b, 0x7c, 0x80, 0x85, 0x8a, 0x8c, 0x8c, 0x88, 0x82, 0x7c, 0x76, 0x72,
-  0x70, 0x71, 0x73, 0x76, 0x77, 0x78, 0x78, 0x78, 0x79, 0x7b, 0x7e, 0x81,
-  0x83, 0x83, 0x81, 0x7d, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x76, 0x75, 0x73,
-  0x6f, 0x6b, 0x6a, 0x6a, 0x6c, 0x6f, 0x73, 0x76, 0x77, 0x74, 0x70, 0x6d,
-  0x6b, 0x6a, 0x6c, 0x6f, 0x71, 0x72, 0x71, 0x6e, 0x6b, 0x67, 0x63, 0x62,
-  0x62, 0x63, 0x66, 0x69, 0x6c, 0x6c, 0x6c, 0x6c, 0x6d, 0x6e, 0x70, 0x71,
-  0x71, 0x6f, 0x6e, 0x6d, 0x6c, 0x6e, 0x71, 0x75, 0x7a, 0x7e, 0x7f, 0x7e,
-  0x7a, 0x76, 0x74, 0x74, 0x76, 0x7b, 0x80, 0x85, 0x87, 0x88, 0x88, 0x88,
-  0x88, 0x89, 0x8b, 0x8d, 0x8f, 0x8f, 0x8d, 0x8b, 0x89, 0x88, 0x87, 0x88,
-  0x8a, 0x8c, 0x8d, 0x8e, 0x8e, 0x8d, 0x8d, 0x8e, 0x90, 0x92, 0x94, 0x95,
-  0x95, 0x92, 0x8e, 0x88, 0x84, 0x81, 0x80, 0x81, 0x83, 0x84, 0x83, 0x80,
-  0x7c, 0x78, 0x77, 0x78, 0x7b, 0x7f, 0x83, 0x87, 0x88, 0x88, 0x85, 0x82,
-  0x7f, 0x7d, 0x7c, 0x7a, 0x78, 0x75, 0x72, 0x6f, 0x6e, 0x6f, 0x72, 0x77,
-  0x7c, 0x81, 0x84, 0x84, 0x84, 0x83, 0x82, 0x81, 0x82, 0x85, 0x88, 0x89,
-  0x8a, 0x88, 0x85, 0x81, 0x7f, 0x7f, 0x82, 0x87, 0x8c, 0x90, 0x92, 0x93,
-  0x93, 0x92, 0x93, 0x94, 0x97, 0x9a, 0x9b, 0x9b, 0x98, 0x94, 0x90, 0x8e,
-  0x8d, 0x8e, 0x8f, 0x91, 0x91, 0x91, 0x8f, 0x8d, 0x8c, 0x8e, 0x92, 0x96,
-  0x99, 0x9a, 0x99, 0x95, 0x8e, 0x88, 0x83, 0x81, 0x80, 0x81, 0x83, 0x84,
-  0x84, 0x81, 0x7e, 0x7b, 0x79, 0x78, 0x79, 0x7a, 0x7b, 0x7b, 0x7a, 0x79,
-  0x77, 0x76, 0x78, 0x7a, 0x7d, 0x7e, 0x7d, 0x79, 0x74, 0x6f, 0x6c, 0x6b,
-  0x6d, 0x70, 0x73, 0x76, 0x76, 0x74, 0x70, 0x6e, 0x6c, 0x6d, 0x70, 0x74,
-  0x77, 0x79, 0x79, 0x79, 0x77, 0x75, 0x74, 0x74, 0x75, 0x76, 0x76, 0x76,
-  0x73, 0x70, 0x6e, 0x6e, 0x6f, 0x70, 0x71, 0x73, 0x74, 0x74, 0x73, 0x72,
-  0x72, 0x73, 0x75, 0x77, 0x78, 0x78, 0x75, 0x70, 0x6b, 0x65, 0x62, 0x61,
-  0x64, 0x68, 0x6c, 0x6f, 0x72, 0x72, 0x71, 0x70, 0x70, 0x72, 0x73, 0x74,
-  0x76, 0x76, 0x75, 0x73, 0x70, 0x6f, 0x6e, 0x6f, 0x70, 0x71, 0x71, 0x70,
-  0x70, 0x72, 0x74, 0x79, 0x7f, 0x86, 0x8c, 0x90, 0x92, 0x92, 0x90, 0x8d,
-  0x8a, 0x8a, 0x8c, 0x8e, 0x90, 0x91, 0x91, 0x8f, 0x8e, 0x8e, 0x8f, 0x92,
-  0x97, 0x9d, 0xa2, 0xa6, 0xa7, 0xa8, 0xa7, 0xa6, 0xa6, 0xa6, 0xa7, 0xa7,
-  0xa5, 0xa2, 0x9f, 0x9d, 0x9d, 0x9f, 0xa1, 0xa3, 0xa4, 0xa4, 0xa2, 0x9f,
-  0x9c, 0x99, 0x98, 0x99, 0x9b, 0x9d, 0x9f, 0x9e, 0x9b, 0x96, 0x90, 0x8b,
-  0x87, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x85, 0x83, 0x82, 0x81, 0x81,
-  0x81, 0x80, 0x7f, 0x7d, 0x7a, 0x76, 0x73, 0x73, 0x74, 0x76, 0x77, 0x76,
-  0x73, 0x6f, 0x6c, 0x6a, 0x69, 0x69, 0x6b, 0x6f, 0x72, 0x74, 0x73, 0x71,
-  0x6e, 0x6d, 0x6e, 0x71, 0x75, 0x78, 0x7a, 0x7b, 0x79, 0x77, 0x74, 0x71,
-  0x6f, 0x6d, 0x6e, 0x6f, 0x70, 0x70, 0x70, 0x70, 0x71, 0x73, 0x76, 0x79,
-  0x7d, 0x7f, 0x7f, 0x7c, 0x79, 0x77, 0x76, 0x77, 0x79, 0x7c, 0x7d, 0x7c,
-  0x79, 0x75, 0x70, 0x6b, 0x69, 0x6a, 0x6d, 0x73, 0x77, 0x7a, 0x7b, 0x7a,
-  0x79, 0x78, 0x78, 0x79, 0x79, 0x79, 0x77, 0x75, 0x73, 0x70, 0x6d, 0x6c,
-  0x6e, 0x71, 0x75, 0x78, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7e, 0x81, 0x85,
-  0x87, 0x87, 0x85, 0x81, 0x7d, 0x79, 0x77, 0x77, 0x7b, 0x7f, 0x83, 0x85,
-  0x85, 0x85, 0x84, 0x84, 0x86, 0x89, 0x8e, 0x92, 0x94, 0x94, 0x92, 0x90,
-  0x8e, 0x8d, 0x8c, 0x8b, 0x8b, 0x89, 0x87, 0x84, 0x81, 0x7f, 0x80, 0x82,
-  0x87, 0x8c, 0x8f, 0x90, 0x8f, 0x8c, 0x88, 0x84, 0x82, 0x82, 0x84, 0x85,
-  0x86, 0x87, 0x85, 0x82, 0x7e, 0x7c, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x80,
-  0x7e, 0x7c, 0x7b, 0x7b, 0x7d, 0x80, 0x82, 0x83, 0x83, 0x82, 0x81, 0x7f,
-  0x7f, 0x81, 0x84, 0x87, 0x89, 0x89, 0x87, 0x85, 0x83, 0x83, 0x84, 0x88,
-  0x8c, 0x90, 0x94, 0x95, 0x94, 0x92, 0x90, 0x8f, 0x8f, 0x90, 0x93, 0x95,
-  0x96, 0x96, 0x96, 0x94, 0x93, 0x92, 0x92, 0x93, 0x93, 0x92, 0x91, 0x91,
-  0x91, 0x92, 0x94, 0x97, 0x9a, 0x9c, 0x9d, 0x9b, 0x97, 0x91, 0x8a, 0x84,
-  0x81, 0x80, 0x80, 0x81, 0x81, 0x7f, 0x7d, 0x7a, 0x78, 0x76, 0x76, 0x78,
-  0x7b, 0x7d, 0x7d, 0x7d, 0x7b, 0x77, 0x74, 0x71, 0x70, 0x6d, 0x6b, 0x68,
-  0x66, 0x63, 0x61, 0x5f, 0x5e, 0x60, 0x62, 0x65, 0x67, 0x68, 0x68, 0x67,
-  0x66, 0x65, 0x65, 0x67, 0x6a, 0x6c, 0x6c, 0x6a, 0x66, 0x62, 0x5d, 0x5b,
-  0x5b, 0x5e, 0x63, 0x68, 0x6d, 0x71, 0x72, 0x72, 0x72, 0x72, 0x72, 0x73,
-  0x74, 0x74, 0x73, 0x70, 0x6f, 0x6e, 0x6f, 0x70, 0x72, 0x74, 0x76, 0x77,
-  0x76, 0x76, 0x75, 0x75, 0x78, 0x7c, 0x80, 0x84, 0x86, 0x87, 0x85, 0x82,
-  0x7f, 0x7d, 0x7c, 0x7d, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x7f, 0x7e, 0x7e,
-  0x80, 0x83, 0x87, 0x8b, 0x8d, 0x8e, 0x8e, 0x8d, 0x8c, 0x8e, 0x90, 0x92,
-  0x93, 0x93, 0x93, 0x92, 0x91, 0x90, 0x92, 0x95, 0x98, 0x9a, 0x9b, 0x9a,
-  0x97, 0x94, 0x92, 0x92, 0x94, 0x98, 0x9d, 0xa2, 0xa5, 0xa6, 0xa5, 0xa2,
-  0x9f, 0x9c, 0x9b, 0x9b, 0x9c, 0x9c, 0x9c, 0x9b, 0x99, 0x97, 0x96, 0x95,
-  0x96, 0x97, 0x98, 0x98, 0x97, 0x94, 0x92, 0x90, 0x90, 0x90, 0x91, 0x91,
-  0x8f, 0x8c, 0x87, 0x82, 0x7d, 0x79, 0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7d,
-  0x7b, 0x78, 0x77, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x79, 0x76, 0x71, 0x6c,
-  0x68, 0x65, 0x63, 0x63, 0x63, 0x63, 0x64, 0x65, 0x66, 0x67, 0x6a, 0x6e,
-  0x72, 0x76, 0x78, 0x77, 0x75, 0x72, 0x6e, 0x6c, 0x6c, 0x6d, 0x6f, 0x72,
-  0x73, 0x72, 0x70, 0x6d, 0x6b, 0x6c, 0x6f, 0x73, 0x78, 0x7c, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7e, 0x7c, 0x79, 0x77, 0x76,
-  0x77, 0x7a, 0x7c, 0x7f, 0x81, 0x82, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x80, 0x81, 0x81, 0x7e, 0x7a, 0x77, 0x74, 0x73, 0x74, 0x76, 0x79, 0x7b,
-  0x7c, 0x7c, 0x7a, 0x78, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7d, 0x7c,
-  0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7c, 0x7b, 0x78, 0x77, 0x77, 0x77,
-  0x7a, 0x7d, 0x81, 0x84, 0x86, 0x86, 0x85, 0x84, 0x82, 0x82, 0x84, 0x87,
-  0x8a, 0x8c, 0x8d, 0x8d, 0x8c, 0x8a, 0x89, 0x87, 0x86, 0x86, 0x87, 0x87,
-  0x87, 0x86, 0x86, 0x86, 0x88, 0x8a, 0x8e, 0x91, 0x93, 0x93, 0x91, 0x8f,
-  0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8a, 0x86, 0x82, 0x80, 0x80,
-  0x82, 0x85, 0x89, 0x8d, 0x8f, 0x8e, 0x8d, 0x8c, 0x8a, 0x89, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x85, 0x83, 0x83, 0x83, 0x84, 0x85, 0x87, 0x88,
-  0x89, 0x89, 0x8a, 0x8c, 0x90, 0x94, 0x96, 0x97, 0x96, 0x92, 0x8c, 0x88,
-  0x84, 0x81, 0x80, 0x82, 0x85, 0x88, 0x8a, 0x8a, 0x8a, 0x89, 0x8a, 0x8b,
-  0x8d, 0x90, 0x91, 0x90, 0x8f, 0x8e, 0x8b, 0x88, 0x85, 0x83, 0x81, 0x80,
-  0x7e, 0x7c, 0x79, 0x76, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x79, 0x77,
-  0x74, 0x71, 0x6f, 0x6d, 0x6d, 0x6e, 0x6f, 0x6e, 0x6c, 0x69, 0x64, 0x5f,
-  0x5c, 0x5b, 0x5c, 0x5f, 0x62, 0x65, 0x66, 0x65, 0x63, 0x62, 0x61, 0x60,
-  0x60, 0x60, 0x61, 0x61, 0x60, 0x60, 0x60, 0x60, 0x62, 0x66, 0x69, 0x6b,
-  0x6b, 0x69, 0x68, 0x67, 0x68, 0x6a, 0x6d, 0x72, 0x76, 0x7b, 0x7d, 0x7d,
-  0x7b, 0x7a, 0x79, 0x7a, 0x7c, 0x80, 0x83, 0x85, 0x85, 0x84, 0x83, 0x82,
-  0x81, 0x83, 0x86, 0x8a, 0x8d, 0x8f, 0x8f, 0x90, 0x90, 0x91, 0x94, 0x96,
-  0x98, 0x99, 0x99, 0x97, 0x94, 0x91, 0x8f, 0x8f, 0x90, 0x91, 0x92, 0x91,
-  0x8f, 0x8d, 0x8a, 0x89, 0x89, 0x8b, 0x8e, 0x93, 0x98, 0x9a, 0x9b, 0x99,
-  0x96, 0x92, 0x8f, 0x8e, 0x8d, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x88,
-  0x89, 0x8c, 0x8f, 0x92, 0x93, 0x92, 0x91, 0x90, 0x8f, 0x8f, 0x90, 0x92,
-  0x93, 0x93, 0x91, 0x8d, 0x8a, 0x86, 0x84, 0x85, 0x87, 0x8a, 0x8d, 0x90,
-  0x91, 0x90, 0x8f, 0x8e, 0x8e, 0x8e, 0x8f, 0x90, 0x8f, 0x8d, 0x89, 0x85,
-  0x81, 0x7e, 0x7c, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x7a,
-  0x7c, 0x7e, 0x7f, 0x7e, 0x7c, 0x78, 0x74, 0x6f, 0x6c, 0x6b, 0x6b, 0x6c,
-  0x6c, 0x6d, 0x6b, 0x69, 0x65, 0x63, 0x62, 0x63, 0x65, 0x67, 0x6a, 0x6b,
-  0x6b, 0x6b, 0x6b, 0x6b, 0x6c, 0x6d, 0x6e, 0x6e, 0x6e, 0x6d, 0x6c, 0x6b,
-  0x6b, 0x6c, 0x6f, 0x72, 0x76, 0x78, 0x79, 0x78, 0x77, 0x77, 0x77, 0x78,
-  0x7a, 0x7d, 0x80, 0x82, 0x83, 0x82, 0x81, 0x80, 0x80, 0x81, 0x83, 0x85,
-  0x86, 0x87, 0x86, 0x85, 0x83, 0x83, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89,
-  0x88, 0x87, 0x87, 0x87, 0x86, 0x86, 0x85, 0x84, 0x81, 0x7d, 0x79, 0x76,
-  0x75, 0x75, 0x77, 0x79, 0x7c, 0x7e, 0x7e, 0x7d, 0x7b, 0x79, 0x78, 0x78,
-  0x79, 0x7b, 0x7d, 0x7e, 0x7d, 0x7a, 0x77, 0x74, 0x72, 0x71, 0x71, 0x72,
-  0x73, 0x73, 0x74, 0x75, 0x76, 0x79, 0x7d, 0x82, 0x87, 0x8a, 0x8a, 0x8a,
-  0x87, 0x85, 0x83, 0x83, 0x85, 0x87, 0x89, 0x8a, 0x89, 0x87, 0x86, 0x85,
-  0x87, 0x8a, 0x8f, 0x94, 0x98, 0x9b, 0x9b, 0x9a, 0x98, 0x96, 0x95, 0x95,
-  0x96, 0x96, 0x96, 0x95, 0x94, 0x93, 0x92, 0x92, 0x93, 0x94, 0x95, 0x96,
-  0x96, 0x95, 0x93, 0x92, 0x92, 0x93, 0x95, 0x96, 0x97, 0x96, 0x92, 0x8c,
-  0x86, 0x82, 0x7f, 0x7f, 0x80, 0x83, 0x85, 0x87, 0x87, 0x86, 0x85, 0x83,
-  0x83, 0x83, 0x84, 0x85, 0x85, 0x84, 0x82, 0x80, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x77, 0x77, 0x79, 0x7b, 0x7d, 0x7e,
-  0x7e, 0x7c, 0x7b, 0x79, 0x79, 0x7b, 0x7d, 0x80, 0x82, 0x81, 0x7e, 0x7a,
-  0x76, 0x73, 0x71, 0x71, 0x73, 0x76, 0x78, 0x78, 0x77, 0x75, 0x74, 0x72,
-  0x72, 0x72, 0x74, 0x74, 0x73, 0x72, 0x70, 0x6f, 0x6e, 0x6f, 0x6f, 0x70,
-  0x6f, 0x6d, 0x6b, 0x67, 0x63, 0x61, 0x61, 0x63, 0x66, 0x6a, 0x6c, 0x6e,
-  0x6d, 0x6c, 0x6a, 0x68, 0x67, 0x67, 0x68, 0x69, 0x6a, 0x69, 0x68, 0x66,
-  0x64, 0x64, 0x66, 0x69, 0x6c, 0x70, 0x73, 0x75, 0x77, 0x78, 0x79, 0x7c,
-  0x7f, 0x82, 0x83, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x83, 0x87,
-  0x89, 0x8b, 0x8c, 0x8c, 0x8d, 0x8f, 0x92, 0x96, 0x9b, 0x9f, 0xa2, 0xa3,
-  0xa2, 0xa1, 0x9e, 0x9c, 0x9a, 0x99, 0x99, 0x99, 0x98, 0x98, 0x98, 0x98,
-  0x99, 0x9a, 0x9c, 0x9e, 0xa0, 0xa1, 0xa0, 0x9e, 0x9b, 0x98, 0x96, 0x96,
-  0x97, 0x97, 0x96, 0x95, 0x93, 0x90, 0x8d, 0x8b, 0x8a, 0x89, 0x8a, 0x8c,
-  0x8c, 0x8c, 0x8b, 0x89, 0x87, 0x86, 0x85, 0x85, 0x86, 0x86, 0x85, 0x84,
-  0x82, 0x7f, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x80, 0x82, 0x84, 0x83, 0x81, 0x7e, 0x7c, 0x7a, 0x7a, 0x7b,
-  0x7d, 0x7f, 0x80, 0x80, 0x7f, 0x7c, 0x79, 0x76, 0x75, 0x76, 0x78, 0x7a,
-  0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7b, 0x77,
-  0x73, 0x70, 0x6f, 0x6e, 0x6f, 0x70, 0x71, 0x71, 0x6f, 0x6d, 0x6c, 0x6a,
-  0x6b, 0x6d, 0x6f, 0x72, 0x74, 0x74, 0x73, 0x71, 0x6e, 0x6d, 0x6c, 0x6b,
-  0x6c, 0x6c, 0x6d, 0x6c, 0x6b, 0x69, 0x68, 0x69, 0x6c, 0x6f, 0x72, 0x74,
-  0x76, 0x76, 0x77, 0x78, 0x78, 0x7a, 0x7b, 0x7c, 0x7c, 0x7b, 0x78, 0x76,
-  0x74, 0x74, 0x76, 0x7a, 0x7f, 0x84, 0x88, 0x8b, 0x8b, 0x8b, 0x8a, 0x89,
-  0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8c, 0x8b, 0x89, 0x88, 0x87, 0x87, 0x88,
-  0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x8b, 0x8d, 0x90, 0x92, 0x93, 0x93,
-  0x90, 0x8d, 0x89, 0x86, 0x84, 0x84, 0x85, 0x85, 0x85, 0x83, 0x81, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x81, 0x83, 0x85, 0x86, 0x86, 0x84, 0x82, 0x80, 0x7f,
-  0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x81, 0x82, 0x84, 0x84,
-  0x84, 0x84, 0x83, 0x82, 0x81, 0x82, 0x84, 0x88, 0x8c, 0x8f, 0x91, 0x91,
-  0x8f, 0x8c, 0x89, 0x88, 0x89, 0x8b, 0x8e, 0x90, 0x91, 0x90, 0x90, 0x8f,
-  0x8e, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x92, 0x91, 0x90, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8f, 0x8e, 0x8c, 0x89, 0x86, 0x83, 0x82, 0x81, 0x81, 0x82, 0x82,
-  0x83, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x7d,
-  0x78, 0x73, 0x6f, 0x6c, 0x6b, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x70,
-  0x70, 0x72, 0x73, 0x75, 0x75, 0x75, 0x74, 0x72, 0x71, 0x70, 0x70, 0x71,
-  0x72, 0x72, 0x71, 0x70, 0x6e, 0x6d, 0x6c, 0x6c, 0x6e, 0x71, 0x75, 0x78,
-  0x7b, 0x7c, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x78, 0x78, 0x78, 0x77, 0x75,
-  0x73, 0x72, 0x72, 0x73, 0x74, 0x77, 0x79, 0x7b, 0x7b, 0x7b, 0x7a, 0x79,
-  0x78, 0x78, 0x78, 0x78, 0x78, 0x76, 0x74, 0x71, 0x70, 0x70, 0x71, 0x72,
-  0x74, 0x76, 0x77, 0x77, 0x76, 0x74, 0x74, 0x74, 0x75, 0x78, 0x7b, 0x7d,
-  0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81,
-  0x81, 0x82, 0x84, 0x87, 0x8b, 0x8e, 0x91, 0x92, 0x91, 0x90, 0x90, 0x90,
-  0x92, 0x95, 0x98, 0x9b, 0x9c, 0x9c, 0x9b, 0x99, 0x98, 0x97, 0x97, 0x99,
-  0x9a, 0x9b, 0x9b, 0x9a, 0x9a, 0x99, 0x99, 0x9b, 0x9d, 0x9f, 0xa1, 0xa1,
-  0x9f, 0x9d, 0x9b, 0x99, 0x97, 0x95, 0x94, 0x93, 0x92, 0x90, 0x8d, 0x8a,
-  0x88, 0x87, 0x88, 0x89, 0x8b, 0x8c, 0x8b, 0x8a, 0x87, 0x83, 0x80, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7e, 0x7d, 0x7a, 0x77, 0x74, 0x72, 0x71, 0x71, 0x72,
-  0x73, 0x75, 0x75, 0x76, 0x76, 0x76, 0x78, 0x7a, 0x7b, 0x7b, 0x79, 0x76,
-  0x73, 0x70, 0x6d, 0x6b, 0x6c, 0x6e, 0x71, 0x73, 0x75, 0x75, 0x75, 0x75,
-  0x76, 0x77, 0x79, 0x7c, 0x7e, 0x7f, 0x7f, 0x7e, 0x7b, 0x79, 0x76, 0x75,
-  0x75, 0x76, 0x77, 0x77, 0x76, 0x75, 0x74, 0x74, 0x75, 0x76, 0x78, 0x7a,
-  0x7b, 0x7a, 0x79, 0x78, 0x77, 0x78, 0x79, 0x7a, 0x7a, 0x79, 0x77, 0x74,
-  0x71, 0x6e, 0x6d, 0x6d, 0x6f, 0x72, 0x76, 0x78, 0x79, 0x78, 0x77, 0x76,
-  0x74, 0x74, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x77, 0x77, 0x78, 0x79,
-  0x7b, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7f, 0x82, 0x86, 0x88,
-  0x89, 0x89, 0x87, 0x86, 0x86, 0x86, 0x88, 0x8a, 0x8b, 0x8c, 0x8b, 0x8a,
-  0x89, 0x87, 0x87, 0x88, 0x8a, 0x8c, 0x8e, 0x8f, 0x90, 0x90, 0x8f, 0x8e,
-  0x8e, 0x8d, 0x8d, 0x8e, 0x8e, 0x8d, 0x8c, 0x8a, 0x88, 0x87, 0x85, 0x85,
-  0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7e, 0x80, 0x82, 0x85, 0x88, 0x89,
-  0x89, 0x87, 0x84, 0x80, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7b,
-  0x7a, 0x7a, 0x7b, 0x7d, 0x7f, 0x81, 0x83, 0x85, 0x86, 0x86, 0x86, 0x86,
-  0x86, 0x87, 0x88, 0x88, 0x88, 0x87, 0x86, 0x85, 0x84, 0x85, 0x87, 0x8a,
-  0x8d, 0x8f, 0x90, 0x91, 0x91, 0x90, 0x90, 0x91, 0x92, 0x94, 0x95, 0x95,
-  0x93, 0x8f, 0x8c, 0x88, 0x86, 0x85, 0x86, 0x87, 0x89, 0x8a, 0x8a, 0x8b,
-  0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x87, 0x84, 0x81, 0x7d, 0x7b, 0x79,
-  0x79, 0x79, 0x79, 0x78, 0x77, 0x75, 0x72, 0x6f, 0x6e, 0x6d, 0x6e, 0x6f,
-  0x71, 0x72, 0x72, 0x71, 0x6f, 0x6e, 0x6c, 0x6b, 0x6c, 0x6c, 0x6c, 0x6c,
-  0x6a, 0x68, 0x67, 0x66, 0x68, 0x6a, 0x6c, 0x6d, 0x6e, 0x6f, 0x6e, 0x6d,
-  0x6d, 0x6d, 0x6f, 0x72, 0x74, 0x75, 0x75, 0x75, 0x74, 0x73, 0x74, 0x75,
-  0x77, 0x7a, 0x7b, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x76, 0x78, 0x7a, 0x7d,
-  0x7f, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7d,
-  0x7b, 0x79, 0x79, 0x7a, 0x7c, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x80, 0x7f,
-  0x7f, 0x80, 0x82, 0x85, 0x86, 0x86, 0x85, 0x82, 0x80, 0x7e, 0x7d, 0x7d,
-  0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x83, 0x85, 0x89, 0x8c, 0x8f, 0x91,
-  0x92, 0x93, 0x92, 0x90, 0x8f, 0x8e, 0x8f, 0x8f, 0x8f, 0x8f, 0x8e, 0x8d,
-  0x8c, 0x8d, 0x8e, 0x91, 0x95, 0x99, 0x9d, 0x9f, 0x9e, 0x9c, 0x99, 0x97,
-  0x95, 0x95, 0x96, 0x96, 0x96, 0x95, 0x94, 0x92, 0x91, 0x8f, 0x8e, 0x8f,
-  0x8f, 0x8f, 0x8f, 0x8e, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x88,
-  0x85, 0x81, 0x7c, 0x79, 0x77, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x79, 0x78,
-  0x76, 0x75, 0x74, 0x74, 0x74, 0x75, 0x76, 0x75, 0x73, 0x71, 0x6e, 0x6c,
-  0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x70, 0x6f, 0x6f, 0x6f, 0x70, 0x72,
-  0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x77, 0x79, 0x7c, 0x7e, 0x80, 0x80,
-  0x7e, 0x7c, 0x7a, 0x79, 0x78, 0x79, 0x7c, 0x7f, 0x81, 0x82, 0x82, 0x82,
-  0x81, 0x7f, 0x7f, 0x80, 0x82, 0x83, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x7f, 0x7c, 0x7a, 0x78, 0x77, 0x78, 0x79, 0x7b,
-  0x7d, 0x7f, 0x7e, 0x7d, 0x7b, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x77,
-  0x75, 0x72, 0x6f, 0x6e, 0x6e, 0x70, 0x72, 0x76, 0x79, 0x7b, 0x7c, 0x7c,
-  0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x79,
-  0x7b, 0x7d, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x83, 0x87, 0x8b, 0x8f,
-  0x91, 0x92, 0x91, 0x8e, 0x8a, 0x88, 0x86, 0x85, 0x86, 0x86, 0x87, 0x87,
-  0x87, 0x87, 0x87, 0x88, 0x89, 0x8c, 0x8e, 0x8f, 0x8e, 0x8d, 0x8b, 0x89,
-  0x87, 0x87, 0x86, 0x86, 0x86, 0x86, 0x84, 0x82, 0x80, 0x7f, 0x7f, 0x80,
-  0x81, 0x83, 0x84, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x84,
-  0x85, 0x84, 0x83, 0x80, 0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x84, 0x86, 0x87,
-  0x87, 0x87, 0x87, 0x89, 0x8b, 0x8d, 0x8d, 0x8d, 0x8c, 0x8a, 0x89, 0x88,
-  0x89, 0x8b, 0x8d, 0x90, 0x91, 0x91, 0x90, 0x8d, 0x8b, 0x89, 0x89, 0x89,
-  0x8b, 0x8c, 0x8d, 0x8d, 0x8d, 0x8c, 0x8b, 0x8b, 0x8b, 0x8c, 0x8c, 0x8b,
-  0x89, 0x85, 0x82, 0x7f, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x79, 0x78, 0x75,
-  0x73, 0x72, 0x73, 0x74, 0x75, 0x76, 0x76, 0x75, 0x73, 0x70, 0x6d, 0x6a,
-  0x69, 0x69, 0x69, 0x69, 0x69, 0x67, 0x65, 0x63, 0x62, 0x62, 0x63, 0x65,
-  0x67, 0x6a, 0x6d, 0x6e, 0x6f, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e,
-  0x6d, 0x6b, 0x6a, 0x6a, 0x6c, 0x6f, 0x73, 0x78, 0x7c, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x80, 0x82, 0x83, 0x84, 0x83, 0x82, 0x81, 0x7f, 0x7f,
-  0x80, 0x81, 0x83, 0x85, 0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8b, 0x8d,
-  0x8e, 0x8e, 0x8d, 0x8b, 0x89, 0x88, 0x87, 0x86, 0x86, 0x86, 0x86, 0x85,
-  0x84, 0x83, 0x82, 0x82, 0x84, 0x86, 0x89, 0x8c, 0x8d, 0x8d, 0x8b, 0x88,
-  0x85, 0x83, 0x82, 0x83, 0x85, 0x86, 0x88, 0x89, 0x88, 0x88, 0x87, 0x87,
-  0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x88, 0x89, 0x8a, 0x8c, 0x8e, 0x91,
-  0x91, 0x91, 0x90, 0x8f, 0x8d, 0x8b, 0x8b, 0x8c, 0x8e, 0x90, 0x91, 0x91,
-  0x90, 0x8e, 0x8b, 0x8a, 0x8a, 0x8c, 0x8d, 0x8f, 0x8f, 0x8e, 0x8c, 0x8b,
-  0x89, 0x88, 0x87, 0x87, 0x87, 0x87, 0x85, 0x83, 0x81, 0x7f, 0x7d, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7b,
-  0x7a, 0x77, 0x73, 0x6f, 0x6b, 0x69, 0x68, 0x69, 0x6b, 0x6d, 0x6e, 0x6f,
-  0x6f, 0x6f, 0x6f, 0x70, 0x71, 0x73, 0x75, 0x76, 0x77, 0x76, 0x75, 0x74,
-  0x73, 0x73, 0x74, 0x75, 0x75, 0x76, 0x75, 0x74, 0x74, 0x75, 0x77, 0x7b,
-  0x7f, 0x82, 0x84, 0x84, 0x84, 0x83, 0x82, 0x82, 0x83, 0x84, 0x85, 0x85,
-  0x84, 0x82, 0x7f, 0x7d, 0x7d, 0x7d, 0x80, 0x82, 0x85, 0x87, 0x88, 0x88,
-  0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7c, 0x7a, 0x7a,
-  0x7a, 0x7b, 0x7d, 0x7e, 0x7e, 0x7d, 0x7b, 0x79, 0x77, 0x77, 0x79, 0x7b,
-  0x7d, 0x7e, 0x7e, 0x7c, 0x7a, 0x78, 0x76, 0x75, 0x76, 0x77, 0x78, 0x79,
-  0x79, 0x79, 0x79, 0x79, 0x7b, 0x7d, 0x7f, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x82, 0x84, 0x86, 0x88, 0x88, 0x88, 0x88, 0x87, 0x86, 0x86,
-  0x87, 0x89, 0x8a, 0x8c, 0x8c, 0x8b, 0x89, 0x88, 0x88, 0x89, 0x8c, 0x8e,
-  0x90, 0x91, 0x91, 0x90, 0x8f, 0x8d, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x88,
-  0x87, 0x85, 0x84, 0x84, 0x85, 0x86, 0x87, 0x88, 0x88, 0x87, 0x86, 0x84,
-  0x82, 0x82, 0x82, 0x83, 0x84, 0x84, 0x83, 0x81, 0x7f, 0x7c, 0x7a, 0x7a,
-  0x7a, 0x7c, 0x7e, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x84, 0x84,
-  0x85, 0x84, 0x83, 0x80, 0x7e, 0x7c, 0x7c, 0x7d, 0x7f, 0x81, 0x82, 0x82,
-  0x82, 0x83, 0x84, 0x85, 0x87, 0x89, 0x8b, 0x8c, 0x8b, 0x8a, 0x87, 0x83,
-  0x81, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7d,
-  0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7a, 0x79, 0x78,
-  0x76, 0x73, 0x70, 0x6e, 0x6c, 0x6c, 0x6e, 0x70, 0x72, 0x73, 0x74, 0x73,
-  0x71, 0x6e, 0x6c, 0x6b, 0x6b, 0x6c, 0x6d, 0x6e, 0x6e, 0x6d, 0x6b, 0x6a,
-  0x6a, 0x6a, 0x6c, 0x6e, 0x6f, 0x71, 0x72, 0x72, 0x72, 0x71, 0x72, 0x74,
-  0x76, 0x78, 0x79, 0x7a, 0x7a, 0x7a, 0x79, 0x7a, 0x7c, 0x7e, 0x80, 0x82,
-  0x82, 0x82, 0x81, 0x80, 0x80, 0x82, 0x84, 0x88, 0x8c, 0x8e, 0x8f, 0x8e,
-  0x8c, 0x8a, 0x8a, 0x8a, 0x8d, 0x8f, 0x90, 0x91, 0x91, 0x90, 0x8f, 0x8e,
-  0x8d, 0x8c, 0x8c, 0x8d, 0x8c, 0x8c, 0x8b, 0x8a, 0x8a, 0x8c, 0x8d, 0x8f,
-  0x91, 0x92, 0x91, 0x8f, 0x8d, 0x8b, 0x89, 0x87, 0x87, 0x88, 0x88, 0x88,
-  0x87, 0x85, 0x83, 0x82, 0x81, 0x82, 0x85, 0x87, 0x8a, 0x8b, 0x8b, 0x8a,
-  0x88, 0x87, 0x86, 0x86, 0x87, 0x87, 0x87, 0x86, 0x85, 0x84, 0x83, 0x82,
-  0x84, 0x86, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x88, 0x89, 0x8b, 0x8c,
-  0x8c, 0x8b, 0x89, 0x86, 0x82, 0x7f, 0x7d, 0x7d, 0x7e, 0x80, 0x82, 0x83,
-  0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7c, 0x7a,
-  0x78, 0x76, 0x75, 0x74, 0x75, 0x75, 0x74, 0x72, 0x70, 0x6e, 0x6e, 0x6f,
-  0x71, 0x72, 0x73, 0x73, 0x73, 0x71, 0x70, 0x6e, 0x6d, 0x6e, 0x6e, 0x6f,
-  0x70, 0x70, 0x6f, 0x6d, 0x6c, 0x6b, 0x6c, 0x6e, 0x70, 0x72, 0x74, 0x76,
-  0x76, 0x76, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b,
-  0x7c, 0x7d, 0x80, 0x82, 0x84, 0x85, 0x84, 0x82, 0x81, 0x80, 0x80, 0x82,
-  0x84, 0x87, 0x89, 0x8a, 0x8b, 0x8a, 0x89, 0x87, 0x87, 0x87, 0x88, 0x88,
-  0x88, 0x87, 0x86, 0x85, 0x84, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86,
-  0x85, 0x84, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x83, 0x81, 0x7e, 0x7c,
-  0x7b, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b, 0x7c, 0x7e,
-  0x80, 0x83, 0x85, 0x85, 0x84, 0x82, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x85, 0x88, 0x8b, 0x8c, 0x8c, 0x8b,
-  0x89, 0x88, 0x87, 0x88, 0x89, 0x8a, 0x8b, 0x8b, 0x8b, 0x89, 0x88, 0x87,
-  0x86, 0x87, 0x89, 0x8b, 0x8d, 0x8e, 0x8e, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c,
-  0x8c, 0x8c, 0x8b, 0x88, 0x86, 0x83, 0x82, 0x81, 0x82, 0x83, 0x84, 0x85,
-  0x85, 0x84, 0x83, 0x82, 0x82, 0x83, 0x84, 0x85, 0x85, 0x83, 0x81, 0x7e,
-  0x7b, 0x79, 0x78, 0x79, 0x7a, 0x7c, 0x7e, 0x7e, 0x7e, 0x7c, 0x7b, 0x7a,
-  0x7a, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f,
-  0x80, 0x7f, 0x7e, 0x7c, 0x7a, 0x78, 0x78, 0x7a, 0x7c, 0x7f, 0x80, 0x81,
-  0x7f, 0x7d, 0x7b, 0x7a, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7c,
-  0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x78, 0x77, 0x75, 0x74, 0x73, 0x74,
-  0x74, 0x76, 0x77, 0x77, 0x77, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75,
-  0x75, 0x73, 0x71, 0x6e, 0x6c, 0x6b, 0x6c, 0x6e, 0x71, 0x74, 0x77, 0x78,
-  0x77, 0x77, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7b, 0x7b, 0x7b, 0x7a, 0x79,
-  0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x83, 0x85, 0x88,
-  0x8b, 0x8e, 0x90, 0x90, 0x8e, 0x8d, 0x8b, 0x89, 0x89, 0x89, 0x8a, 0x8c,
-  0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8d, 0x8f, 0x91, 0x94, 0x96, 0x96, 0x95,
-  0x94, 0x92, 0x90, 0x8e, 0x8d, 0x8d, 0x8e, 0x8d, 0x8c, 0x8b, 0x8a, 0x89,
-  0x89, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x89, 0x88, 0x86, 0x86, 0x86, 0x87,
-  0x88, 0x88, 0x88, 0x86, 0x84, 0x81, 0x7e, 0x7d, 0x7c, 0x7d, 0x7f, 0x82,
-  0x83, 0x84, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x80, 0x82, 0x82, 0x82, 0x81, 0x7f, 0x7d, 0x7c,
-  0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x80, 0x81, 0x80, 0x7f, 0x7d, 0x7b, 0x79, 0x77, 0x77, 0x77, 0x78, 0x79,
-  0x79, 0x78, 0x78, 0x77, 0x77, 0x77, 0x78, 0x79, 0x79, 0x79, 0x78, 0x77,
-  0x75, 0x73, 0x73, 0x73, 0x74, 0x75, 0x75, 0x74, 0x72, 0x70, 0x6f, 0x6e,
-  0x6f, 0x71, 0x74, 0x77, 0x7a, 0x7b, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x78,
-  0x78, 0x78, 0x77, 0x76, 0x76, 0x75, 0x76, 0x78, 0x7b, 0x7d, 0x80, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x85, 0x86, 0x86, 0x85, 0x83, 0x81,
-  0x7f, 0x7f, 0x7f, 0x81, 0x83, 0x85, 0x87, 0x87, 0x87, 0x86, 0x85, 0x85,
-  0x86, 0x88, 0x8a, 0x8b, 0x8a, 0x89, 0x86, 0x84, 0x83, 0x82, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x84, 0x86, 0x87, 0x87, 0x85,
-  0x83, 0x80, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x81, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x84,
-  0x85, 0x87, 0x87, 0x87, 0x87, 0x86, 0x85, 0x85, 0x85, 0x87, 0x89, 0x8a,
-  0x8b, 0x8a, 0x89, 0x88, 0x87, 0x88, 0x89, 0x8b, 0x8d, 0x8e, 0x8e, 0x8d,
-  0x8b, 0x89, 0x88, 0x88, 0x88, 0x89, 0x8a, 0x8b, 0x8a, 0x89, 0x88, 0x86,
-  0x84, 0x84, 0x83, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84,
-  0x85, 0x84, 0x83, 0x80, 0x7d, 0x7a, 0x78, 0x77, 0x77, 0x78, 0x79, 0x7a,
-  0x7a, 0x7a, 0x79, 0x78, 0x77, 0x78, 0x79, 0x7a, 0x7c, 0x7c, 0x7c, 0x7b,
-  0x79, 0x78, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76,
-  0x77, 0x79, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7b, 0x79, 0x77, 0x75, 0x75, 0x76, 0x78, 0x7b, 0x7e, 0x80,
-  0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a, 0x79, 0x78,
-  0x77, 0x76, 0x76, 0x77, 0x78, 0x78, 0x79, 0x79, 0x78, 0x77, 0x77, 0x78,
-  0x79, 0x7b, 0x7c, 0x7d, 0x7d, 0x7b, 0x7a, 0x78, 0x76, 0x76, 0x76, 0x78,
-  0x79, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7e, 0x80, 0x82, 0x84, 0x85,
-  0x85, 0x85, 0x84, 0x83, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x89, 0x89,
-  0x89, 0x8a, 0x8b, 0x8c, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8c, 0x8c, 0x8d,
-  0x8e, 0x91, 0x93, 0x94, 0x94, 0x92, 0x91, 0x8f, 0x8d, 0x8c, 0x8c, 0x8c,
-  0x8d, 0x8d, 0x8d, 0x8c, 0x8b, 0x8a, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8a,
-  0x89, 0x87, 0x86, 0x85, 0x85, 0x85, 0x86, 0x86, 0x85, 0x83, 0x80, 0x7d,
-  0x7c, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x80, 0x7f, 0x7e, 0x7b, 0x79, 0x77, 0x77, 0x77, 0x78, 0x79,
-  0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x80,
-  0x7e, 0x7b, 0x7a, 0x79, 0x7a, 0x7b, 0x7d, 0x7d, 0x7d, 0x7c, 0x7a, 0x79,
-  0x79, 0x7a, 0x7c, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a,
-  0x7a, 0x79, 0x78, 0x76, 0x74, 0x73, 0x73, 0x74, 0x76, 0x77, 0x79, 0x7a,
-  0x7b, 0x7a, 0x79, 0x77, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x76, 0x75,
-  0x74, 0x73, 0x73, 0x74, 0x76, 0x78, 0x7a, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a,
-  0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x82,
-  0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x83, 0x84, 0x87, 0x89, 0x8a, 0x8b,
-  0x8b, 0x89, 0x88, 0x86, 0x86, 0x86, 0x87, 0x89, 0x8a, 0x8b, 0x8a, 0x8a,
-  0x88, 0x87, 0x86, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84,
-  0x85, 0x86, 0x87, 0x87, 0x86, 0x85, 0x83, 0x81, 0x80, 0x7f, 0x7f, 0x7f,
-  0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x7b, 0x7c, 0x7f, 0x81, 0x83, 0x83,
-  0x83, 0x82, 0x81, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x83, 0x85, 0x86, 0x86, 0x87, 0x87, 0x88, 0x89,
-  0x8b, 0x8c, 0x8c, 0x8c, 0x8a, 0x87, 0x85, 0x82, 0x81, 0x81, 0x83, 0x86,
-  0x88, 0x89, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x89, 0x88,
-  0x86, 0x84, 0x82, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7d,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7c, 0x7a, 0x79, 0x78, 0x77,
-  0x77, 0x78, 0x78, 0x77, 0x76, 0x74, 0x72, 0x71, 0x72, 0x73, 0x76, 0x78,
-  0x7a, 0x7b, 0x7a, 0x79, 0x77, 0x76, 0x76, 0x76, 0x77, 0x77, 0x78, 0x78,
-  0x77, 0x77, 0x77, 0x78, 0x7a, 0x7c, 0x7d, 0x7d, 0x7d, 0x7b, 0x7a, 0x79,
-  0x79, 0x7a, 0x7c, 0x7e, 0x80, 0x81, 0x80, 0x7f, 0x7e, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x7c, 0x7d, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7c,
-  0x7b, 0x79, 0x79, 0x79, 0x7b, 0x7c, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b,
-  0x7d, 0x7f, 0x81, 0x84, 0x85, 0x86, 0x85, 0x84, 0x83, 0x81, 0x81, 0x80,
-  0x81, 0x82, 0x83, 0x83, 0x84, 0x85, 0x86, 0x88, 0x8a, 0x8d, 0x8f, 0x90,
-  0x90, 0x8f, 0x8d, 0x8c, 0x8c, 0x8c, 0x8e, 0x8f, 0x90, 0x8f, 0x8e, 0x8d,
-  0x8b, 0x8b, 0x8b, 0x8c, 0x8e, 0x90, 0x91, 0x91, 0x90, 0x90, 0x8f, 0x8e,
-  0x8e, 0x8e, 0x8e, 0x8d, 0x8b, 0x89, 0x87, 0x85, 0x83, 0x82, 0x82, 0x83,
-  0x83, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x7d, 0x7a, 0x78, 0x76, 0x75, 0x75, 0x77, 0x78, 0x79, 0x79, 0x79, 0x77,
-  0x76, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78,
-  0x78, 0x79, 0x79, 0x78, 0x78, 0x77, 0x76, 0x76, 0x77, 0x78, 0x7a, 0x7c,
-  0x7d, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f, 0x7f,
-  0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7b,
-  0x7a, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x75, 0x75, 0x76, 0x78, 0x7a, 0x7c,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x83,
-  0x84, 0x86, 0x88, 0x8b, 0x8c, 0x8c, 0x8b, 0x89, 0x87, 0x86, 0x85, 0x85,
-  0x86, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x87, 0x88, 0x8b, 0x8d, 0x8e,
-  0x8e, 0x8d, 0x8c, 0x89, 0x87, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x83,
-  0x83, 0x82, 0x82, 0x82, 0x82, 0x83, 0x84, 0x83, 0x83, 0x82, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x82, 0x81, 0x80, 0x7e, 0x7b, 0x79, 0x78, 0x79, 0x7a,
-  0x7c, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x80, 0x7f, 0x7e, 0x7e, 0x7f, 0x81, 0x83, 0x84, 0x84, 0x84, 0x84,
-  0x83, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x88, 0x87, 0x86, 0x85, 0x84,
-  0x85, 0x86, 0x88, 0x88, 0x88, 0x86, 0x84, 0x82, 0x81, 0x80, 0x80, 0x81,
-  0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7d, 0x7b, 0x7a, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x79, 0x78, 0x76, 0x74,
-  0x73, 0x72, 0x73, 0x74, 0x76, 0x78, 0x79, 0x79, 0x78, 0x77, 0x76, 0x75,
-  0x75, 0x75, 0x75, 0x75, 0x74, 0x74, 0x73, 0x72, 0x72, 0x74, 0x76, 0x78,
-  0x7a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7b, 0x7a, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x81, 0x82, 0x84, 0x85, 0x86, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x82, 0x83, 0x85, 0x87, 0x88,
-  0x88, 0x87, 0x85, 0x83, 0x81, 0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x83,
-  0x83, 0x82, 0x82, 0x82, 0x83, 0x85, 0x86, 0x88, 0x88, 0x88, 0x88, 0x87,
-  0x88, 0x88, 0x89, 0x89, 0x89, 0x8a, 0x89, 0x89, 0x88, 0x88, 0x88, 0x89,
-  0x8a, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8d, 0x8e, 0x8e, 0x8e,
-  0x8e, 0x8c, 0x8a, 0x88, 0x87, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x89,
-  0x87, 0x85, 0x83, 0x83, 0x82, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7d, 0x7b, 0x79, 0x77, 0x75, 0x74, 0x74, 0x75,
-  0x75, 0x76, 0x76, 0x75, 0x75, 0x74, 0x73, 0x73, 0x74, 0x75, 0x76, 0x77,
-  0x77, 0x75, 0x74, 0x72, 0x71, 0x71, 0x72, 0x73, 0x74, 0x75, 0x75, 0x74,
-  0x74, 0x74, 0x75, 0x76, 0x78, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7b, 0x79, 0x78, 0x78, 0x7a, 0x7d, 0x80,
-  0x82, 0x84, 0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x82, 0x80, 0x7e, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x84,
-  0x85, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80, 0x81, 0x81, 0x82, 0x83, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x85, 0x87, 0x88, 0x88, 0x88, 0x87, 0x86, 0x85,
-  0x85, 0x85, 0x87, 0x89, 0x8a, 0x8b, 0x8a, 0x88, 0x86, 0x85, 0x84, 0x84,
-  0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86,
-  0x85, 0x84, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80,
-  0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7e, 0x7c, 0x7b, 0x7a, 0x7b,
-  0x7b, 0x7d, 0x7e, 0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x85, 0x85,
-  0x84, 0x83, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x81, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81,
-  0x7f, 0x7e, 0x7d, 0x7d, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x77, 0x78, 0x79,
-  0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x79, 0x78, 0x78, 0x77, 0x77, 0x77, 0x76,
-  0x74, 0x73, 0x72, 0x71, 0x71, 0x72, 0x74, 0x75, 0x77, 0x78, 0x78, 0x77,
-  0x76, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7b, 0x7a, 0x7a, 0x79,
-  0x79, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x80, 0x82, 0x85,
-  0x86, 0x87, 0x87, 0x85, 0x84, 0x82, 0x82, 0x83, 0x84, 0x85, 0x87, 0x87,
-  0x87, 0x87, 0x86, 0x86, 0x86, 0x87, 0x88, 0x88, 0x89, 0x89, 0x88, 0x88,
-  0x87, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86,
-  0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x84, 0x83, 0x84, 0x85, 0x87, 0x88,
-  0x89, 0x89, 0x88, 0x86, 0x84, 0x83, 0x82, 0x83, 0x84, 0x85, 0x86, 0x86,
-  0x85, 0x84, 0x83, 0x83, 0x83, 0x83, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x86, 0x86, 0x87, 0x88, 0x88, 0x87, 0x85, 0x83, 0x80, 0x7e, 0x7d, 0x7e,
-  0x7f, 0x81, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83,
-  0x83, 0x81, 0x7f, 0x7d, 0x7b, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x79,
-  0x78, 0x78, 0x78, 0x78, 0x79, 0x7a, 0x7a, 0x7a, 0x79, 0x78, 0x77, 0x77,
-  0x76, 0x77, 0x77, 0x77, 0x76, 0x75, 0x73, 0x72, 0x71, 0x71, 0x72, 0x74,
-  0x76, 0x78, 0x7a, 0x7b, 0x7b, 0x7a, 0x79, 0x79, 0x78, 0x78, 0x78, 0x79,
-  0x79, 0x79, 0x79, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x82, 0x82,
-  0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x84, 0x85,
-  0x86, 0x86, 0x86, 0x86, 0x85, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x82,
-  0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x83, 0x84, 0x84, 0x83, 0x81, 0x80, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x83, 0x84,
-  0x85, 0x86, 0x85, 0x85, 0x84, 0x83, 0x83, 0x83, 0x84, 0x84, 0x85, 0x85,
-  0x84, 0x84, 0x83, 0x83, 0x83, 0x84, 0x86, 0x87, 0x88, 0x89, 0x88, 0x88,
-  0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x87, 0x86, 0x84, 0x82, 0x81, 0x80,
-  0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86,
-  0x85, 0x83, 0x81, 0x7e, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b, 0x7a, 0x7b, 0x7c,
-  0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7e, 0x7d, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e,
-  0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x78, 0x77, 0x75, 0x75, 0x75, 0x76, 0x77,
-  0x79, 0x7b, 0x7b, 0x7b, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x79, 0x7a, 0x7b,
-  0x7b, 0x7b, 0x7a, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7d, 0x7d, 0x7e, 0x7f,
-  0x7f, 0x80, 0x81, 0x83, 0x84, 0x86, 0x87, 0x87, 0x87, 0x87, 0x86, 0x85,
-  0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x89, 0x8b, 0x8d,
-  0x8f, 0x90, 0x91, 0x90, 0x8e, 0x8c, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-  0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x86, 0x84, 0x82, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x7b, 0x7c, 0x7c, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x79,
-  0x7a, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7a, 0x7a,
-  0x79, 0x77, 0x77, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7b, 0x7a, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x79, 0x7a, 0x7b,
-  0x7c, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83,
-  0x83, 0x82, 0x82, 0x81, 0x81, 0x82, 0x83, 0x84, 0x86, 0x87, 0x87, 0x87,
-  0x87, 0x86, 0x86, 0x87, 0x88, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x88, 0x87,
-  0x85, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x85, 0x86,
-  0x87, 0x88, 0x87, 0x86, 0x84, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80,
-  0x7f, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x84, 0x85, 0x86,
-  0x86, 0x86, 0x85, 0x83, 0x82, 0x80, 0x80, 0x80, 0x82, 0x84, 0x85, 0x86,
-  0x87, 0x86, 0x86, 0x85, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7b,
-  0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x79, 0x79, 0x78, 0x78, 0x7a,
-  0x7c, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7c,
-  0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f,
-  0x81, 0x83, 0x84, 0x84, 0x84, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-  0x81, 0x82, 0x83, 0x84, 0x84, 0x85, 0x87, 0x88, 0x88, 0x89, 0x89, 0x88,
-  0x88, 0x88, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8c, 0x8b, 0x8b, 0x8a, 0x89,
-  0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8b, 0x8b,
-  0x8b, 0x8a, 0x8a, 0x88, 0x87, 0x86, 0x85, 0x84, 0x84, 0x84, 0x85, 0x85,
-  0x84, 0x84, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e,
-  0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x78, 0x76, 0x75,
-  0x74, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a,
-  0x7b, 0x7a, 0x7a, 0x79, 0x78, 0x77, 0x77, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-  0x7b, 0x7a, 0x79, 0x79, 0x79, 0x7a, 0x7c, 0x7e, 0x7f, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b, 0x7c,
-  0x7d, 0x7f, 0x80, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f,
-  0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7d, 0x7e, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x83, 0x85,
-  0x86, 0x88, 0x88, 0x88, 0x87, 0x86, 0x84, 0x83, 0x83, 0x83, 0x84, 0x85,
-  0x85, 0x86, 0x85, 0x85, 0x84, 0x84, 0x85, 0x85, 0x86, 0x87, 0x87, 0x86,
-  0x85, 0x85, 0x84, 0x83, 0x84, 0x84, 0x84, 0x85, 0x84, 0x84, 0x83, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x87,
-  0x88, 0x87, 0x87, 0x86, 0x84, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81,
-  0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x77,
-  0x78, 0x79, 0x7a, 0x7c, 0x7d, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77,
-  0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b,
-  0x7b, 0x7b, 0x7b, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c,
-  0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x81, 0x82, 0x84, 0x85, 0x85, 0x84, 0x83, 0x82, 0x82, 0x81, 0x81, 0x82,
-  0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x85, 0x85, 0x86, 0x86, 0x85,
-  0x84, 0x83, 0x83, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x87, 0x87, 0x86,
-  0x85, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86,
-  0x87, 0x88, 0x88, 0x88, 0x88, 0x87, 0x86, 0x85, 0x85, 0x86, 0x86, 0x87,
-  0x87, 0x87, 0x86, 0x86, 0x85, 0x85, 0x85, 0x86, 0x87, 0x87, 0x87, 0x87,
-  0x86, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x85, 0x84, 0x83, 0x81, 0x7f,
-  0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7e, 0x7c, 0x7a, 0x78, 0x76, 0x76, 0x76, 0x76, 0x77, 0x77,
-  0x77, 0x77, 0x76, 0x76, 0x75, 0x76, 0x76, 0x77, 0x78, 0x78, 0x78, 0x78,
-  0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x75, 0x76,
-  0x77, 0x78, 0x7a, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x80, 0x82, 0x83, 0x84,
-  0x85, 0x85, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x84, 0x85, 0x86, 0x86, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x81,
-  0x82, 0x84, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e,
-  0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x80, 0x81, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x79,
-  0x79, 0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x78, 0x78, 0x77, 0x77,
-  0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x88, 0x87,
-  0x87, 0x86, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x87, 0x88,
-  0x89, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a, 0x89, 0x88, 0x87, 0x87, 0x86, 0x86,
-  0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86,
-  0x86, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84,
-  0x84, 0x83, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x79,
-  0x78, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x79,
-  0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x77, 0x77, 0x77, 0x78, 0x79, 0x7a,
-  0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x79, 0x7a, 0x7b, 0x7b, 0x7c, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f,
-  0x7f, 0x80, 0x82, 0x83, 0x85, 0x86, 0x86, 0x85, 0x85, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x84, 0x84, 0x85, 0x85,
-  0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x85, 0x84,
-  0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x83, 0x84, 0x84, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7e, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x83, 0x83, 0x82, 0x81,
-  0x81, 0x80, 0x81, 0x81, 0x83, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x80, 0x81, 0x82,
-  0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d,
-  0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7b, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7c,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81,
-  0x82, 0x83, 0x85, 0x86, 0x86, 0x86, 0x86, 0x85, 0x84, 0x84, 0x83, 0x84,
-  0x84, 0x85, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x88, 0x89, 0x8a, 0x8a,
-  0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x86,
-  0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x80, 0x7f, 0x7f, 0x7e, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c,
-  0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x79,
-  0x79, 0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c,
-  0x7c, 0x7b, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7e, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x85, 0x86, 0x87, 0x88, 0x87, 0x87, 0x86, 0x85, 0x84, 0x84, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x84, 0x84, 0x85, 0x85, 0x84, 0x84,
-  0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
-  0x79, 0x79, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x83, 0x83, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x87, 0x86, 0x86,
-  0x87, 0x87, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x86, 0x87, 0x87, 0x87,
-  0x86, 0x86, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x81,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x77, 0x77,
-  0x78, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c,
-  0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83,
-  0x83, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x84, 0x85, 0x86, 0x86, 0x87,
-  0x86, 0x86, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85,
-  0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 0x84, 0x83, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x80, 0x81, 0x82, 0x82, 0x83, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84,
-  0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x7a,
-  0x7a, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x79, 0x78, 0x78, 0x79, 0x79,
-  0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83,
-  0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x85, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x83, 0x84, 0x84, 0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83,
-  0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x82, 0x82, 0x82, 0x83, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x85,
-  0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x83, 0x82, 0x81, 0x80, 0x80, 0x7f,
-  0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x79,
-  0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x83, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x85, 0x86,
-  0x86, 0x87, 0x87, 0x86, 0x86, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7c, 0x7c, 0x7b, 0x7b, 0x7c, 0x7c, 0x7b, 0x7b, 0x7a, 0x7b, 0x7b, 0x7c,
-  0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83, 0x84,
-  0x84, 0x84, 0x85, 0x85, 0x86, 0x87, 0x88, 0x88, 0x88, 0x87, 0x86, 0x85,
-  0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86,
-  0x86, 0x86, 0x86, 0x86, 0x85, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b,
-  0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7a,
-  0x7a, 0x7a, 0x79, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80,
-  0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84,
-  0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x83, 0x82,
-  0x82, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82,
-  0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x79,
-  0x79, 0x79, 0x79, 0x7a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x83, 0x83, 0x84, 0x85, 0x85,
-  0x86, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x86,
-  0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x84,
-  0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x85,
-  0x86, 0x86, 0x85, 0x85, 0x84, 0x83, 0x83, 0x83, 0x82, 0x83, 0x83, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x7d, 0x7f, 0x81, 0x83, 0x83, 0x80, 0x84, 0x88, 0x83,
-  0x7d, 0x7a, 0x7f, 0x87, 0x89, 0x85, 0x7e, 0x7e, 0x86, 0x80, 0x7f, 0x84,
-  0x7f, 0x7a, 0x78, 0x82, 0x88, 0x8b, 0x84, 0x71, 0x72, 0x77, 0x79, 0x78,
-  0x83, 0x87, 0x83, 0x7f, 0x72, 0x70, 0x71, 0x77, 0x77, 0x7b, 0x83, 0x7f,
-  0x7a, 0x76, 0x7c, 0x78, 0x6a, 0x68, 0x75, 0x7e, 0x79, 0x78, 0x7a, 0x7f,
-  0x81, 0x78, 0x72, 0x79, 0x7a, 0x75, 0x70, 0x6f, 0x79, 0x7a, 0x75, 0x72,
-  0x7d, 0x88, 0x8a, 0x89, 0x81, 0x7b, 0x7b, 0x83, 0x86, 0x8b, 0x8d, 0x7c,
-  0x70, 0x70, 0x80, 0x8a, 0x8f, 0x96, 0x8c, 0x7b, 0x76, 0x88, 0x95, 0x98,
-  0x94, 0x8d, 0x93, 0x94, 0x84, 0x76, 0x81, 0x94, 0x99, 0x8f, 0x82, 0x81,
-  0x83, 0x7a, 0x71, 0x7a, 0x8d, 0x95, 0x94, 0x97, 0x97, 0x97, 0x92, 0x83,
-  0x83, 0x8d, 0x92, 0x85, 0x79, 0x7e, 0x85, 0x88, 0x7e, 0x74, 0x6e, 0x6f,
-  0x78, 0x80, 0x89, 0x88, 0x82, 0x81, 0x8c, 0x8f, 0x85, 0x82, 0x83, 0x83,
-  0x7c, 0x7b, 0x81, 0x83, 0x7f, 0x74, 0x72, 0x80, 0x8e, 0x8d, 0x82, 0x7d,
-  0x83, 0x84, 0x7b, 0x78, 0x7f, 0x87, 0x85, 0x7d, 0x78, 0x7c, 0x7a, 0x74,
-  0x76, 0x81, 0x8f, 0x94, 0x8f, 0x89, 0x8a, 0x8c, 0x85, 0x83, 0x86, 0x85,
-  0x7e, 0x7b, 0x7a, 0x77, 0x7c, 0x81, 0x86, 0x83, 0x76, 0x65, 0x61, 0x71,
-  0x84, 0x8c, 0x8a, 0x86, 0x81, 0x7b, 0x75, 0x72, 0x74, 0x73, 0x6f, 0x6f,
-  0x77, 0x7c, 0x78, 0x6d, 0x66, 0x69, 0x71, 0x72, 0x6c, 0x6b, 0x71, 0x75,
-  0x75, 0x74, 0x71, 0x6a, 0x65, 0x62, 0x61, 0x62, 0x60, 0x5f, 0x64, 0x6d,
-  0x72, 0x78, 0x7e, 0x80, 0x79, 0x73, 0x73, 0x77, 0x78, 0x74, 0x71, 0x6f,
-  0x70, 0x6e, 0x69, 0x6b, 0x74, 0x7c, 0x7a, 0x77, 0x7a, 0x83, 0x8b, 0x8d,
-  0x8c, 0x89, 0x84, 0x7c, 0x79, 0x7e, 0x86, 0x8b, 0x87, 0x83, 0x85, 0x8c,
-  0x8e, 0x89, 0x84, 0x82, 0x84, 0x8b, 0x92, 0x96, 0x96, 0x98, 0x9b, 0x9d,
-  0x9c, 0x94, 0x88, 0x7e, 0x7b, 0x7b, 0x7e, 0x84, 0x86, 0x82, 0x7e, 0x80,
-  0x86, 0x8b, 0x8d, 0x8e, 0x92, 0x98, 0x98, 0x93, 0x8f, 0x8d, 0x8c, 0x86,
-  0x7d, 0x77, 0x77, 0x78, 0x7a, 0x7c, 0x7f, 0x81, 0x81, 0x81, 0x7e, 0x7c,
-  0x78, 0x72, 0x6e, 0x72, 0x7c, 0x86, 0x8d, 0x91, 0x91, 0x8e, 0x8c, 0x8b,
-  0x88, 0x85, 0x83, 0x83, 0x86, 0x87, 0x84, 0x80, 0x7e, 0x7f, 0x80, 0x80,
-  0x82, 0x85, 0x88, 0x8a, 0x8e, 0x93, 0x97, 0x94, 0x8e, 0x8a, 0x8c, 0x92,
-  0x96, 0x98, 0x9c, 0xa0, 0xa2, 0xa0, 0x9b, 0x94, 0x8d, 0x86, 0x81, 0x80,
-  0x82, 0x88, 0x8f, 0x95, 0x9b, 0x9e, 0x9e, 0x9a, 0x95, 0x90, 0x8c, 0x88,
-  0x86, 0x84, 0x81, 0x81, 0x82, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x7f,
-  0x7b, 0x7b, 0x7d, 0x7c, 0x78, 0x71, 0x6c, 0x69, 0x68, 0x68, 0x6a, 0x6e,
-  0x70, 0x70, 0x6d, 0x6b, 0x68, 0x60, 0x55, 0x4b, 0x48, 0x4b, 0x52, 0x5b,
-  0x65, 0x6b, 0x6c, 0x6a, 0x66, 0x62, 0x5e, 0x5d, 0x5b, 0x5b, 0x5c, 0x5c,
-  0x5c, 0x5c, 0x5c, 0x5b, 0x5c, 0x5f, 0x63, 0x65, 0x65, 0x65, 0x65, 0x67,
-  0x67, 0x68, 0x6b, 0x70, 0x73, 0x76, 0x7a, 0x81, 0x87, 0x8a, 0x8a, 0x8a,
-  0x8a, 0x87, 0x83, 0x7e, 0x7c, 0x7d, 0x81, 0x87, 0x90, 0x99, 0x9f, 0xa2,
-  0xa4, 0xa5, 0xa3, 0x9f, 0x99, 0x94, 0x90, 0x8f, 0x92, 0x97, 0x9b, 0xa0,
-  0xa4, 0xa7, 0xa9, 0xa9, 0xa9, 0xac, 0xb0, 0xb1, 0xaf, 0xaa, 0xa3, 0x9b,
-  0x94, 0x8f, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x93, 0x91, 0x8d, 0x88,
-  0x84, 0x80, 0x7e, 0x7f, 0x85, 0x8c, 0x93, 0x95, 0x93, 0x8e, 0x85, 0x7d,
-  0x75, 0x6f, 0x68, 0x62, 0x60, 0x61, 0x65, 0x6a, 0x6c, 0x6d, 0x6e, 0x6f,
-  0x70, 0x72, 0x73, 0x72, 0x6e, 0x69, 0x66, 0x65, 0x63, 0x61, 0x60, 0x64,
-  0x6b, 0x72, 0x7a, 0x7f, 0x81, 0x80, 0x7d, 0x79, 0x73, 0x6d, 0x67, 0x64,
-  0x65, 0x6a, 0x70, 0x78, 0x82, 0x8b, 0x91, 0x93, 0x91, 0x8d, 0x89, 0x86,
-  0x84, 0x84, 0x86, 0x89, 0x8c, 0x90, 0x93, 0x93, 0x8f, 0x8b, 0x8b, 0x8e,
-  0x90, 0x90, 0x91, 0x92, 0x94, 0x96, 0x98, 0x9b, 0x9d, 0x9d, 0x9c, 0x9c,
-  0x9d, 0x9b, 0x94, 0x8b, 0x82, 0x7b, 0x74, 0x6f, 0x6e, 0x72, 0x7a, 0x86,
-  0x92, 0x9d, 0xa3, 0xa3, 0x9f, 0x98, 0x91, 0x87, 0x7d, 0x74, 0x6e, 0x6b,
-  0x6a, 0x6c, 0x6d, 0x6e, 0x6d, 0x6f, 0x72, 0x76, 0x78, 0x79, 0x7a, 0x7c,
-  0x7c, 0x7a, 0x78, 0x78, 0x79, 0x78, 0x77, 0x77, 0x78, 0x7a, 0x7a, 0x79,
-  0x78, 0x76, 0x72, 0x6e, 0x6d, 0x6f, 0x72, 0x75, 0x7a, 0x81, 0x89, 0x8e,
-  0x8e, 0x89, 0x83, 0x7c, 0x76, 0x71, 0x70, 0x70, 0x73, 0x78, 0x81, 0x89,
-  0x8e, 0x8f, 0x8e, 0x8d, 0x8a, 0x87, 0x84, 0x82, 0x7d, 0x77, 0x71, 0x6e,
-  0x6e, 0x6e, 0x6f, 0x72, 0x77, 0x7e, 0x83, 0x85, 0x85, 0x83, 0x7c, 0x74,
-  0x6c, 0x66, 0x63, 0x62, 0x62, 0x65, 0x6b, 0x71, 0x74, 0x76, 0x76, 0x73,
-  0x6d, 0x66, 0x61, 0x5e, 0x5e, 0x5f, 0x63, 0x68, 0x6c, 0x6e, 0x6e, 0x6d,
-  0x69, 0x65, 0x62, 0x62, 0x65, 0x6a, 0x6e, 0x71, 0x74, 0x76, 0x78, 0x7b,
-  0x7e, 0x82, 0x86, 0x8a, 0x8d, 0x8e, 0x8c, 0x86, 0x7f, 0x7a, 0x78, 0x7a,
-  0x7f, 0x87, 0x93, 0xa0, 0xab, 0xb1, 0xb6, 0xb8, 0xb6, 0xb2, 0xab, 0xa5,
-  0xa1, 0x9e, 0x9c, 0x9e, 0xa4, 0xab, 0xb1, 0xb5, 0xb6, 0xb5, 0xb4, 0xb4,
-  0xb5, 0xb8, 0xb9, 0xba, 0xba, 0xb9, 0xb8, 0xb6, 0xb3, 0xaf, 0xa9, 0xa4,
-  0xa2, 0xa2, 0xa2, 0xa1, 0x9d, 0x99, 0x95, 0x91, 0x8e, 0x8c, 0x8f, 0x94,
-  0x9a, 0x9f, 0xa2, 0xa3, 0x9f, 0x93, 0x85, 0x77, 0x6d, 0x65, 0x60, 0x5e,
-  0x60, 0x63, 0x64, 0x65, 0x66, 0x66, 0x64, 0x61, 0x5d, 0x5b, 0x5a, 0x5b,
-  0x5b, 0x5b, 0x5b, 0x5a, 0x58, 0x56, 0x55, 0x55, 0x55, 0x54, 0x54, 0x53,
-  0x51, 0x4e, 0x4a, 0x47, 0x43, 0x43, 0x46, 0x4b, 0x51, 0x57, 0x5d, 0x64,
-  0x6b, 0x6f, 0x6f, 0x6d, 0x69, 0x63, 0x5f, 0x5e, 0x60, 0x66, 0x6b, 0x70,
-  0x74, 0x77, 0x76, 0x73, 0x71, 0x71, 0x72, 0x75, 0x77, 0x7b, 0x80, 0x84,
-  0x88, 0x8b, 0x8d, 0x8e, 0x8d, 0x8d, 0x8d, 0x8f, 0x91, 0x92, 0x92, 0x8f,
-  0x8b, 0x87, 0x83, 0x81, 0x82, 0x85, 0x8b, 0x92, 0x99, 0x9d, 0x9d, 0x9a,
-  0x95, 0x8f, 0x89, 0x86, 0x86, 0x87, 0x89, 0x8a, 0x8c, 0x8d, 0x8d, 0x8c,
-  0x89, 0x85, 0x7f, 0x7b, 0x78, 0x79, 0x7e, 0x83, 0x86, 0x87, 0x87, 0x87,
-  0x86, 0x85, 0x85, 0x86, 0x87, 0x89, 0x89, 0x86, 0x81, 0x7b, 0x75, 0x72,
-  0x71, 0x74, 0x7a, 0x80, 0x87, 0x8c, 0x92, 0x95, 0x97, 0x94, 0x91, 0x8d,
-  0x8b, 0x8a, 0x8c, 0x90, 0x94, 0x96, 0x96, 0x95, 0x94, 0x94, 0x94, 0x93,
-  0x91, 0x92, 0x94, 0x98, 0x9d, 0xa2, 0xa7, 0xa9, 0xa9, 0xa6, 0xa1, 0x9d,
-  0x9a, 0x98, 0x98, 0x99, 0x9b, 0x9c, 0x9c, 0x9a, 0x97, 0x95, 0x96, 0x98,
-  0x9c, 0xa1, 0xa5, 0xa6, 0xa3, 0x9d, 0x95, 0x8b, 0x82, 0x7a, 0x74, 0x72,
-  0x73, 0x74, 0x77, 0x78, 0x7a, 0x7a, 0x79, 0x78, 0x76, 0x73, 0x70, 0x70,
-  0x71, 0x72, 0x71, 0x6e, 0x69, 0x61, 0x58, 0x51, 0x4d, 0x4b, 0x4a, 0x4b,
-  0x4d, 0x50, 0x52, 0x53, 0x52, 0x51, 0x51, 0x52, 0x54, 0x57, 0x5a, 0x5c,
-  0x5e, 0x60, 0x5f, 0x5d, 0x59, 0x56, 0x54, 0x54, 0x57, 0x5b, 0x5f, 0x63,
-  0x66, 0x68, 0x6a, 0x6b, 0x6a, 0x69, 0x68, 0x6a, 0x6d, 0x71, 0x76, 0x7d,
-  0x83, 0x87, 0x88, 0x88, 0x89, 0x8b, 0x8d, 0x8e, 0x8f, 0x8f, 0x8e, 0x8c,
-  0x8b, 0x8a, 0x88, 0x85, 0x83, 0x84, 0x89, 0x90, 0x97, 0x9e, 0xa3, 0xa5,
-  0xa6, 0xa5, 0xa2, 0x9e, 0x99, 0x96, 0x94, 0x94, 0x92, 0x8f, 0x8b, 0x86,
-  0x80, 0x7c, 0x7a, 0x7a, 0x7c, 0x81, 0x88, 0x90, 0x97, 0x9b, 0x9a, 0x97,
-  0x91, 0x8c, 0x85, 0x80, 0x7c, 0x7a, 0x78, 0x76, 0x72, 0x6f, 0x6c, 0x6b,
-  0x6b, 0x6e, 0x73, 0x78, 0x7e, 0x85, 0x8b, 0x90, 0x91, 0x8f, 0x8c, 0x89,
-  0x85, 0x82, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x85, 0x87, 0x87, 0x87, 0x87,
-  0x89, 0x8c, 0x91, 0x97, 0x9d, 0xa2, 0xa4, 0xa3, 0xa0, 0x9d, 0x9a, 0x98,
-  0x99, 0x9b, 0x9e, 0xa1, 0xa4, 0xa9, 0xac, 0xad, 0xac, 0xa7, 0xa2, 0x9d,
-  0x9b, 0x9d, 0x9f, 0xa1, 0xa2, 0xa2, 0xa0, 0x9c, 0x98, 0x94, 0x92, 0x91,
-  0x92, 0x94, 0x96, 0x97, 0x96, 0x93, 0x8f, 0x89, 0x83, 0x7c, 0x77, 0x76,
-  0x76, 0x76, 0x75, 0x73, 0x6f, 0x6b, 0x65, 0x60, 0x5d, 0x5b, 0x5b, 0x5c,
-  0x5d, 0x5e, 0x5e, 0x5c, 0x58, 0x53, 0x4e, 0x49, 0x45, 0x42, 0x42, 0x45,
-  0x4a, 0x50, 0x54, 0x54, 0x52, 0x4f, 0x4c, 0x49, 0x47, 0x47, 0x49, 0x4c,
-  0x4f, 0x50, 0x50, 0x4f, 0x4d, 0x4c, 0x4e, 0x53, 0x5a, 0x61, 0x68, 0x6d,
-  0x70, 0x71, 0x71, 0x6f, 0x6f, 0x6e, 0x6e, 0x6d, 0x6e, 0x71, 0x75, 0x79,
-  0x7d, 0x80, 0x81, 0x80, 0x81, 0x83, 0x87, 0x8c, 0x92, 0x98, 0x9d, 0xa1,
-  0xa4, 0xa4, 0xa2, 0x9f, 0x9a, 0x96, 0x93, 0x92, 0x93, 0x94, 0x96, 0x98,
-  0x99, 0x99, 0x99, 0x9a, 0x9c, 0xa0, 0xa6, 0xab, 0xb0, 0xb2, 0xb0, 0xab,
-  0xa4, 0x9d, 0x98, 0x94, 0x91, 0x91, 0x92, 0x94, 0x96, 0x96, 0x94, 0x91,
-  0x8e, 0x8b, 0x89, 0x89, 0x8c, 0x92, 0x99, 0x9e, 0xa1, 0xa1, 0x9e, 0x9a,
-  0x95, 0x90, 0x8c, 0x89, 0x87, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7f,
-  0x81, 0x83, 0x87, 0x8c, 0x91, 0x95, 0x98, 0x98, 0x96, 0x93, 0x8f, 0x8a,
-  0x86, 0x83, 0x84, 0x86, 0x89, 0x8c, 0x8d, 0x8c, 0x88, 0x82, 0x7d, 0x7a,
-  0x7a, 0x7d, 0x81, 0x86, 0x8a, 0x8e, 0x91, 0x92, 0x90, 0x8c, 0x86, 0x80,
-  0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7b, 0x7a, 0x78, 0x75, 0x73, 0x71, 0x6f,
-  0x70, 0x72, 0x73, 0x74, 0x73, 0x71, 0x6e, 0x69, 0x65, 0x63, 0x62, 0x62,
-  0x65, 0x68, 0x6b, 0x6c, 0x6b, 0x66, 0x60, 0x58, 0x50, 0x4c, 0x4b, 0x4e,
-  0x53, 0x58, 0x5d, 0x60, 0x62, 0x63, 0x63, 0x62, 0x61, 0x60, 0x5f, 0x5f,
-  0x60, 0x61, 0x62, 0x61, 0x60, 0x5f, 0x5e, 0x5f, 0x61, 0x65, 0x69, 0x6e,
-  0x71, 0x75, 0x78, 0x79, 0x79, 0x79, 0x7a, 0x7d, 0x80, 0x83, 0x87, 0x8a,
-  0x8c, 0x8b, 0x8a, 0x87, 0x85, 0x83, 0x84, 0x87, 0x8c, 0x93, 0x9b, 0xa2,
-  0xa9, 0xad, 0xad, 0xaa, 0xa5, 0xa0, 0x9b, 0x97, 0x96, 0x96, 0x98, 0x99,
-  0x9c, 0x9f, 0xa1, 0xa3, 0xa4, 0xa6, 0xa9, 0xab, 0xad, 0xad, 0xad, 0xab,
-  0xa5, 0x9e, 0x96, 0x90, 0x8b, 0x89, 0x89, 0x8d, 0x91, 0x94, 0x93, 0x90,
-  0x8c, 0x88, 0x86, 0x85, 0x87, 0x8a, 0x8d, 0x8f, 0x8f, 0x8e, 0x8a, 0x86,
-  0x81, 0x7b, 0x73, 0x6d, 0x68, 0x66, 0x68, 0x6a, 0x6e, 0x72, 0x74, 0x74,
-  0x75, 0x76, 0x77, 0x78, 0x78, 0x78, 0x78, 0x78, 0x75, 0x71, 0x6d, 0x6b,
-  0x69, 0x69, 0x6b, 0x6f, 0x75, 0x79, 0x7c, 0x7c, 0x7b, 0x77, 0x71, 0x6c,
-  0x6a, 0x6b, 0x6e, 0x73, 0x7a, 0x82, 0x88, 0x8b, 0x8b, 0x8a, 0x88, 0x85,
-  0x83, 0x83, 0x82, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x81, 0x84, 0x89, 0x8c, 0x8d, 0x8e, 0x8e, 0x8c, 0x89, 0x87, 0x86,
-  0x86, 0x87, 0x86, 0x84, 0x81, 0x7c, 0x75, 0x6f, 0x6a, 0x68, 0x69, 0x6c,
-  0x73, 0x7c, 0x85, 0x8c, 0x90, 0x92, 0x90, 0x89, 0x80, 0x77, 0x70, 0x6c,
-  0x6b, 0x6b, 0x6d, 0x6d, 0x6c, 0x6c, 0x6d, 0x6f, 0x72, 0x75, 0x79, 0x7e,
-  0x81, 0x83, 0x84, 0x83, 0x82, 0x80, 0x7e, 0x7c, 0x7c, 0x7d, 0x7e, 0x80,
-  0x81, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7d, 0x7e, 0x80, 0x86, 0x8b, 0x91,
-  0x95, 0x97, 0x98, 0x95, 0x91, 0x8d, 0x89, 0x87, 0x85, 0x86, 0x88, 0x8c,
-  0x8f, 0x92, 0x94, 0x94, 0x92, 0x8f, 0x8e, 0x8e, 0x8f, 0x8e, 0x8d, 0x8b,
-  0x89, 0x86, 0x83, 0x82, 0x81, 0x82, 0x85, 0x87, 0x8a, 0x8c, 0x8b, 0x88,
-  0x83, 0x7e, 0x78, 0x72, 0x6f, 0x6e, 0x71, 0x74, 0x78, 0x7c, 0x7e, 0x7d,
-  0x7a, 0x75, 0x70, 0x6b, 0x68, 0x67, 0x69, 0x6b, 0x6d, 0x6d, 0x6d, 0x6c,
-  0x6b, 0x6a, 0x6a, 0x6a, 0x6b, 0x6d, 0x6e, 0x70, 0x72, 0x72, 0x70, 0x6e,
-  0x6e, 0x6e, 0x6f, 0x71, 0x73, 0x76, 0x79, 0x7a, 0x7a, 0x78, 0x76, 0x72,
-  0x70, 0x71, 0x74, 0x7a, 0x81, 0x89, 0x91, 0x95, 0x96, 0x94, 0x8f, 0x8a,
-  0x85, 0x82, 0x80, 0x82, 0x85, 0x89, 0x8d, 0x90, 0x92, 0x93, 0x92, 0x93,
-  0x94, 0x96, 0x97, 0x98, 0x9a, 0x9b, 0x9b, 0x9b, 0x9a, 0x99, 0x96, 0x93,
-  0x91, 0x91, 0x91, 0x91, 0x91, 0x91, 0x8f, 0x8b, 0x87, 0x84, 0x84, 0x85,
-  0x89, 0x8d, 0x93, 0x98, 0x9b, 0x9a, 0x97, 0x91, 0x89, 0x81, 0x7a, 0x77,
-  0x76, 0x77, 0x78, 0x79, 0x7a, 0x79, 0x78, 0x76, 0x75, 0x74, 0x75, 0x78,
-  0x7d, 0x82, 0x84, 0x84, 0x83, 0x80, 0x7d, 0x7b, 0x79, 0x78, 0x77, 0x76,
-  0x75, 0x74, 0x74, 0x72, 0x70, 0x6e, 0x6e, 0x6f, 0x71, 0x76, 0x7d, 0x85,
-  0x8b, 0x90, 0x91, 0x90, 0x8c, 0x86, 0x80, 0x7b, 0x77, 0x75, 0x76, 0x78,
-  0x7b, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x83, 0x84, 0x86, 0x87,
-  0x88, 0x88, 0x87, 0x84, 0x80, 0x7e, 0x7c, 0x7b, 0x7c, 0x7e, 0x7f, 0x7e,
-  0x7c, 0x79, 0x75, 0x72, 0x70, 0x6f, 0x70, 0x73, 0x76, 0x78, 0x79, 0x79,
-  0x76, 0x73, 0x6e, 0x6a, 0x67, 0x65, 0x66, 0x69, 0x6d, 0x70, 0x71, 0x71,
-  0x6f, 0x6c, 0x68, 0x64, 0x61, 0x60, 0x61, 0x63, 0x66, 0x68, 0x69, 0x6a,
-  0x6b, 0x6d, 0x6f, 0x70, 0x72, 0x75, 0x77, 0x78, 0x79, 0x78, 0x75, 0x70,
-  0x6c, 0x6b, 0x6c, 0x70, 0x76, 0x7c, 0x82, 0x87, 0x8b, 0x8e, 0x8e, 0x8e,
-  0x8d, 0x8c, 0x8c, 0x8e, 0x90, 0x92, 0x95, 0x96, 0x96, 0x95, 0x93, 0x92,
-  0x92, 0x94, 0x97, 0x9d, 0xa3, 0xa9, 0xae, 0xb0, 0xb1, 0xaf, 0xab, 0xa7,
-  0xa4, 0xa3, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa2, 0xa1, 0xa0, 0xa0, 0xa1,
-  0xa3, 0xa7, 0xac, 0xb0, 0xb3, 0xb2, 0xae, 0xa9, 0xa1, 0x98, 0x90, 0x8a,
-  0x87, 0x86, 0x87, 0x8a, 0x8c, 0x8e, 0x8f, 0x8f, 0x8e, 0x8c, 0x8b, 0x8b,
-  0x8c, 0x8d, 0x8d, 0x8c, 0x89, 0x83, 0x7d, 0x76, 0x70, 0x6c, 0x69, 0x69,
-  0x6a, 0x6d, 0x70, 0x71, 0x70, 0x6e, 0x6d, 0x6d, 0x6e, 0x6f, 0x70, 0x71,
-  0x71, 0x70, 0x6e, 0x6c, 0x69, 0x65, 0x62, 0x5f, 0x5e, 0x5e, 0x5f, 0x62,
-  0x65, 0x67, 0x68, 0x66, 0x63, 0x61, 0x5f, 0x5e, 0x5e, 0x5f, 0x60, 0x63,
-  0x66, 0x68, 0x69, 0x68, 0x66, 0x64, 0x63, 0x63, 0x63, 0x63, 0x64, 0x63,
-  0x62, 0x61, 0x5e, 0x5b, 0x58, 0x56, 0x57, 0x5b, 0x61, 0x66, 0x6a, 0x6e,
-  0x6f, 0x6f, 0x6e, 0x6d, 0x6b, 0x6a, 0x6a, 0x69, 0x69, 0x69, 0x69, 0x67,
-  0x66, 0x64, 0x62, 0x62, 0x63, 0x67, 0x6d, 0x75, 0x7d, 0x84, 0x88, 0x8a,
-  0x8a, 0x87, 0x85, 0x82, 0x80, 0x81, 0x83, 0x85, 0x87, 0x87, 0x87, 0x87,
-  0x87, 0x89, 0x8c, 0x91, 0x96, 0x9c, 0xa3, 0xa9, 0xad, 0xaf, 0xaf, 0xad,
-  0xab, 0xa9, 0xa7, 0xa7, 0xa9, 0xac, 0xae, 0xb1, 0xb2, 0xb1, 0xb0, 0xb0,
-  0xb1, 0xb2, 0xb4, 0xb6, 0xb9, 0xbc, 0xbe, 0xbf, 0xbe, 0xbc, 0xb8, 0xb4,
-  0xb0, 0xae, 0xae, 0xaf, 0xb1, 0xb2, 0xb3, 0xb3, 0xb1, 0xae, 0xa9, 0xa4,
-  0xa1, 0xa0, 0xa0, 0xa1, 0xa1, 0xa0, 0x9d, 0x99, 0x94, 0x90, 0x8c, 0x89,
-  0x87, 0x86, 0x86, 0x86, 0x85, 0x83, 0x7f, 0x7a, 0x75, 0x70, 0x6c, 0x6a,
-  0x6a, 0x6b, 0x6d, 0x6d, 0x6c, 0x69, 0x66, 0x61, 0x5b, 0x57, 0x53, 0x52,
-  0x53, 0x54, 0x56, 0x56, 0x56, 0x54, 0x52, 0x50, 0x4d, 0x4c, 0x4c, 0x4d,
-  0x51, 0x55, 0x59, 0x5b, 0x5a, 0x57, 0x54, 0x52, 0x50, 0x50, 0x50, 0x52,
-  0x54, 0x56, 0x57, 0x59, 0x5b, 0x5c, 0x5c, 0x5d, 0x5f, 0x63, 0x68, 0x6c,
-  0x70, 0x72, 0x73, 0x71, 0x6e, 0x6b, 0x68, 0x68, 0x6a, 0x6c, 0x6f, 0x72,
-  0x76, 0x79, 0x7b, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7f, 0x82, 0x86, 0x89,
-  0x8a, 0x8b, 0x8a, 0x88, 0x86, 0x83, 0x81, 0x82, 0x84, 0x85, 0x86, 0x86,
-  0x87, 0x86, 0x85, 0x84, 0x84, 0x86, 0x8a, 0x8d, 0x91, 0x94, 0x96, 0x97,
-  0x95, 0x93, 0x90, 0x8c, 0x89, 0x87, 0x88, 0x8a, 0x8d, 0x8e, 0x8e, 0x8c,
-  0x8a, 0x88, 0x86, 0x85, 0x87, 0x8a, 0x90, 0x96, 0x9b, 0x9e, 0x9f, 0x9e,
-  0x9c, 0x9a, 0x98, 0x96, 0x95, 0x93, 0x92, 0x90, 0x90, 0x8e, 0x8c, 0x8a,
-  0x89, 0x8a, 0x8d, 0x91, 0x97, 0x9e, 0xa4, 0xa7, 0xa6, 0xa3, 0x9f, 0x9a,
-  0x95, 0x92, 0x90, 0x8e, 0x8e, 0x8f, 0x90, 0x92, 0x93, 0x93, 0x91, 0x8e,
-  0x8c, 0x8b, 0x8b, 0x8d, 0x8f, 0x92, 0x94, 0x94, 0x93, 0x8f, 0x89, 0x83,
-  0x7f, 0x7d, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7c, 0x7a, 0x7a, 0x79, 0x78,
-  0x78, 0x79, 0x7b, 0x7a, 0x78, 0x75, 0x72, 0x6e, 0x69, 0x65, 0x62, 0x62,
-  0x64, 0x67, 0x6b, 0x6f, 0x71, 0x71, 0x6f, 0x6b, 0x67, 0x63, 0x60, 0x5e,
-  0x5e, 0x5f, 0x62, 0x65, 0x67, 0x68, 0x69, 0x6a, 0x6a, 0x6a, 0x6a, 0x6a,
-  0x6c, 0x6e, 0x70, 0x70, 0x6f, 0x6d, 0x6a, 0x67, 0x67, 0x69, 0x6d, 0x71,
-  0x74, 0x77, 0x79, 0x7a, 0x7a, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x81,
-  0x83, 0x84, 0x83, 0x81, 0x7e, 0x7b, 0x79, 0x79, 0x7b, 0x7f, 0x84, 0x89,
-  0x8e, 0x91, 0x92, 0x91, 0x8f, 0x8c, 0x88, 0x85, 0x83, 0x82, 0x81, 0x80,
-  0x7f, 0x7f, 0x80, 0x81, 0x82, 0x86, 0x8b, 0x8f, 0x93, 0x96, 0x97, 0x96,
-  0x93, 0x8e, 0x88, 0x82, 0x7d, 0x79, 0x77, 0x78, 0x7a, 0x7d, 0x7f, 0x81,
-  0x83, 0x84, 0x84, 0x85, 0x85, 0x87, 0x89, 0x8d, 0x90, 0x92, 0x92, 0x8f,
-  0x8c, 0x88, 0x83, 0x7e, 0x7b, 0x7a, 0x7a, 0x7c, 0x7f, 0x83, 0x85, 0x86,
-  0x87, 0x88, 0x8b, 0x8f, 0x92, 0x94, 0x94, 0x94, 0x92, 0x8f, 0x8b, 0x88,
-  0x85, 0x83, 0x83, 0x85, 0x8a, 0x8f, 0x93, 0x95, 0x94, 0x91, 0x8d, 0x89,
-  0x86, 0x85, 0x85, 0x86, 0x88, 0x8a, 0x8c, 0x8f, 0x91, 0x91, 0x8f, 0x8c,
-  0x89, 0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x7f, 0x7d, 0x7a, 0x78,
-  0x77, 0x78, 0x7b, 0x7e, 0x80, 0x80, 0x7f, 0x7e, 0x7c, 0x79, 0x76, 0x73,
-  0x72, 0x72, 0x73, 0x74, 0x73, 0x70, 0x6c, 0x68, 0x64, 0x60, 0x5f, 0x5f,
-  0x63, 0x69, 0x71, 0x77, 0x7c, 0x7d, 0x7d, 0x7a, 0x77, 0x72, 0x6e, 0x6b,
-  0x69, 0x68, 0x69, 0x69, 0x6a, 0x6a, 0x6b, 0x6d, 0x70, 0x73, 0x77, 0x7b,
-  0x7f, 0x83, 0x86, 0x86, 0x85, 0x83, 0x80, 0x7e, 0x7e, 0x80, 0x83, 0x86,
-  0x8a, 0x8b, 0x8c, 0x8a, 0x88, 0x86, 0x85, 0x87, 0x89, 0x8c, 0x8f, 0x92,
-  0x96, 0x99, 0x9a, 0x99, 0x96, 0x92, 0x8f, 0x8e, 0x8e, 0x8e, 0x8f, 0x90,
-  0x92, 0x94, 0x95, 0x95, 0x95, 0x94, 0x93, 0x93, 0x93, 0x93, 0x92, 0x90,
-  0x8c, 0x89, 0x87, 0x84, 0x82, 0x81, 0x81, 0x83, 0x85, 0x87, 0x88, 0x88,
-  0x85, 0x81, 0x7c, 0x77, 0x73, 0x72, 0x74, 0x78, 0x7c, 0x7f, 0x80, 0x7e,
-  0x7b, 0x77, 0x73, 0x6e, 0x6a, 0x68, 0x67, 0x68, 0x6a, 0x6a, 0x6a, 0x6a,
-  0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x6c, 0x6f, 0x71, 0x73, 0x73, 0x71, 0x6e,
-  0x6a, 0x68, 0x67, 0x68, 0x69, 0x6b, 0x6e, 0x70, 0x71, 0x70, 0x6e, 0x6c,
-  0x6c, 0x6c, 0x6d, 0x70, 0x75, 0x7a, 0x7f, 0x83, 0x85, 0x85, 0x82, 0x7e,
-  0x7a, 0x78, 0x77, 0x77, 0x79, 0x7b, 0x7e, 0x82, 0x85, 0x87, 0x88, 0x89,
-  0x8a, 0x8b, 0x8d, 0x8f, 0x91, 0x93, 0x93, 0x93, 0x92, 0x90, 0x8e, 0x8d,
-  0x8d, 0x8e, 0x91, 0x93, 0x95, 0x96, 0x95, 0x93, 0x90, 0x8d, 0x8b, 0x8c,
-  0x90, 0x95, 0x9b, 0x9f, 0xa2, 0xa4, 0xa3, 0xa1, 0x9c, 0x98, 0x94, 0x91,
-  0x90, 0x90, 0x91, 0x91, 0x91, 0x8f, 0x8e, 0x8d, 0x8c, 0x8c, 0x8c, 0x8d,
-  0x90, 0x94, 0x97, 0x99, 0x99, 0x98, 0x96, 0x94, 0x92, 0x8f, 0x8d, 0x8c,
-  0x8a, 0x88, 0x86, 0x84, 0x80, 0x7c, 0x78, 0x76, 0x77, 0x79, 0x7e, 0x83,
-  0x88, 0x8c, 0x8d, 0x8c, 0x88, 0x83, 0x7e, 0x7a, 0x76, 0x72, 0x70, 0x6f,
-  0x70, 0x70, 0x6f, 0x6f, 0x6f, 0x6e, 0x6d, 0x6d, 0x6e, 0x6f, 0x71, 0x71,
-  0x70, 0x6f, 0x6d, 0x6a, 0x67, 0x64, 0x62, 0x61, 0x62, 0x62, 0x63, 0x63,
-  0x63, 0x62, 0x61, 0x60, 0x5f, 0x5f, 0x60, 0x62, 0x64, 0x66, 0x68, 0x68,
-  0x66, 0x63, 0x60, 0x5d, 0x5a, 0x59, 0x5b, 0x5e, 0x63, 0x67, 0x69, 0x6b,
-  0x6b, 0x6c, 0x6b, 0x6a, 0x69, 0x69, 0x6a, 0x6c, 0x6e, 0x70, 0x71, 0x71,
-  0x72, 0x73, 0x75, 0x78, 0x7b, 0x7e, 0x82, 0x85, 0x87, 0x88, 0x86, 0x84,
-  0x81, 0x7f, 0x7e, 0x80, 0x84, 0x89, 0x8e, 0x92, 0x96, 0x97, 0x98, 0x98,
-  0x97, 0x96, 0x97, 0x98, 0x9a, 0x9d, 0x9f, 0xa1, 0xa2, 0xa0, 0x9d, 0x9a,
-  0x98, 0x99, 0x9b, 0x9e, 0xa2, 0xa5, 0xa8, 0xaa, 0xab, 0xaa, 0xa8, 0xa5,
-  0xa2, 0xa0, 0x9f, 0x9e, 0x9d, 0x9d, 0x9b, 0x9a, 0x98, 0x97, 0x96, 0x97,
-  0x98, 0x9c, 0xa1, 0xa4, 0xa6, 0xa6, 0xa4, 0xa1, 0x9b, 0x94, 0x8d, 0x87,
-  0x83, 0x80, 0x80, 0x80, 0x81, 0x82, 0x83, 0x83, 0x83, 0x83, 0x84, 0x85,
-  0x87, 0x89, 0x8c, 0x8c, 0x8a, 0x86, 0x81, 0x7c, 0x78, 0x73, 0x70, 0x6e,
-  0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x71, 0x71, 0x71, 0x71, 0x73, 0x76, 0x78,
-  0x7a, 0x7a, 0x7a, 0x79, 0x76, 0x72, 0x6e, 0x6b, 0x69, 0x69, 0x6a, 0x6c,
-  0x6f, 0x72, 0x72, 0x72, 0x70, 0x6d, 0x6c, 0x6c, 0x6c, 0x6d, 0x6e, 0x6f,
-  0x70, 0x70, 0x71, 0x70, 0x6f, 0x6d, 0x6c, 0x6c, 0x6d, 0x6f, 0x70, 0x6f,
-  0x6e, 0x6c, 0x6a, 0x67, 0x65, 0x63, 0x64, 0x65, 0x67, 0x6a, 0x6d, 0x70,
-  0x71, 0x71, 0x71, 0x70, 0x6d, 0x6b, 0x69, 0x69, 0x6a, 0x6b, 0x6c, 0x6c,
-  0x6b, 0x68, 0x65, 0x62, 0x61, 0x63, 0x66, 0x6c, 0x72, 0x78, 0x7c, 0x7d,
-  0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x79,
-  0x79, 0x79, 0x7a, 0x7d, 0x81, 0x86, 0x8c, 0x92, 0x96, 0x98, 0x98, 0x97,
-  0x96, 0x94, 0x93, 0x94, 0x96, 0x98, 0x9a, 0x9c, 0x9d, 0x9d, 0x9c, 0x9b,
-  0x9b, 0x9d, 0x9e, 0xa0, 0xa3, 0xa7, 0xab, 0xad, 0xaf, 0xae, 0xab, 0xa7,
-  0xa3, 0xa1, 0xa2, 0xa3, 0xa6, 0xa8, 0xaa, 0xaa, 0xa9, 0xa8, 0xa7, 0xa6,
-  0xa4, 0xa3, 0xa3, 0xa5, 0xa5, 0xa5, 0xa4, 0xa2, 0x9f, 0x9b, 0x97, 0x94,
-  0x92, 0x91, 0x90, 0x91, 0x93, 0x93, 0x91, 0x8e, 0x8a, 0x87, 0x85, 0x83,
-  0x83, 0x84, 0x86, 0x86, 0x86, 0x85, 0x83, 0x7f, 0x7a, 0x75, 0x71, 0x6d,
-  0x6b, 0x6b, 0x6c, 0x6e, 0x6d, 0x6c, 0x6a, 0x68, 0x66, 0x63, 0x63, 0x64,
-  0x66, 0x68, 0x6a, 0x6b, 0x6b, 0x68, 0x63, 0x60, 0x5d, 0x5b, 0x5a, 0x5a,
-  0x5a, 0x5b, 0x5c, 0x5c, 0x5c, 0x5c, 0x5b, 0x5a, 0x5a, 0x5c, 0x5f, 0x62,
-  0x64, 0x67, 0x68, 0x66, 0x63, 0x5f, 0x5c, 0x59, 0x59, 0x5a, 0x5d, 0x5f,
-  0x61, 0x62, 0x65, 0x67, 0x68, 0x67, 0x67, 0x69, 0x6b, 0x6d, 0x70, 0x72,
-  0x73, 0x73, 0x73, 0x72, 0x71, 0x71, 0x70, 0x70, 0x71, 0x74, 0x76, 0x77,
-  0x78, 0x79, 0x79, 0x79, 0x7a, 0x7b, 0x7e, 0x81, 0x86, 0x8b, 0x8f, 0x92,
-  0x93, 0x92, 0x90, 0x8d, 0x8a, 0x89, 0x8a, 0x8d, 0x91, 0x93, 0x95, 0x94,
-  0x93, 0x91, 0x8f, 0x8f, 0x91, 0x93, 0x96, 0x9c, 0xa2, 0xa7, 0xa9, 0xaa,
-  0xa9, 0xa8, 0xa6, 0xa5, 0xa4, 0xa3, 0xa2, 0xa0, 0x9f, 0x9e, 0x9d, 0x9b,
-  0x98, 0x97, 0x98, 0x9b, 0x9e, 0xa3, 0xa7, 0xab, 0xad, 0xad, 0xaa, 0xa6,
-  0xa1, 0x9c, 0x99, 0x97, 0x95, 0x94, 0x95, 0x96, 0x96, 0x95, 0x93, 0x90,
-  0x8d, 0x8b, 0x8b, 0x8d, 0x90, 0x92, 0x93, 0x92, 0x91, 0x8e, 0x8a, 0x85,
-  0x80, 0x7c, 0x7a, 0x78, 0x76, 0x75, 0x75, 0x76, 0x75, 0x74, 0x73, 0x72,
-  0x72, 0x73, 0x74, 0x74, 0x74, 0x73, 0x71, 0x6d, 0x69, 0x64, 0x60, 0x5e,
-  0x5d, 0x5f, 0x61, 0x64, 0x66, 0x67, 0x67, 0x66, 0x64, 0x61, 0x5e, 0x5c,
-  0x5b, 0x5c, 0x5f, 0x62, 0x64, 0x65, 0x64, 0x64, 0x63, 0x63, 0x64, 0x65,
-  0x66, 0x68, 0x6a, 0x6c, 0x6c, 0x6b, 0x69, 0x67, 0x67, 0x68, 0x6a, 0x6d,
-  0x6f, 0x72, 0x73, 0x73, 0x73, 0x73, 0x74, 0x75, 0x76, 0x78, 0x7a, 0x7d,
-  0x80, 0x83, 0x84, 0x83, 0x81, 0x7e, 0x7c, 0x7a, 0x7b, 0x7d, 0x81, 0x85,
-  0x89, 0x8c, 0x8f, 0x90, 0x8f, 0x8e, 0x8c, 0x89, 0x88, 0x86, 0x86, 0x86,
-  0x86, 0x86, 0x86, 0x86, 0x87, 0x88, 0x8a, 0x8e, 0x92, 0x95, 0x98, 0x98,
-  0x98, 0x95, 0x92, 0x8e, 0x89, 0x86, 0x84, 0x83, 0x83, 0x85, 0x86, 0x87,
-  0x87, 0x87, 0x86, 0x86, 0x86, 0x86, 0x89, 0x8c, 0x91, 0x95, 0x97, 0x96,
-  0x93, 0x8f, 0x8a, 0x86, 0x82, 0x80, 0x7f, 0x7e, 0x7f, 0x81, 0x82, 0x83,
-  0x85, 0x86, 0x87, 0x89, 0x8c, 0x8e, 0x90, 0x91, 0x90, 0x8e, 0x8c, 0x88,
-  0x85, 0x82, 0x80, 0x80, 0x81, 0x84, 0x87, 0x8b, 0x8d, 0x8d, 0x8b, 0x88,
-  0x85, 0x83, 0x82, 0x83, 0x85, 0x88, 0x8a, 0x8d, 0x8f, 0x8e, 0x8c, 0x89,
-  0x86, 0x83, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x81, 0x82, 0x84, 0x85, 0x85, 0x84, 0x82, 0x80, 0x7d, 0x7b,
-  0x7a, 0x79, 0x7a, 0x7b, 0x7b, 0x7a, 0x78, 0x75, 0x71, 0x6d, 0x6a, 0x69,
-  0x6a, 0x6d, 0x71, 0x76, 0x7b, 0x7e, 0x7f, 0x7e, 0x7c, 0x79, 0x74, 0x70,
-  0x6c, 0x6b, 0x6a, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x69, 0x6a, 0x6c, 0x6e,
-  0x71, 0x74, 0x76, 0x78, 0x78, 0x76, 0x75, 0x74, 0x73, 0x73, 0x74, 0x76,
-  0x78, 0x79, 0x7a, 0x7a, 0x78, 0x76, 0x74, 0x74, 0x74, 0x76, 0x79, 0x7d,
-  0x81, 0x85, 0x87, 0x87, 0x86, 0x84, 0x82, 0x7f, 0x7f, 0x7f, 0x80, 0x81,
-  0x83, 0x85, 0x87, 0x89, 0x8a, 0x8a, 0x89, 0x89, 0x8a, 0x8b, 0x8d, 0x8f,
-  0x8f, 0x8e, 0x8c, 0x89, 0x87, 0x85, 0x86, 0x87, 0x8a, 0x8c, 0x8e, 0x8f,
-  0x8e, 0x8c, 0x8a, 0x87, 0x85, 0x84, 0x84, 0x86, 0x8a, 0x8d, 0x90, 0x91,
-  0x91, 0x90, 0x8d, 0x89, 0x85, 0x82, 0x80, 0x7f, 0x7f, 0x82, 0x84, 0x85,
-  0x85, 0x83, 0x82, 0x82, 0x81, 0x82, 0x83, 0x85, 0x86, 0x87, 0x86, 0x85,
-  0x82, 0x7f, 0x7d, 0x7b, 0x7b, 0x7c, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x7e,
-  0x7b, 0x78, 0x77, 0x78, 0x7b, 0x7e, 0x82, 0x85, 0x87, 0x87, 0x85, 0x81,
-  0x7d, 0x79, 0x76, 0x74, 0x74, 0x75, 0x78, 0x7b, 0x7e, 0x81, 0x83, 0x83,
-  0x81, 0x80, 0x80, 0x81, 0x82, 0x83, 0x83, 0x82, 0x81, 0x80, 0x7e, 0x7d,
-  0x7c, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7d, 0x7c, 0x7a, 0x79,
-  0x7a, 0x7c, 0x7f, 0x83, 0x87, 0x8a, 0x8b, 0x8a, 0x88, 0x84, 0x80, 0x7d,
-  0x7a, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7c, 0x7b, 0x7b, 0x7b,
-  0x7d, 0x7f, 0x83, 0x86, 0x89, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-  0x84, 0x84, 0x84, 0x82, 0x80, 0x7d, 0x7b, 0x7a, 0x7a, 0x7c, 0x7f, 0x83,
-  0x87, 0x8c, 0x90, 0x92, 0x92, 0x90, 0x8c, 0x88, 0x84, 0x82, 0x80, 0x7f,
-  0x7f, 0x80, 0x82, 0x83, 0x83, 0x83, 0x82, 0x81, 0x82, 0x84, 0x86, 0x88,
-  0x89, 0x89, 0x88, 0x86, 0x84, 0x82, 0x7f, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c,
-  0x7c, 0x7c, 0x7a, 0x78, 0x76, 0x74, 0x75, 0x77, 0x79, 0x7c, 0x7e, 0x7e,
-  0x7d, 0x7b, 0x78, 0x74, 0x70, 0x6d, 0x6b, 0x6b, 0x6c, 0x6d, 0x6f, 0x71,
-  0x72, 0x72, 0x71, 0x70, 0x6e, 0x6b, 0x6a, 0x6a, 0x6b, 0x6d, 0x6f, 0x6f,
-  0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x71, 0x73, 0x75, 0x77, 0x79, 0x79, 0x77,
-  0x74, 0x71, 0x6f, 0x6e, 0x6f, 0x72, 0x76, 0x7b, 0x7f, 0x82, 0x84, 0x84,
-  0x82, 0x81, 0x81, 0x82, 0x85, 0x88, 0x8b, 0x8e, 0x90, 0x90, 0x8f, 0x8e,
-  0x8c, 0x8b, 0x8c, 0x8d, 0x90, 0x93, 0x96, 0x99, 0x9c, 0x9f, 0xa0, 0xa0,
-  0x9e, 0x9d, 0x9b, 0x9b, 0x9b, 0x9c, 0x9c, 0x9d, 0x9c, 0x9b, 0x9a, 0x99,
-  0x99, 0x9b, 0x9e, 0xa1, 0xa4, 0xa7, 0xa8, 0xa7, 0xa5, 0xa1, 0x9c, 0x96,
-  0x92, 0x8e, 0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8c, 0x8b, 0x8a,
-  0x8a, 0x8c, 0x8d, 0x8f, 0x8f, 0x8e, 0x8b, 0x87, 0x82, 0x7e, 0x7b, 0x78,
-  0x76, 0x74, 0x73, 0x73, 0x73, 0x73, 0x72, 0x71, 0x70, 0x6f, 0x6f, 0x70,
-  0x72, 0x73, 0x74, 0x74, 0x72, 0x6f, 0x6b, 0x67, 0x64, 0x62, 0x62, 0x62,
-  0x64, 0x66, 0x67, 0x68, 0x67, 0x66, 0x65, 0x64, 0x63, 0x63, 0x64, 0x65,
-  0x66, 0x68, 0x69, 0x69, 0x68, 0x66, 0x64, 0x63, 0x63, 0x64, 0x66, 0x67,
-  0x68, 0x69, 0x68, 0x67, 0x66, 0x65, 0x64, 0x65, 0x67, 0x6a, 0x6e, 0x71,
-  0x73, 0x74, 0x74, 0x73, 0x72, 0x70, 0x6f, 0x6f, 0x70, 0x72, 0x73, 0x74,
-  0x74, 0x73, 0x72, 0x70, 0x6f, 0x70, 0x72, 0x76, 0x7a, 0x7f, 0x84, 0x87,
-  0x89, 0x8a, 0x89, 0x89, 0x87, 0x86, 0x84, 0x85, 0x86, 0x87, 0x88, 0x88,
-  0x88, 0x87, 0x87, 0x86, 0x87, 0x8a, 0x8f, 0x94, 0x99, 0x9d, 0xa0, 0xa0,
-  0x9e, 0x9d, 0x9c, 0x9b, 0x9b, 0x9c, 0x9d, 0x9f, 0xa0, 0xa1, 0xa0, 0x9e,
-  0x9c, 0x9a, 0x9a, 0x9b, 0x9e, 0xa1, 0xa4, 0xa7, 0xa9, 0xa9, 0xa8, 0xa6,
-  0xa3, 0xa1, 0x9f, 0x9f, 0x9f, 0xa0, 0xa0, 0xa0, 0xa0, 0xa0, 0x9f, 0x9c,
-  0x9a, 0x98, 0x97, 0x97, 0x97, 0x98, 0x99, 0x99, 0x98, 0x95, 0x91, 0x8e,
-  0x8b, 0x89, 0x88, 0x88, 0x88, 0x87, 0x86, 0x84, 0x81, 0x7e, 0x7a, 0x78,
-  0x77, 0x77, 0x79, 0x7b, 0x7c, 0x7c, 0x7b, 0x78, 0x75, 0x71, 0x6d, 0x69,
-  0x67, 0x67, 0x67, 0x67, 0x67, 0x67, 0x66, 0x64, 0x62, 0x61, 0x61, 0x61,
-  0x61, 0x62, 0x63, 0x65, 0x66, 0x66, 0x65, 0x64, 0x62, 0x5f, 0x5e, 0x5d,
-  0x5e, 0x5f, 0x61, 0x62, 0x62, 0x62, 0x61, 0x60, 0x60, 0x61, 0x63, 0x66,
-  0x6a, 0x6c, 0x6e, 0x6e, 0x6d, 0x6a, 0x68, 0x66, 0x65, 0x65, 0x67, 0x6a,
-  0x6d, 0x71, 0x73, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x76, 0x78, 0x7b,
-  0x7c, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x80,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x82, 0x85, 0x89, 0x8c, 0x8f,
-  0x90, 0x8f, 0x8e, 0x8c, 0x8a, 0x88, 0x88, 0x88, 0x89, 0x8b, 0x8d, 0x8e,
-  0x8e, 0x8c, 0x8a, 0x88, 0x88, 0x88, 0x8a, 0x8d, 0x91, 0x95, 0x99, 0x9c,
-  0x9d, 0x9d, 0x9b, 0x9a, 0x98, 0x97, 0x96, 0x96, 0x95, 0x94, 0x93, 0x91,
-  0x8e, 0x8d, 0x8d, 0x8f, 0x92, 0x96, 0x9b, 0x9f, 0xa3, 0xa5, 0xa5, 0xa3,
-  0xa0, 0x9c, 0x98, 0x96, 0x95, 0x95, 0x95, 0x96, 0x97, 0x97, 0x97, 0x95,
-  0x93, 0x91, 0x91, 0x93, 0x95, 0x97, 0x99, 0x9a, 0x9a, 0x9a, 0x98, 0x95,
-  0x92, 0x8e, 0x8a, 0x88, 0x86, 0x86, 0x85, 0x84, 0x83, 0x82, 0x81, 0x80,
-  0x80, 0x81, 0x82, 0x83, 0x83, 0x82, 0x81, 0x7d, 0x79, 0x75, 0x70, 0x6c,
-  0x69, 0x69, 0x6a, 0x6c, 0x6d, 0x6e, 0x6e, 0x6c, 0x6a, 0x67, 0x63, 0x61,
-  0x5e, 0x5d, 0x5d, 0x5e, 0x5f, 0x60, 0x60, 0x5f, 0x5f, 0x5e, 0x5e, 0x5d,
-  0x5d, 0x5d, 0x5d, 0x5e, 0x5e, 0x5d, 0x5c, 0x5a, 0x59, 0x58, 0x58, 0x59,
-  0x5a, 0x5d, 0x5f, 0x61, 0x62, 0x62, 0x61, 0x61, 0x61, 0x63, 0x67, 0x6a,
-  0x6e, 0x71, 0x73, 0x73, 0x72, 0x70, 0x6d, 0x6b, 0x6b, 0x6c, 0x6e, 0x72,
-  0x77, 0x7b, 0x7f, 0x82, 0x84, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87,
-  0x87, 0x87, 0x86, 0x86, 0x87, 0x88, 0x8b, 0x8e, 0x91, 0x95, 0x98, 0x9b,
-  0x9d, 0x9e, 0x9e, 0x9c, 0x99, 0x95, 0x93, 0x92, 0x93, 0x95, 0x97, 0x99,
-  0x9a, 0x99, 0x98, 0x97, 0x96, 0x95, 0x96, 0x98, 0x9c, 0x9f, 0xa3, 0xa4,
-  0xa4, 0xa2, 0x9f, 0x9b, 0x98, 0x95, 0x93, 0x91, 0x90, 0x90, 0x90, 0x90,
-  0x90, 0x90, 0x90, 0x92, 0x93, 0x96, 0x98, 0x9a, 0x9a, 0x99, 0x96, 0x92,
-  0x8e, 0x8a, 0x87, 0x85, 0x85, 0x85, 0x87, 0x89, 0x8b, 0x8d, 0x8c, 0x8b,
-  0x88, 0x85, 0x82, 0x80, 0x80, 0x81, 0x83, 0x85, 0x87, 0x88, 0x86, 0x84,
-  0x81, 0x7e, 0x7b, 0x7a, 0x79, 0x79, 0x78, 0x78, 0x77, 0x76, 0x76, 0x75,
-  0x74, 0x74, 0x74, 0x75, 0x77, 0x77, 0x78, 0x78, 0x76, 0x73, 0x70, 0x6d,
-  0x6c, 0x6b, 0x6c, 0x6d, 0x6f, 0x6f, 0x6e, 0x6c, 0x69, 0x66, 0x63, 0x61,
-  0x60, 0x61, 0x63, 0x67, 0x6b, 0x6f, 0x72, 0x73, 0x73, 0x72, 0x70, 0x6e,
-  0x6c, 0x6a, 0x69, 0x68, 0x68, 0x68, 0x68, 0x68, 0x68, 0x69, 0x6a, 0x6d,
-  0x70, 0x73, 0x76, 0x79, 0x7a, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x7a, 0x7b,
-  0x7e, 0x80, 0x83, 0x84, 0x84, 0x83, 0x81, 0x7f, 0x7d, 0x7e, 0x80, 0x83,
-  0x87, 0x8b, 0x8f, 0x92, 0x93, 0x93, 0x92, 0x91, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x90, 0x91, 0x92, 0x93, 0x95, 0x96,
-  0x97, 0x96, 0x95, 0x93, 0x90, 0x8f, 0x8d, 0x8d, 0x8e, 0x8f, 0x90, 0x90,
-  0x90, 0x8f, 0x8d, 0x8a, 0x86, 0x83, 0x81, 0x80, 0x81, 0x84, 0x88, 0x8b,
-  0x8c, 0x8c, 0x8b, 0x88, 0x85, 0x81, 0x7e, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7a, 0x79, 0x78, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7d, 0x7d, 0x7c,
-  0x7a, 0x77, 0x75, 0x73, 0x73, 0x73, 0x75, 0x77, 0x79, 0x7a, 0x7a, 0x79,
-  0x77, 0x76, 0x74, 0x73, 0x74, 0x76, 0x79, 0x7c, 0x7f, 0x81, 0x81, 0x81,
-  0x7e, 0x7b, 0x78, 0x76, 0x75, 0x76, 0x78, 0x7a, 0x7d, 0x7f, 0x81, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x85, 0x86, 0x86, 0x86, 0x84, 0x82, 0x80, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x80, 0x83, 0x85, 0x86, 0x86, 0x86, 0x84, 0x82, 0x80,
-  0x7e, 0x7d, 0x7e, 0x80, 0x83, 0x86, 0x87, 0x89, 0x89, 0x88, 0x86, 0x84,
-  0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b,
-  0x7c, 0x7d, 0x7f, 0x81, 0x83, 0x85, 0x85, 0x84, 0x83, 0x82, 0x82, 0x82,
-  0x82, 0x83, 0x83, 0x82, 0x81, 0x7e, 0x7b, 0x79, 0x77, 0x76, 0x77, 0x7a,
-  0x7e, 0x82, 0x87, 0x8b, 0x8d, 0x8d, 0x8c, 0x89, 0x87, 0x84, 0x82, 0x80,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x81, 0x83, 0x86, 0x88,
-  0x8a, 0x8b, 0x8b, 0x8a, 0x88, 0x86, 0x83, 0x81, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x7f, 0x7f, 0x7d, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7f, 0x82, 0x84,
-  0x85, 0x84, 0x83, 0x81, 0x7e, 0x7a, 0x76, 0x74, 0x73, 0x74, 0x75, 0x77,
-  0x78, 0x78, 0x79, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77,
-  0x75, 0x74, 0x72, 0x71, 0x72, 0x73, 0x75, 0x77, 0x7a, 0x7c, 0x7c, 0x7c,
-  0x7b, 0x78, 0x75, 0x73, 0x71, 0x71, 0x72, 0x75, 0x77, 0x7a, 0x7c, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x82, 0x84, 0x85, 0x86, 0x85,
-  0x84, 0x82, 0x81, 0x80, 0x80, 0x82, 0x84, 0x87, 0x89, 0x8a, 0x8b, 0x8c,
-  0x8c, 0x8c, 0x8c, 0x8d, 0x8e, 0x8f, 0x8f, 0x8f, 0x8e, 0x8c, 0x89, 0x88,
-  0x87, 0x87, 0x88, 0x8a, 0x8d, 0x90, 0x93, 0x95, 0x96, 0x95, 0x93, 0x90,
-  0x8d, 0x8a, 0x88, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x86, 0x87,
-  0x87, 0x88, 0x89, 0x8b, 0x8d, 0x8e, 0x8e, 0x8d, 0x8b, 0x88, 0x85, 0x82,
-  0x81, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x81,
-  0x83, 0x85, 0x86, 0x87, 0x87, 0x86, 0x84, 0x81, 0x7f, 0x7d, 0x7b, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x7f, 0x7d, 0x7c, 0x79, 0x77, 0x76, 0x75, 0x76, 0x77,
-  0x78, 0x78, 0x78, 0x77, 0x76, 0x74, 0x72, 0x71, 0x70, 0x71, 0x73, 0x75,
-  0x77, 0x77, 0x77, 0x76, 0x74, 0x72, 0x70, 0x6e, 0x6e, 0x6e, 0x6e, 0x6e,
-  0x6d, 0x6c, 0x6b, 0x6a, 0x6a, 0x6a, 0x69, 0x6a, 0x6b, 0x6e, 0x70, 0x72,
-  0x74, 0x74, 0x74, 0x73, 0x72, 0x72, 0x71, 0x72, 0x72, 0x73, 0x74, 0x74,
-  0x74, 0x73, 0x72, 0x72, 0x72, 0x73, 0x75, 0x78, 0x7c, 0x80, 0x84, 0x86,
-  0x86, 0x86, 0x85, 0x85, 0x85, 0x85, 0x86, 0x88, 0x8a, 0x8c, 0x8d, 0x8d,
-  0x8c, 0x8b, 0x8b, 0x8c, 0x8e, 0x90, 0x93, 0x96, 0x98, 0x9a, 0x9c, 0x9b,
-  0x9a, 0x99, 0x99, 0x99, 0x99, 0x9a, 0x9c, 0x9d, 0x9d, 0x9d, 0x9c, 0x9b,
-  0x9a, 0x98, 0x97, 0x97, 0x98, 0x9a, 0x9b, 0x9c, 0x9d, 0x9c, 0x9b, 0x99,
-  0x97, 0x96, 0x95, 0x94, 0x93, 0x92, 0x91, 0x90, 0x8f, 0x8d, 0x8b, 0x88,
-  0x86, 0x85, 0x86, 0x87, 0x89, 0x8a, 0x8a, 0x89, 0x87, 0x85, 0x82, 0x80,
-  0x7e, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x78, 0x76, 0x74, 0x72, 0x71,
-  0x70, 0x71, 0x73, 0x75, 0x76, 0x77, 0x76, 0x74, 0x72, 0x70, 0x6e, 0x6d,
-  0x6c, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6a, 0x6a, 0x6a, 0x6b, 0x6d, 0x6f,
-  0x70, 0x71, 0x72, 0x72, 0x72, 0x70, 0x6d, 0x6a, 0x68, 0x67, 0x67, 0x68,
-  0x69, 0x6b, 0x6d, 0x6e, 0x70, 0x70, 0x71, 0x71, 0x70, 0x70, 0x71, 0x72,
-  0x73, 0x75, 0x75, 0x74, 0x72, 0x71, 0x6f, 0x6e, 0x6e, 0x6f, 0x70, 0x72,
-  0x74, 0x75, 0x76, 0x76, 0x76, 0x75, 0x75, 0x76, 0x78, 0x7a, 0x7d, 0x7e,
-  0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x81, 0x84, 0x86,
-  0x87, 0x87, 0x86, 0x85, 0x84, 0x83, 0x84, 0x85, 0x87, 0x8a, 0x8d, 0x90,
-  0x93, 0x94, 0x95, 0x95, 0x96, 0x96, 0x96, 0x96, 0x96, 0x97, 0x96, 0x95,
-  0x94, 0x92, 0x91, 0x90, 0x91, 0x93, 0x97, 0x9b, 0x9f, 0xa2, 0xa3, 0xa3,
-  0xa2, 0xa0, 0x9e, 0x9d, 0x9b, 0x9b, 0x9b, 0x9a, 0x99, 0x99, 0x97, 0x96,
-  0x95, 0x93, 0x92, 0x92, 0x93, 0x95, 0x97, 0x99, 0x9a, 0x9b, 0x9a, 0x98,
-  0x94, 0x91, 0x8d, 0x8a, 0x87, 0x85, 0x83, 0x81, 0x80, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x80, 0x7e, 0x7c, 0x79, 0x75, 0x71,
-  0x6d, 0x69, 0x68, 0x68, 0x6a, 0x6b, 0x6c, 0x6c, 0x6b, 0x6a, 0x68, 0x67,
-  0x67, 0x66, 0x65, 0x65, 0x65, 0x66, 0x66, 0x66, 0x65, 0x64, 0x64, 0x63,
-  0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x69, 0x68, 0x68, 0x68, 0x69,
-  0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6d, 0x6d, 0x6c, 0x6d, 0x6e, 0x70, 0x72,
-  0x75, 0x78, 0x7b, 0x7d, 0x7f, 0x7e, 0x7d, 0x7b, 0x79, 0x79, 0x79, 0x7a,
-  0x7b, 0x7d, 0x80, 0x82, 0x84, 0x85, 0x86, 0x86, 0x87, 0x87, 0x88, 0x88,
-  0x88, 0x87, 0x86, 0x86, 0x85, 0x84, 0x84, 0x85, 0x86, 0x88, 0x8b, 0x8e,
-  0x90, 0x91, 0x90, 0x8f, 0x8d, 0x8b, 0x89, 0x88, 0x88, 0x89, 0x8a, 0x8b,
-  0x8b, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x88, 0x88, 0x8a, 0x8c, 0x8e, 0x90,
-  0x92, 0x93, 0x92, 0x90, 0x8e, 0x8c, 0x8a, 0x89, 0x88, 0x87, 0x87, 0x87,
-  0x87, 0x87, 0x87, 0x88, 0x8a, 0x8c, 0x8e, 0x90, 0x92, 0x94, 0x94, 0x93,
-  0x90, 0x8d, 0x8a, 0x88, 0x86, 0x86, 0x86, 0x88, 0x8a, 0x8c, 0x8e, 0x8e,
-  0x8d, 0x8b, 0x89, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8c, 0x8c, 0x8c, 0x8b,
-  0x8a, 0x88, 0x86, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7b, 0x78, 0x75,
-  0x73, 0x71, 0x70, 0x71, 0x72, 0x72, 0x73, 0x72, 0x71, 0x6f, 0x6d, 0x6b,
-  0x69, 0x68, 0x68, 0x69, 0x6c, 0x6e, 0x70, 0x71, 0x72, 0x72, 0x71, 0x70,
-  0x6f, 0x6d, 0x6c, 0x6b, 0x6b, 0x6a, 0x6a, 0x6a, 0x6a, 0x6b, 0x6c, 0x6d,
-  0x6f, 0x71, 0x74, 0x76, 0x78, 0x78, 0x78, 0x77, 0x76, 0x75, 0x75, 0x76,
-  0x78, 0x7a, 0x7d, 0x7f, 0x80, 0x81, 0x80, 0x7f, 0x7d, 0x7c, 0x7d, 0x7e,
-  0x80, 0x82, 0x85, 0x87, 0x89, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x89,
-  0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x88, 0x88, 0x89, 0x8a, 0x8c, 0x8d,
-  0x8e, 0x8e, 0x8e, 0x8d, 0x8b, 0x8a, 0x89, 0x88, 0x88, 0x88, 0x8a, 0x8b,
-  0x8c, 0x8d, 0x8c, 0x8a, 0x88, 0x85, 0x82, 0x81, 0x81, 0x82, 0x85, 0x87,
-  0x89, 0x8a, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x86, 0x85, 0x83, 0x82, 0x82,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82, 0x84, 0x87, 0x89, 0x8a, 0x8a,
-  0x88, 0x86, 0x84, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85,
-  0x84, 0x83, 0x81, 0x80, 0x7f, 0x80, 0x81, 0x83, 0x86, 0x88, 0x89, 0x88,
-  0x87, 0x84, 0x81, 0x7e, 0x7c, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7d,
-  0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x7d, 0x7a, 0x77,
-  0x74, 0x72, 0x71, 0x71, 0x72, 0x74, 0x77, 0x78, 0x79, 0x79, 0x78, 0x76,
-  0x74, 0x72, 0x71, 0x72, 0x73, 0x75, 0x77, 0x78, 0x78, 0x78, 0x78, 0x76,
-  0x75, 0x74, 0x74, 0x74, 0x75, 0x76, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76,
-  0x77, 0x79, 0x7a, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x82,
-  0x83, 0x84, 0x85, 0x87, 0x87, 0x87, 0x86, 0x84, 0x82, 0x81, 0x80, 0x80,
-  0x82, 0x84, 0x88, 0x8c, 0x90, 0x92, 0x93, 0x93, 0x92, 0x90, 0x8f, 0x8d,
-  0x8c, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85, 0x85, 0x86, 0x87, 0x89, 0x8c,
-  0x8f, 0x91, 0x91, 0x91, 0x8f, 0x8d, 0x8a, 0x88, 0x86, 0x84, 0x84, 0x83,
-  0x83, 0x82, 0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7b, 0x7b, 0x7c, 0x7e, 0x80,
-  0x82, 0x83, 0x83, 0x82, 0x80, 0x7d, 0x7a, 0x77, 0x74, 0x73, 0x73, 0x73,
-  0x74, 0x74, 0x75, 0x75, 0x76, 0x76, 0x77, 0x78, 0x78, 0x79, 0x79, 0x79,
-  0x78, 0x76, 0x74, 0x72, 0x71, 0x71, 0x72, 0x74, 0x76, 0x79, 0x7b, 0x7d,
-  0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x77, 0x78, 0x7a, 0x7c, 0x7d, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x81, 0x83, 0x84, 0x86, 0x86,
-  0x86, 0x85, 0x84, 0x83, 0x83, 0x84, 0x85, 0x86, 0x87, 0x87, 0x87, 0x86,
-  0x85, 0x85, 0x86, 0x86, 0x87, 0x89, 0x8a, 0x8a, 0x8b, 0x8a, 0x88, 0x86,
-  0x84, 0x83, 0x82, 0x82, 0x84, 0x86, 0x88, 0x8a, 0x8c, 0x8c, 0x8c, 0x8a,
-  0x88, 0x86, 0x84, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x83, 0x85, 0x87, 0x89, 0x8a, 0x89, 0x87, 0x85, 0x83, 0x81,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x81, 0x82, 0x84, 0x86, 0x88, 0x89, 0x88, 0x87, 0x84, 0x82, 0x80, 0x7e,
-  0x7d, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81,
-  0x82, 0x83, 0x83, 0x83, 0x82, 0x80, 0x7e, 0x7c, 0x7a, 0x79, 0x78, 0x78,
-  0x79, 0x7a, 0x7a, 0x79, 0x78, 0x76, 0x75, 0x74, 0x73, 0x74, 0x75, 0x77,
-  0x78, 0x79, 0x7a, 0x79, 0x78, 0x76, 0x75, 0x73, 0x72, 0x71, 0x70, 0x71,
-  0x71, 0x71, 0x70, 0x70, 0x6f, 0x6f, 0x6e, 0x6f, 0x70, 0x72, 0x74, 0x77,
-  0x78, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x7a,
-  0x7a, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x79, 0x7b, 0x7e, 0x81, 0x84, 0x86,
-  0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x86, 0x87, 0x89, 0x8a, 0x8b, 0x8c,
-  0x8d, 0x8c, 0x8c, 0x8b, 0x8c, 0x8c, 0x8e, 0x90, 0x91, 0x93, 0x94, 0x94,
-  0x94, 0x92, 0x91, 0x90, 0x90, 0x91, 0x93, 0x94, 0x96, 0x96, 0x95, 0x94,
-  0x92, 0x90, 0x8f, 0x8e, 0x8e, 0x8f, 0x90, 0x91, 0x92, 0x92, 0x91, 0x90,
-  0x8e, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x87, 0x85, 0x83,
-  0x82, 0x81, 0x80, 0x80, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x81, 0x80,
-  0x7e, 0x7d, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x79, 0x78, 0x76, 0x76,
-  0x75, 0x76, 0x78, 0x79, 0x7b, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x76,
-  0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x76,
-  0x78, 0x7a, 0x7b, 0x7d, 0x7d, 0x7c, 0x7a, 0x77, 0x73, 0x71, 0x6f, 0x6e,
-  0x6f, 0x71, 0x72, 0x74, 0x75, 0x75, 0x76, 0x76, 0x76, 0x76, 0x77, 0x78,
-  0x79, 0x79, 0x79, 0x79, 0x77, 0x75, 0x73, 0x71, 0x70, 0x70, 0x70, 0x71,
-  0x73, 0x73, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x7a,
-  0x7b, 0x7b, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x77, 0x77, 0x79, 0x7b, 0x7d,
-  0x80, 0x81, 0x81, 0x81, 0x7f, 0x7f, 0x7e, 0x7f, 0x80, 0x82, 0x84, 0x86,
-  0x88, 0x8a, 0x8a, 0x8b, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x91,
-  0x90, 0x8e, 0x8c, 0x8b, 0x8b, 0x8c, 0x8e, 0x91, 0x94, 0x97, 0x9a, 0x9c,
-  0x9c, 0x9c, 0x9a, 0x99, 0x97, 0x96, 0x96, 0x96, 0x95, 0x96, 0x95, 0x95,
-  0x94, 0x92, 0x91, 0x90, 0x90, 0x91, 0x93, 0x95, 0x97, 0x98, 0x98, 0x97,
-  0x95, 0x93, 0x91, 0x8e, 0x8c, 0x8b, 0x89, 0x87, 0x86, 0x84, 0x82, 0x81,
-  0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x84, 0x86, 0x86, 0x86, 0x83, 0x80, 0x7d,
-  0x79, 0x76, 0x73, 0x72, 0x71, 0x72, 0x73, 0x73, 0x74, 0x73, 0x73, 0x72,
-  0x71, 0x70, 0x6f, 0x6f, 0x6f, 0x6f, 0x70, 0x70, 0x6f, 0x6e, 0x6d, 0x6b,
-  0x6b, 0x6b, 0x6b, 0x6c, 0x6d, 0x6e, 0x6e, 0x6e, 0x6d, 0x6d, 0x6c, 0x6d,
-  0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x71, 0x70, 0x6f, 0x6e, 0x6d, 0x6c, 0x6d,
-  0x6e, 0x70, 0x73, 0x75, 0x77, 0x78, 0x79, 0x78, 0x77, 0x75, 0x74, 0x74,
-  0x75, 0x75, 0x77, 0x78, 0x79, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7d,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7c, 0x7b, 0x7b, 0x7b, 0x7d, 0x80, 0x83,
-  0x85, 0x87, 0x88, 0x88, 0x87, 0x86, 0x85, 0x83, 0x83, 0x83, 0x84, 0x85,
-  0x87, 0x88, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88, 0x89, 0x8a, 0x8b, 0x8e,
-  0x90, 0x91, 0x92, 0x92, 0x91, 0x90, 0x90, 0x8f, 0x8f, 0x8f, 0x8f, 0x8f,
-  0x8f, 0x8e, 0x8e, 0x8d, 0x8e, 0x8e, 0x90, 0x92, 0x95, 0x98, 0x99, 0x9a,
-  0x99, 0x97, 0x94, 0x91, 0x8f, 0x8d, 0x8c, 0x8d, 0x8d, 0x8f, 0x90, 0x91,
-  0x91, 0x91, 0x90, 0x8e, 0x8d, 0x8c, 0x8b, 0x8b, 0x8c, 0x8d, 0x8d, 0x8d,
-  0x8c, 0x8b, 0x88, 0x86, 0x84, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7d, 0x7b,
-  0x79, 0x78, 0x78, 0x78, 0x7a, 0x7c, 0x7d, 0x7d, 0x7d, 0x7b, 0x79, 0x76,
-  0x73, 0x70, 0x6e, 0x6d, 0x6c, 0x6c, 0x6d, 0x6e, 0x6d, 0x6d, 0x6c, 0x6b,
-  0x69, 0x69, 0x68, 0x68, 0x69, 0x6a, 0x6c, 0x6e, 0x6f, 0x6f, 0x6f, 0x6e,
-  0x6d, 0x6d, 0x6c, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6b, 0x6c,
-  0x6d, 0x6f, 0x72, 0x75, 0x77, 0x79, 0x7a, 0x79, 0x78, 0x76, 0x75, 0x75,
-  0x76, 0x77, 0x79, 0x7c, 0x7f, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x82, 0x84, 0x85, 0x87, 0x88, 0x89, 0x89, 0x88, 0x89, 0x89,
-  0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x89, 0x89, 0x88, 0x89, 0x89, 0x8b,
-  0x8c, 0x8e, 0x8f, 0x8f, 0x8e, 0x8c, 0x8a, 0x89, 0x88, 0x88, 0x89, 0x8a,
-  0x8c, 0x8d, 0x8e, 0x8d, 0x8b, 0x89, 0x87, 0x85, 0x84, 0x83, 0x84, 0x85,
-  0x87, 0x89, 0x8a, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x86,
-  0x85, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x82, 0x84, 0x86, 0x88, 0x89,
-  0x89, 0x89, 0x87, 0x85, 0x83, 0x81, 0x7f, 0x7f, 0x7f, 0x81, 0x82, 0x83,
-  0x84, 0x83, 0x82, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x85,
-  0x85, 0x84, 0x82, 0x7f, 0x7d, 0x7b, 0x7a, 0x79, 0x7a, 0x7a, 0x7b, 0x7b,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x80, 0x81, 0x81, 0x80, 0x7e, 0x7b,
-  0x78, 0x74, 0x72, 0x70, 0x70, 0x72, 0x74, 0x76, 0x78, 0x79, 0x79, 0x79,
-  0x78, 0x77, 0x76, 0x75, 0x75, 0x76, 0x77, 0x78, 0x78, 0x78, 0x78, 0x77,
-  0x76, 0x76, 0x76, 0x75, 0x76, 0x76, 0x77, 0x78, 0x78, 0x78, 0x78, 0x78,
-  0x79, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x80, 0x81, 0x83, 0x85, 0x86, 0x86, 0x85, 0x84, 0x82, 0x81, 0x80,
-  0x80, 0x81, 0x83, 0x86, 0x88, 0x8b, 0x8c, 0x8d, 0x8d, 0x8d, 0x8c, 0x8b,
-  0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x86, 0x85, 0x84, 0x84, 0x85, 0x86,
-  0x88, 0x8b, 0x8d, 0x8e, 0x8e, 0x8d, 0x8c, 0x8a, 0x87, 0x85, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x82, 0x81, 0x7f, 0x7e, 0x7d, 0x7d, 0x7e, 0x80,
-  0x83, 0x84, 0x85, 0x85, 0x84, 0x82, 0x80, 0x7e, 0x7c, 0x7b, 0x7a, 0x7a,
-  0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7c, 0x7a, 0x79, 0x78, 0x77, 0x78, 0x79, 0x7b, 0x7d,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-  0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x83,
-  0x83, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x82, 0x81, 0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x82,
-  0x81, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x82, 0x83, 0x84, 0x84, 0x84,
-  0x83, 0x81, 0x80, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x82, 0x84, 0x85, 0x85, 0x85, 0x83, 0x82,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x82, 0x82, 0x83, 0x85, 0x87, 0x88, 0x89, 0x89, 0x88, 0x86, 0x85, 0x84,
-  0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x85, 0x84, 0x84, 0x83, 0x83, 0x83,
-  0x84, 0x85, 0x86, 0x87, 0x87, 0x87, 0x86, 0x84, 0x82, 0x80, 0x7f, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x79, 0x79,
-  0x7a, 0x7c, 0x7c, 0x7d, 0x7d, 0x7b, 0x7a, 0x78, 0x76, 0x74, 0x74, 0x74,
-  0x74, 0x74, 0x73, 0x72, 0x71, 0x70, 0x6f, 0x6f, 0x70, 0x71, 0x72, 0x74,
-  0x76, 0x78, 0x78, 0x78, 0x77, 0x76, 0x75, 0x74, 0x73, 0x73, 0x74, 0x74,
-  0x75, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x79, 0x7b, 0x7d, 0x7f,
-  0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x83, 0x85, 0x87,
-  0x88, 0x88, 0x88, 0x87, 0x86, 0x86, 0x87, 0x89, 0x8b, 0x8d, 0x8f, 0x8f,
-  0x90, 0x8f, 0x8e, 0x8d, 0x8c, 0x8c, 0x8d, 0x8e, 0x8f, 0x90, 0x91, 0x92,
-  0x92, 0x91, 0x90, 0x8f, 0x8e, 0x8e, 0x8e, 0x8f, 0x8f, 0x90, 0x90, 0x90,
-  0x8f, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x8d, 0x8b, 0x89,
-  0x87, 0x85, 0x83, 0x82, 0x82, 0x84, 0x86, 0x87, 0x89, 0x89, 0x88, 0x87,
-  0x85, 0x83, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7a,
-  0x7a, 0x79, 0x79, 0x7a, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7c, 0x7b, 0x7a,
-  0x79, 0x78, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x74, 0x73, 0x72, 0x72,
-  0x72, 0x74, 0x76, 0x78, 0x79, 0x7a, 0x7a, 0x79, 0x77, 0x74, 0x71, 0x6f,
-  0x6e, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x73, 0x73, 0x73, 0x74,
-  0x75, 0x76, 0x77, 0x77, 0x76, 0x74, 0x73, 0x71, 0x6f, 0x6f, 0x6f, 0x6f,
-  0x70, 0x72, 0x73, 0x74, 0x75, 0x75, 0x75, 0x74, 0x74, 0x74, 0x75, 0x77,
-  0x79, 0x7b, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x79, 0x78, 0x78, 0x79, 0x7b,
-  0x7d, 0x7f, 0x81, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x85,
-  0x86, 0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8d, 0x8e, 0x90, 0x91, 0x92,
-  0x93, 0x92, 0x91, 0x8f, 0x8d, 0x8c, 0x8d, 0x8e, 0x90, 0x92, 0x95, 0x98,
-  0x9a, 0x9b, 0x9b, 0x99, 0x97, 0x96, 0x95, 0x95, 0x95, 0x95, 0x95, 0x95,
-  0x95, 0x94, 0x93, 0x92, 0x91, 0x90, 0x91, 0x92, 0x93, 0x94, 0x94, 0x94,
-  0x94, 0x93, 0x91, 0x8f, 0x8e, 0x8c, 0x8b, 0x89, 0x88, 0x87, 0x85, 0x83,
-  0x81, 0x80, 0x7f, 0x7e, 0x7f, 0x80, 0x82, 0x84, 0x85, 0x85, 0x84, 0x82,
-  0x7f, 0x7b, 0x78, 0x75, 0x73, 0x72, 0x72, 0x73, 0x73, 0x73, 0x73, 0x73,
-  0x72, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x71, 0x70, 0x70, 0x6f, 0x6e,
-  0x6d, 0x6d, 0x6d, 0x6e, 0x6e, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6e, 0x6d,
-  0x6d, 0x6d, 0x6d, 0x6f, 0x70, 0x72, 0x73, 0x74, 0x73, 0x72, 0x70, 0x6f,
-  0x6f, 0x6f, 0x71, 0x72, 0x74, 0x76, 0x78, 0x79, 0x79, 0x78, 0x77, 0x76,
-  0x76, 0x76, 0x77, 0x78, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d,
-  0x7e, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7c, 0x7e,
-  0x80, 0x83, 0x85, 0x86, 0x87, 0x87, 0x86, 0x85, 0x83, 0x82, 0x81, 0x82,
-  0x83, 0x84, 0x86, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x87, 0x88,
-  0x8a, 0x8b, 0x8c, 0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8d, 0x8d, 0x8d, 0x8e,
-  0x8e, 0x8e, 0x8d, 0x8d, 0x8c, 0x8b, 0x8c, 0x8d, 0x8e, 0x90, 0x92, 0x94,
-  0x95, 0x95, 0x94, 0x92, 0x90, 0x8f, 0x8d, 0x8c, 0x8c, 0x8d, 0x8e, 0x8f,
-  0x91, 0x92, 0x92, 0x91, 0x8f, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8e,
-  0x8d, 0x8d, 0x8c, 0x8b, 0x89, 0x88, 0x88, 0x87, 0x87, 0x86, 0x85, 0x83,
-  0x82, 0x80, 0x7f, 0x7e, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x81, 0x80,
-  0x7d, 0x7b, 0x78, 0x75, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x72, 0x72,
-  0x70, 0x6f, 0x6e, 0x6d, 0x6d, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x71, 0x70,
-  0x70, 0x6f, 0x6e, 0x6d, 0x6d, 0x6d, 0x6c, 0x6c, 0x6b, 0x6a, 0x6a, 0x6a,
-  0x6a, 0x6b, 0x6d, 0x6f, 0x71, 0x73, 0x74, 0x75, 0x75, 0x74, 0x73, 0x71,
-  0x70, 0x70, 0x71, 0x72, 0x73, 0x76, 0x78, 0x7a, 0x7a, 0x7a, 0x7a, 0x79,
-  0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x82, 0x84, 0x85, 0x85, 0x86, 0x85, 0x85, 0x84, 0x84, 0x84, 0x85,
-  0x87, 0x88, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x89, 0x88, 0x89, 0x89,
-  0x8a, 0x8b, 0x8c, 0x8d, 0x8d, 0x8d, 0x8c, 0x8b, 0x89, 0x88, 0x87, 0x88,
-  0x89, 0x8a, 0x8c, 0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
-  0x8d, 0x8d, 0x8b, 0x8a, 0x88, 0x87, 0x86, 0x86, 0x87, 0x88, 0x8a, 0x8c,
-  0x8e, 0x8f, 0x8f, 0x8e, 0x8c, 0x8a, 0x89, 0x87, 0x87, 0x87, 0x87, 0x87,
-  0x88, 0x88, 0x87, 0x86, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x86,
-  0x87, 0x87, 0x86, 0x85, 0x82, 0x80, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7c,
-  0x7a, 0x77, 0x74, 0x71, 0x70, 0x6f, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74,
-  0x73, 0x73, 0x72, 0x71, 0x70, 0x70, 0x71, 0x71, 0x71, 0x71, 0x71, 0x70,
-  0x70, 0x70, 0x6f, 0x6f, 0x6f, 0x70, 0x70, 0x71, 0x73, 0x73, 0x73, 0x73,
-  0x73, 0x72, 0x72, 0x73, 0x74, 0x75, 0x76, 0x78, 0x79, 0x79, 0x79, 0x79,
-  0x79, 0x7a, 0x7b, 0x7d, 0x7e, 0x80, 0x82, 0x82, 0x83, 0x82, 0x82, 0x81,
-  0x80, 0x80, 0x81, 0x82, 0x84, 0x86, 0x88, 0x8a, 0x8b, 0x8c, 0x8c, 0x8c,
-  0x8c, 0x8d, 0x8d, 0x8d, 0x8d, 0x8c, 0x8c, 0x8b, 0x8a, 0x89, 0x89, 0x89,
-  0x8b, 0x8d, 0x8f, 0x91, 0x92, 0x93, 0x93, 0x92, 0x90, 0x8f, 0x8d, 0x8c,
-  0x8b, 0x8a, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x85, 0x85, 0x86,
-  0x87, 0x88, 0x89, 0x8a, 0x8a, 0x89, 0x88, 0x86, 0x84, 0x82, 0x81, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x77, 0x78, 0x79,
-  0x7a, 0x7b, 0x7b, 0x7b, 0x7a, 0x79, 0x79, 0x78, 0x78, 0x79, 0x79, 0x7a,
-  0x7a, 0x7b, 0x7a, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7c,
-  0x7d, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x7b, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x86, 0x87, 0x87, 0x86,
-  0x86, 0x85, 0x84, 0x83, 0x84, 0x84, 0x85, 0x86, 0x87, 0x87, 0x86, 0x86,
-  0x85, 0x86, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x89, 0x88, 0x88,
-  0x87, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x86, 0x85, 0x85,
-  0x85, 0x85, 0x86, 0x86, 0x87, 0x87, 0x86, 0x86, 0x84, 0x83, 0x82, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x79,
-  0x7a, 0x7a, 0x7b, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x77, 0x76, 0x75, 0x75,
-  0x75, 0x75, 0x75, 0x74, 0x73, 0x72, 0x71, 0x71, 0x71, 0x71, 0x72, 0x73,
-  0x75, 0x76, 0x78, 0x79, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x75, 0x75,
-  0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x78, 0x79, 0x79, 0x7b, 0x7c, 0x7e,
-  0x7f, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x82, 0x84,
-  0x85, 0x86, 0x86, 0x86, 0x86, 0x85, 0x86, 0x87, 0x88, 0x89, 0x8a, 0x8b,
-  0x8c, 0x8c, 0x8c, 0x8b, 0x89, 0x89, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8c,
-  0x8d, 0x8d, 0x8c, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8a,
-  0x89, 0x89, 0x88, 0x87, 0x87, 0x87, 0x88, 0x89, 0x89, 0x89, 0x88, 0x87,
-  0x85, 0x84, 0x82, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82, 0x83, 0x84, 0x84,
-  0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7d,
-  0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x78,
-  0x79, 0x79, 0x7b, 0x7c, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x7e, 0x7c, 0x7a,
-  0x79, 0x78, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x7a,
-  0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7a, 0x78, 0x76, 0x75, 0x74,
-  0x74, 0x75, 0x76, 0x77, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x79,
-  0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x79,
-  0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x84, 0x84, 0x86, 0x87, 0x89,
-  0x8a, 0x8b, 0x8b, 0x8a, 0x89, 0x87, 0x86, 0x86, 0x86, 0x88, 0x8a, 0x8c,
-  0x8e, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e, 0x8e,
-  0x8e, 0x8d, 0x8d, 0x8c, 0x8c, 0x8b, 0x8b, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
-  0x8f, 0x8e, 0x8d, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x86, 0x85,
-  0x83, 0x82, 0x80, 0x80, 0x7f, 0x80, 0x81, 0x83, 0x85, 0x86, 0x86, 0x86,
-  0x84, 0x82, 0x80, 0x7e, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x79,
-  0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78,
-  0x77, 0x77, 0x76, 0x76, 0x76, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x75,
-  0x75, 0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x79, 0x79, 0x78, 0x77, 0x75,
-  0x74, 0x74, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x79, 0x79, 0x79, 0x78,
-  0x78, 0x77, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x77, 0x77, 0x78,
-  0x78, 0x79, 0x7a, 0x7b, 0x7b, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x77, 0x78,
-  0x79, 0x7b, 0x7d, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7e, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x84, 0x85, 0x85,
-  0x86, 0x87, 0x88, 0x89, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8b, 0x8c,
-  0x8d, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8d, 0x8d, 0x8e, 0x8f, 0x90, 0x92,
-  0x94, 0x95, 0x95, 0x94, 0x93, 0x91, 0x8f, 0x8e, 0x8e, 0x8e, 0x8f, 0x90,
-  0x91, 0x91, 0x91, 0x91, 0x90, 0x8f, 0x8f, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d,
-  0x8c, 0x8b, 0x8b, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x86, 0x85, 0x84, 0x83,
-  0x81, 0x7f, 0x7e, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7c, 0x7a, 0x78, 0x76, 0x74, 0x72, 0x71, 0x71, 0x71, 0x71, 0x71, 0x70,
-  0x6f, 0x6e, 0x6d, 0x6c, 0x6c, 0x6d, 0x6e, 0x6f, 0x6f, 0x70, 0x70, 0x70,
-  0x70, 0x6f, 0x6f, 0x70, 0x6f, 0x6f, 0x6f, 0x6f, 0x6e, 0x6e, 0x6d, 0x6d,
-  0x6e, 0x6f, 0x70, 0x71, 0x73, 0x75, 0x77, 0x79, 0x7a, 0x7a, 0x79, 0x78,
-  0x77, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7c, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x81, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83,
-  0x83, 0x84, 0x86, 0x87, 0x88, 0x88, 0x88, 0x87, 0x87, 0x86, 0x86, 0x87,
-  0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x87, 0x86, 0x86, 0x86,
-  0x87, 0x88, 0x89, 0x8b, 0x8b, 0x8b, 0x8a, 0x89, 0x88, 0x87, 0x87, 0x86,
-  0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x89, 0x89, 0x8a,
-  0x8a, 0x8a, 0x89, 0x88, 0x87, 0x85, 0x84, 0x83, 0x83, 0x83, 0x84, 0x85,
-  0x87, 0x88, 0x89, 0x89, 0x88, 0x87, 0x86, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x81, 0x82, 0x83, 0x84,
-  0x85, 0x85, 0x84, 0x84, 0x82, 0x81, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c,
-  0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f,
-  0x7d, 0x7b, 0x79, 0x76, 0x74, 0x72, 0x72, 0x72, 0x72, 0x73, 0x74, 0x74,
-  0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x77, 0x77, 0x77, 0x76,
-  0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x75, 0x76, 0x76, 0x77, 0x77, 0x77,
-  0x77, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7f, 0x81, 0x82, 0x84, 0x85, 0x85, 0x85, 0x84,
-  0x83, 0x83, 0x83, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x89, 0x89, 0x89, 0x8a, 0x89, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84,
-  0x84, 0x85, 0x87, 0x88, 0x89, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x85,
-  0x85, 0x84, 0x84, 0x84, 0x83, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x83, 0x82, 0x82, 0x81, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x80,
-  0x81, 0x82, 0x83, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7f, 0x80,
-  0x81, 0x82, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x7e, 0x7d, 0x7b, 0x7b, 0x7a, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c,
-  0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x7b, 0x7a,
-  0x7a, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78, 0x78,
-  0x78, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83,
-  0x83, 0x84, 0x84, 0x85, 0x86, 0x87, 0x87, 0x88, 0x89, 0x89, 0x88, 0x87,
-  0x87, 0x86, 0x87, 0x87, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x88, 0x88,
-  0x88, 0x88, 0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x85, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c,
-  0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x78, 0x77, 0x76, 0x75, 0x75, 0x76, 0x77,
-  0x78, 0x79, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7c, 0x7d,
-  0x7f, 0x81, 0x81, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x86, 0x87,
-  0x87, 0x87, 0x87, 0x85, 0x84, 0x83, 0x82, 0x82, 0x83, 0x84, 0x85, 0x85,
-  0x86, 0x86, 0x85, 0x85, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x84, 0x83, 0x82, 0x81, 0x80, 0x81, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84,
-  0x83, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82,
-  0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7e,
-  0x7e, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7e,
-  0x7d, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x78, 0x78, 0x78,
-  0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x78, 0x76, 0x75, 0x74,
-  0x74, 0x74, 0x74, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x77,
-  0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x78, 0x77, 0x77,
-  0x78, 0x79, 0x7b, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82,
-  0x83, 0x84, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x85, 0x86, 0x87, 0x88,
-  0x8a, 0x8b, 0x8c, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8b, 0x8d,
-  0x8e, 0x8f, 0x90, 0x90, 0x90, 0x8f, 0x8e, 0x8e, 0x8d, 0x8d, 0x8e, 0x8e,
-  0x8e, 0x8e, 0x8d, 0x8c, 0x8b, 0x8a, 0x8a, 0x89, 0x8a, 0x8a, 0x8b, 0x8b,
-  0x8b, 0x8b, 0x8a, 0x89, 0x88, 0x87, 0x86, 0x86, 0x86, 0x85, 0x84, 0x83,
-  0x82, 0x80, 0x7f, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x78, 0x78,
-  0x78, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79, 0x79, 0x78,
-  0x78, 0x77, 0x77, 0x77, 0x77, 0x78, 0x79, 0x7a, 0x7a, 0x7a, 0x79, 0x79,
-  0x78, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7b, 0x7a,
-  0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7a, 0x7a, 0x79,
-  0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x79, 0x79, 0x79,
-  0x7a, 0x7b, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83,
-  0x84, 0x85, 0x86, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86, 0x87, 0x88,
-  0x89, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e,
-  0x8f, 0x90, 0x91, 0x91, 0x90, 0x8f, 0x8d, 0x8c, 0x8c, 0x8b, 0x8c, 0x8c,
-  0x8d, 0x8d, 0x8e, 0x8e, 0x8e, 0x8e, 0x8d, 0x8d, 0x8c, 0x8c, 0x8c, 0x8c,
-  0x8b, 0x8a, 0x8a, 0x88, 0x87, 0x86, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84,
-  0x83, 0x82, 0x80, 0x7f, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f,
-  0x7e, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76,
-  0x75, 0x74, 0x74, 0x73, 0x73, 0x73, 0x73, 0x74, 0x74, 0x75, 0x76, 0x76,
-  0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74, 0x73,
-  0x73, 0x73, 0x73, 0x74, 0x75, 0x77, 0x79, 0x7a, 0x7c, 0x7c, 0x7c, 0x7b,
-  0x7a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x80, 0x80, 0x81, 0x82, 0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x80, 0x7f,
-  0x80, 0x81, 0x82, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x88, 0x89,
-  0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x88, 0x88,
-  0x8a, 0x8b, 0x8c, 0x8d, 0x8d, 0x8c, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a,
-  0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x89, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87,
-  0x88, 0x88, 0x87, 0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x82, 0x81, 0x80,
-  0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e,
-  0x7e, 0x7c, 0x7b, 0x78, 0x76, 0x74, 0x73, 0x72, 0x72, 0x72, 0x73, 0x73,
-  0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x73, 0x74, 0x75, 0x75, 0x75, 0x75,
-  0x74, 0x73, 0x73, 0x72, 0x72, 0x72, 0x72, 0x73, 0x73, 0x74, 0x74, 0x74,
-  0x75, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7d, 0x7c,
-  0x7c, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7f, 0x80, 0x81, 0x82, 0x83, 0x83,
-  0x83, 0x82, 0x83, 0x83, 0x84, 0x84, 0x85, 0x86, 0x86, 0x87, 0x87, 0x87,
-  0x87, 0x87, 0x87, 0x88, 0x88, 0x89, 0x89, 0x89, 0x88, 0x87, 0x86, 0x86,
-  0x85, 0x86, 0x86, 0x87, 0x88, 0x89, 0x89, 0x89, 0x89, 0x88, 0x87, 0x86,
-  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x83, 0x82, 0x81, 0x80,
-  0x80, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f,
-  0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x81, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b,
-  0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x84, 0x84, 0x85, 0x86, 0x86, 0x87, 0x87, 0x87, 0x86,
-  0x85, 0x85, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
-  0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x86, 0x86, 0x85, 0x83, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7c,
-  0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x78, 0x78, 0x79,
-  0x7a, 0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7f,
-  0x80, 0x82, 0x83, 0x83, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x83, 0x84, 0x85,
-  0x85, 0x86, 0x85, 0x85, 0x84, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83,
-  0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x83,
-  0x82, 0x81, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b,
-  0x7b, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x78,
-  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77,
-  0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a, 0x79, 0x79, 0x78,
-  0x78, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f,
-  0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x84, 0x85, 0x86, 0x87, 0x87, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88,
-  0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x8a, 0x8a, 0x8a,
-  0x8b, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x8a,
-  0x8a, 0x8a, 0x89, 0x88, 0x87, 0x87, 0x86, 0x85, 0x85, 0x86, 0x86, 0x86,
-  0x85, 0x84, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b,
-  0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b,
-  0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a,
-  0x7a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c,
-  0x7b, 0x7a, 0x7a, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7b, 0x7b, 0x7a, 0x7a, 0x79,
-  0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x79,
-  0x79, 0x7a, 0x7a, 0x7c, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83,
-  0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x87, 0x87,
-  0x88, 0x89, 0x8a, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8b, 0x8c,
-  0x8c, 0x8d, 0x8e, 0x8f, 0x8f, 0x8f, 0x8e, 0x8d, 0x8c, 0x8c, 0x8b, 0x8b,
-  0x8b, 0x8c, 0x8c, 0x8c, 0x8d, 0x8d, 0x8c, 0x8c, 0x8b, 0x8b, 0x8b, 0x8b,
-  0x8a, 0x8a, 0x89, 0x88, 0x87, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x83, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x77, 0x77, 0x76, 0x76, 0x76,
-  0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-  0x76, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75, 0x76, 0x76, 0x76, 0x76, 0x75,
-  0x74, 0x74, 0x74, 0x74, 0x75, 0x76, 0x77, 0x79, 0x7a, 0x7b, 0x7b, 0x7c,
-  0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x81, 0x81, 0x82, 0x84, 0x84, 0x85, 0x84, 0x84, 0x83, 0x83, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x85, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x88,
-  0x89, 0x89, 0x8a, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x88, 0x87, 0x87, 0x87,
-  0x88, 0x89, 0x8a, 0x8a, 0x8b, 0x8b, 0x8a, 0x8a, 0x89, 0x89, 0x89, 0x89,
-  0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x88, 0x87, 0x86, 0x86, 0x85, 0x85,
-  0x85, 0x86, 0x86, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d,
-  0x7d, 0x7d, 0x7c, 0x7b, 0x79, 0x78, 0x76, 0x75, 0x75, 0x75, 0x75, 0x75,
-  0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76, 0x76,
-  0x76, 0x75, 0x75, 0x74, 0x74, 0x74, 0x74, 0x74, 0x74, 0x75, 0x75, 0x76,
-  0x76, 0x76, 0x76, 0x76, 0x76, 0x77, 0x78, 0x79, 0x7b, 0x7b, 0x7c, 0x7c,
-  0x7b, 0x7b, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85,
-  0x84, 0x84, 0x84, 0x85, 0x86, 0x87, 0x87, 0x88, 0x88, 0x87, 0x87, 0x86,
-  0x85, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x85, 0x85, 0x84, 0x84, 0x83,
-  0x83, 0x83, 0x83, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x85, 0x85, 0x85,
-  0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82,
-  0x83, 0x84, 0x85, 0x85, 0x86, 0x86, 0x85, 0x85, 0x84, 0x83, 0x83, 0x83,
-  0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x78, 0x79, 0x79, 0x79,
-  0x79, 0x79, 0x79, 0x78, 0x78, 0x77, 0x76, 0x76, 0x76, 0x77, 0x78, 0x78,
-  0x79, 0x79, 0x78, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x78,
-  0x78, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x81, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86,
-  0x86, 0x85, 0x85, 0x85, 0x85, 0x86, 0x86, 0x87, 0x87, 0x87, 0x88, 0x88,
-  0x88, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x86,
-  0x85, 0x85, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x83,
-  0x82, 0x82, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d,
-  0x7d, 0x7e, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-  0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x83, 0x84, 0x84,
-  0x84, 0x84, 0x83, 0x83, 0x83, 0x82, 0x83, 0x83, 0x83, 0x84, 0x85, 0x85,
-  0x85, 0x85, 0x84, 0x84, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x85,
-  0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7e, 0x7d,
-  0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c,
-  0x7b, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78,
-  0x79, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7f, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x80,
-  0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84,
-  0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
-  0x86, 0x87, 0x88, 0x88, 0x88, 0x86, 0x85, 0x84, 0x84, 0x85, 0x86, 0x87,
-  0x86, 0x86, 0x85, 0x86, 0x86, 0x85, 0x84, 0x84, 0x85, 0x84, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7e, 0x7d, 0x7e, 0x7f, 0x80,
-  0x81, 0x82, 0x83, 0x82, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7f, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7b, 0x7b, 0x7a, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7b,
-  0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7c, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x84, 0x85, 0x85, 0x85, 0x85,
-  0x86, 0x86, 0x87, 0x87, 0x87, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x88,
-  0x88, 0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8c, 0x8c, 0x8b, 0x89, 0x88, 0x88,
-  0x88, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x8a, 0x89, 0x89, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x87, 0x87, 0x86, 0x86, 0x85, 0x84, 0x83, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7f,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x79,
-  0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b,
-  0x7b, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7e, 0x7f,
-  0x80, 0x80, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7e,
-  0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x82,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x84,
-  0x84, 0x85, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86,
-  0x86, 0x87, 0x87, 0x88, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x89,
-  0x89, 0x8a, 0x8b, 0x8c, 0x8c, 0x8c, 0x8c, 0x8c, 0x8b, 0x8a, 0x89, 0x88,
-  0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87,
-  0x86, 0x85, 0x83, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x82, 0x81, 0x80, 0x7f, 0x7d, 0x7b, 0x79, 0x78, 0x77, 0x77,
-  0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x76, 0x76, 0x76, 0x76, 0x76,
-  0x77, 0x78, 0x78, 0x78, 0x77, 0x77, 0x76, 0x76, 0x75, 0x75, 0x74, 0x74,
-  0x73, 0x73, 0x73, 0x74, 0x74, 0x75, 0x76, 0x78, 0x79, 0x7a, 0x7b, 0x7b,
-  0x7b, 0x7a, 0x7a, 0x79, 0x78, 0x78, 0x78, 0x79, 0x7a, 0x7b, 0x7d, 0x7e,
-  0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-  0x81, 0x82, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x85, 0x85, 0x86, 0x86, 0x85, 0x85,
-  0x85, 0x84, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85,
-  0x84, 0x83, 0x82, 0x82, 0x81, 0x82, 0x83, 0x84, 0x86, 0x87, 0x88, 0x88,
-  0x89, 0x89, 0x88, 0x87, 0x86, 0x85, 0x84, 0x83, 0x82, 0x82, 0x81, 0x81,
-  0x82, 0x83, 0x84, 0x85, 0x86, 0x87, 0x87, 0x87, 0x86, 0x86, 0x85, 0x85,
-  0x85, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x81, 0x81,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7c, 0x7b, 0x7a, 0x78, 0x77, 0x76, 0x76, 0x76, 0x76,
-  0x77, 0x77, 0x78, 0x79, 0x79, 0x79, 0x78, 0x77, 0x76, 0x76, 0x75, 0x75,
-  0x76, 0x76, 0x77, 0x77, 0x78, 0x78, 0x79, 0x79, 0x79, 0x78, 0x78, 0x78,
-  0x78, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x83, 0x84,
-  0x85, 0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x87, 0x88,
-  0x89, 0x8a, 0x8a, 0x8b, 0x8a, 0x8a, 0x8a, 0x89, 0x88, 0x88, 0x87, 0x87,
-  0x87, 0x87, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89, 0x88, 0x87,
-  0x86, 0x85, 0x85, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x81, 0x80, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x81,
-  0x80, 0x80, 0x7f, 0x7e, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79,
-  0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b,
-  0x7b, 0x7b, 0x7c, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x83,
-  0x83, 0x84, 0x83, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81,
-  0x82, 0x82, 0x83, 0x84, 0x84, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78,
-  0x79, 0x79, 0x7a, 0x7b, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7c, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c,
-  0x7d, 0x7d, 0x7e, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84, 0x84,
-  0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x85, 0x85, 0x85, 0x86, 0x86, 0x85, 0x85, 0x85, 0x84, 0x84, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x80,
-  0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f,
-  0x80, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x7a, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84,
-  0x85, 0x85, 0x85, 0x86, 0x86, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
-  0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x89, 0x89, 0x89, 0x89,
-  0x89, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-  0x86, 0x86, 0x85, 0x85, 0x84, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b,
-  0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7c,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b,
-  0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x83, 0x84, 0x85, 0x85, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86,
-  0x86, 0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x88, 0x88, 0x88, 0x88,
-  0x89, 0x89, 0x89, 0x89, 0x89, 0x89, 0x8a, 0x89, 0x89, 0x89, 0x88, 0x88,
-  0x87, 0x87, 0x86, 0x85, 0x85, 0x85, 0x84, 0x85, 0x85, 0x85, 0x86, 0x86,
-  0x86, 0x86, 0x85, 0x84, 0x83, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7a,
-  0x79, 0x78, 0x78, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x78, 0x78, 0x78,
-  0x78, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x78,
-  0x78, 0x77, 0x76, 0x76, 0x77, 0x77, 0x78, 0x79, 0x7a, 0x7b, 0x7c, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x82,
-  0x83, 0x84, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x85, 0x85,
-  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x82, 0x81, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b,
-  0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x7a, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84,
-  0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x84, 0x84,
-  0x84, 0x83, 0x83, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x81, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x82, 0x82, 0x81, 0x80, 0x7f, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x82, 0x83, 0x83, 0x83, 0x84, 0x85, 0x85, 0x86, 0x86, 0x87, 0x87, 0x87,
-  0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x86, 0x85, 0x85, 0x84, 0x83,
-  0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b,
-  0x7a, 0x7a, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b,
-  0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x7a, 0x79, 0x79,
-  0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x7a, 0x7a, 0x7a, 0x7a,
-  0x7a, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7b, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x84, 0x84, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
-  0x87, 0x87, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86, 0x86,
-  0x86, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 0x84, 0x84, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x86, 0x86, 0x86, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87, 0x87,
-  0x87, 0x87, 0x86, 0x86, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x85, 0x85, 0x85, 0x85, 0x85, 0x84, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7b, 0x7b, 0x7a, 0x7a, 0x7b, 0x7b, 0x7b,
-  0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7c, 0x7b, 0x7a, 0x7a, 0x79, 0x79, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x83, 0x84, 0x85, 0x86, 0x86, 0x86, 0x86, 0x85, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x86,
-  0x87, 0x87, 0x87, 0x88, 0x88, 0x87, 0x87, 0x87, 0x87, 0x86, 0x86, 0x86,
-  0x86, 0x85, 0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b,
-  0x7b, 0x7b, 0x7b, 0x7a, 0x7a, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79, 0x79,
-  0x79, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x79, 0x7a, 0x7a,
-  0x7a, 0x7a, 0x79, 0x79, 0x78, 0x78, 0x78, 0x78, 0x79, 0x79, 0x7a, 0x7b,
-  0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x85, 0x85, 0x84, 0x84, 0x84, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83, 0x82, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x85,
-  0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x81, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x83, 0x84, 0x84, 0x85, 0x85, 0x85,
-  0x85, 0x85, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83,
-  0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b,
-  0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7b, 0x7b,
-  0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x83, 0x83,
-  0x83, 0x84, 0x84, 0x84, 0x85, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7b, 0x7c, 0x7c, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7b, 0x7b, 0x7a, 0x7a, 0x7a, 0x7b, 0x7b, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x84, 0x84, 0x85, 0x85, 0x86, 0x86, 0x86, 0x86, 0x85, 0x85, 0x85,
-  0x85, 0x85, 0x85, 0x85, 0x85, 0x85, 0x86, 0x85, 0x85, 0x85, 0x85, 0x85,
-  0x85, 0x85, 0x86, 0x86, 0x85, 0x85, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x80, 0x80, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x83, 0x83, 0x82, 0x83, 0x83, 0x83, 0x83, 0x84, 0x83, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7b, 0x7b, 0x7b,
-  0x7b, 0x7b, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c, 0x7c,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83,
-  0x83, 0x84, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x83, 0x84, 0x84,
-  0x84, 0x85, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x85, 0x85, 0x85,
-  0x85, 0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x84,
-  0x84, 0x84, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7c, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81,
-  0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7c, 0x7d, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x84, 0x84, 0x85, 0x85, 0x84, 0x84, 0x84, 0x83, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x83, 0x83, 0x83,
-  0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x84, 0x84, 0x84, 0x84, 0x84, 0x84,
-  0x84, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7d,
-  0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7c,
-  0x7c, 0x7c, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7c, 0x7c, 0x7c,
-  0x7c, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83, 0x83,
-  0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83,
-  0x83, 0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7d, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7d, 0x7d, 0x7d,
-  0x7d, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x83, 0x83,
-  0x83, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x82,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x82,
-  0x82, 0x82, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82,
-  0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e,
-  0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7e,
-  0x7e, 0x7e, 0x7e, 0x7e, 0x7e, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x82, 0x82, 0x82, 0x82, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x7f,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x81, 0x81, 0x81,
-  0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x7f, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x7f, 0x7f, 0x7f, 0x7f, 0x7f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
-  0x80, 0x80
+// generated by tools/wav2asset.py from 734443__universfield__system-notification-4.wav, do not edit
+// 31104 samples at 44100 Hz, adpcm, 15552 bytes
+#pragma once
+
+#include "sound_asset.h"
+
+static const uint8_t sound_system_notification_4_data[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf7, 0x72, 0x7b, 0x7f, 0xf4,
+  0x7a, 0x89, 0xb0, 0x51, 0x0d, 0x81, 0xa0, 0x4a, 0x82, 0x1b, 0x7d, 0x19,
+  0x89, 0x49, 0x99, 0x85, 0x19, 0xba, 0x87, 0x89, 0x93, 0xb0, 0x3a, 0x82,
+  0x1c, 0x84, 0x0c, 0xa4, 0xe8, 0x20, 0xa5, 0x81, 0x88, 0xd1, 0x21, 0x98,
+  0x08, 0x2a, 0x0b, 0x31, 0xfb, 0x28, 0x01, 0xf9, 0x4a, 0x80, 0x02, 0x1a,
+  0x2a, 0x25, 0x0e, 0x18, 0x90, 0x31, 0x83, 0xbb, 0xa8, 0x89, 0xc3, 0xe9,
+  0x68, 0xb1, 0x9c, 0x18, 0x13, 0x88, 0xbc, 0x12, 0x32, 0x14, 0x15, 0xb0,
+  0x08, 0x93, 0x28, 0x57, 0x00, 0xa8, 0x0e, 0x38, 0xa2, 0x8e, 0x01, 0x80,
+  0x19, 0xb9, 0x49, 0xa2, 0x0f, 0x11, 0x8b, 0x51, 0xb8, 0x1b, 0x10, 0xda,
+  0xb9, 0x9d, 0x45, 0xb1, 0x9c, 0x00, 0x99, 0x21, 0x18, 0x25, 0xa1, 0x1c,
+  0x25, 0x01, 0x42, 0xc1, 0x1c, 0x34, 0x01, 0x88, 0xab, 0x30, 0xf9, 0x1b,
+  0x33, 0xe0, 0x0a, 0x99, 0x08, 0x80, 0x99, 0x12, 0x3a, 0x17, 0xe9, 0x0b,
+  0x44, 0xa8, 0x9a, 0x10, 0x02, 0xd9, 0x2b, 0x07, 0xbb, 0x8a, 0x02, 0x72,
+  0x81, 0xa9, 0x8a, 0x18, 0x36, 0xa0, 0x39, 0x93, 0xbd, 0x39, 0x13, 0x04,
+  0xbf, 0x0a, 0x33, 0x9a, 0x11, 0xda, 0x2a, 0x83, 0x1b, 0x36, 0x28, 0x16,
+  0xda, 0x38, 0x06, 0x8a, 0x20, 0x83, 0x00, 0xdc, 0x29, 0x04, 0x99, 0x88,
+  0xdb, 0x19, 0x82, 0xa8, 0x08, 0xcc, 0x99, 0xab, 0x74, 0x84, 0xbc, 0x19,
+  0x10, 0x11, 0x81, 0x09, 0xa1, 0x9e, 0x42, 0xa2, 0x38, 0xb3, 0xae, 0x43,
+  0x12, 0x81, 0xaa, 0x72, 0x03, 0xbb, 0x71, 0x92, 0x00, 0x80, 0xab, 0x13,
+  0xab, 0x45, 0xb8, 0x8b, 0xf8, 0x8d, 0x43, 0x80, 0x9a, 0xbb, 0x4a, 0x03,
+  0x0b, 0x43, 0xfb, 0x1b, 0x01, 0x31, 0x82, 0xcd, 0x09, 0x88, 0x63, 0x81,
+  0xab, 0x20, 0xa8, 0x20, 0x22, 0x35, 0xc3, 0x9d, 0x53, 0xb1, 0x19, 0x03,
+  0x08, 0x04, 0xae, 0x10, 0x81, 0x52, 0xe1, 0x8c, 0x11, 0x80, 0x38, 0x81,
+  0xa9, 0xec, 0x2a, 0x36, 0xa0, 0x99, 0xb9, 0x1a, 0x53, 0x81, 0x90, 0xbb,
+  0x3a, 0x93, 0x5c, 0x17, 0xe9, 0x09, 0x11, 0x10, 0x90, 0x9a, 0x12, 0xea,
+  0x29, 0xa3, 0x0b, 0x15, 0xdb, 0x18, 0x98, 0x30, 0xb2, 0x5a, 0x05, 0xcc,
+  0x38, 0x14, 0x11, 0xa0, 0x9b, 0x41, 0x00, 0x73, 0x91, 0xbb, 0x00, 0x9b,
+  0x64, 0x82, 0xaa, 0xdb, 0x2a, 0x26, 0xa9, 0x18, 0xa0, 0x8b, 0x02, 0x31,
+  0x05, 0xdc, 0x08, 0xa1, 0x2a, 0x03, 0xbe, 0x18, 0xb1, 0x9a, 0xba, 0x71,
+  0x06, 0xba, 0x28, 0x92, 0x19, 0x26, 0x11, 0x00, 0xbd, 0x41, 0x02, 0x31,
+  0xb3, 0xff, 0x28, 0x01, 0x08, 0x88, 0x9a, 0x90, 0x9c, 0x46, 0x91, 0x9a,
+  0x81, 0x89, 0x44, 0x80, 0x00, 0xa9, 0x3a, 0x84, 0x9e, 0x41, 0xb0, 0x8b,
+  0x88, 0x19, 0x92, 0x9e, 0x53, 0xc0, 0x0b, 0x12, 0x09, 0x46, 0xa9, 0x9a,
+  0xa0, 0x58, 0x84, 0xab, 0x01, 0xfb, 0x1b, 0x22, 0x00, 0xb8, 0xaf, 0x31,
+  0x81, 0x51, 0x82, 0x8c, 0x31, 0x11, 0x52, 0x02, 0x00, 0xb0, 0x8d, 0x45,
+  0xb0, 0x0a, 0x01, 0x9b, 0x98, 0xac, 0x53, 0xb0, 0x1b, 0xa4, 0x9f, 0x32,
+  0xa0, 0x38, 0xc0, 0x9b, 0xb8, 0x3c, 0x37, 0xfa, 0x8b, 0x91, 0x88, 0x23,
+  0xa8, 0x89, 0xcc, 0x50, 0x04, 0x18, 0x13, 0xda, 0x48, 0x23, 0x02, 0x90,
+  0x8b, 0x24, 0xda, 0x48, 0xa3, 0xac, 0x00, 0xbb, 0x21, 0xa8, 0x4a, 0xc2,
+  0x0d, 0x14, 0xdb, 0x60, 0x02, 0x88, 0x98, 0x0a, 0x33, 0x90, 0x51, 0xc8,
+  0x9e, 0x10, 0x88, 0x32, 0xd8, 0x9c, 0x98, 0x40, 0x15, 0xc9, 0x08, 0x90,
+  0x09, 0x43, 0x80, 0xa0, 0xcd, 0x39, 0xa2, 0x9a, 0x82, 0xcd, 0x18, 0x91,
+  0x19, 0x11, 0x68, 0x24, 0xbb, 0x73, 0x04, 0x18, 0x14, 0x00, 0x80, 0x8a,
+  0x73, 0x82, 0x8a, 0xa8, 0xbe, 0x30, 0x92, 0x99, 0xe9, 0x9a, 0x81, 0x8a,
+  0x45, 0xd8, 0x9b, 0x11, 0x00, 0x23, 0xda, 0x09, 0xd9, 0x29, 0x03, 0xac,
+  0x31, 0xd9, 0x0c, 0x22, 0x00, 0x82, 0x8a, 0x47, 0xb1, 0x29, 0x16, 0x00,
+  0x11, 0xa9, 0x28, 0x82, 0x30, 0x94, 0xdf, 0x08, 0xb8, 0x39, 0x15, 0xba,
+  0xa9, 0x9c, 0x73, 0x01, 0x19, 0x02, 0xbb, 0x54, 0x01, 0x20, 0xb1, 0x9c,
+  0x02, 0x8a, 0x26, 0xf9, 0x8a, 0x80, 0x9a, 0x00, 0xa8, 0x32, 0xfa, 0x1c,
+  0x02, 0x9b, 0x43, 0x90, 0x19, 0xc0, 0x1b, 0x22, 0x89, 0x24, 0xfe, 0x1a,
+  0x13, 0x08, 0x11, 0xb9, 0x18, 0x00, 0x67, 0x04, 0x98, 0x10, 0x90, 0x51,
+  0x04, 0x80, 0x90, 0x0b, 0x12, 0xdb, 0x18, 0xd2, 0xad, 0x08, 0x98, 0x89,
+  0xc9, 0x1b, 0xd1, 0x9b, 0x43, 0xb8, 0x61, 0x91, 0xba, 0x10, 0x28, 0x45,
+  0xb8, 0x28, 0xd2, 0x9e, 0x42, 0x80, 0x08, 0xb9, 0x1a, 0x16, 0x18, 0x14,
+  0xca, 0x29, 0x04, 0x28, 0x15, 0x99, 0x89, 0xcb, 0x60, 0x92, 0x9b, 0x01,
+  0xd9, 0x18, 0x90, 0x29, 0x84, 0x0a, 0x25, 0xaa, 0x73, 0x83, 0x0a, 0x12,
+  0xa8, 0x80, 0x09, 0x46, 0xd0, 0x9f, 0x08, 0x99, 0x28, 0xa0, 0xbb, 0xbb,
+  0x8c, 0x33, 0xa0, 0x60, 0xe0, 0x0b, 0x44, 0x81, 0x00, 0x99, 0x20, 0x02,
+  0x59, 0x25, 0xb9, 0x29, 0xa2, 0x39, 0x37, 0x88, 0x13, 0xa8, 0x63, 0xb0,
+  0x3a, 0x37, 0xb8, 0x09, 0xa8, 0x0a, 0xb2, 0x8d, 0xb0, 0xef, 0x08, 0x90,
+  0x09, 0x91, 0xbd, 0x89, 0x10, 0x44, 0x91, 0x0c, 0x11, 0xaa, 0x54, 0x02,
+  0x08, 0xb8, 0x2b, 0x34, 0xa9, 0x11, 0xf8, 0x0c, 0x13, 0x9a, 0x22, 0x98,
+  0x20, 0xfa, 0x48, 0x24, 0x99, 0x52, 0x91, 0x9a, 0x80, 0x38, 0x27, 0xa9,
+  0x80, 0xf9, 0x2a, 0x14, 0x99, 0x88, 0xa8, 0x19, 0x23, 0x72, 0x94, 0xae,
+  0x28, 0x81, 0x20, 0x91, 0xbc, 0xba, 0x9d, 0x11, 0xd8, 0x0b, 0xb0, 0xbf,
+  0x21, 0x91, 0x89, 0x80, 0x48, 0x05, 0x1a, 0x55, 0x81, 0x28, 0x03, 0x89,
+  0x35, 0x10, 0x23, 0xd8, 0x1a, 0xb0, 0x0c, 0x55, 0xa0, 0x8b, 0x99, 0x28,
+  0x15, 0x99, 0x21, 0xec, 0x29, 0x03, 0x88, 0x90, 0xce, 0x8a, 0x80, 0x28,
+  0xc1, 0xae, 0x08, 0xb9, 0x39, 0x03, 0x10, 0x81, 0x8a, 0x67, 0x80, 0x20,
+  0x13, 0x89, 0x14, 0xa8, 0x30, 0x93, 0x99, 0xfb, 0xaf, 0x31, 0xa8, 0x29,
+  0xa3, 0xaf, 0x00, 0x21, 0x37, 0x90, 0x19, 0x92, 0x3a, 0x37, 0xa1, 0x19,
+  0x98, 0x19, 0x01, 0x0c, 0x03, 0xff, 0x09, 0x01, 0x89, 0x00, 0xba, 0x08,
+  0xa9, 0x49, 0x83, 0x0c, 0x25, 0xcd, 0x19, 0x92, 0x8a, 0x91, 0x9a, 0xa1,
+  0xdf, 0x30, 0x82, 0x9a, 0x01, 0xba, 0x74, 0x22, 0x41, 0x80, 0x09, 0x34,
+  0x20, 0x64, 0x82, 0x9a, 0x88, 0x18, 0x33, 0xda, 0x1b, 0xc9, 0xac, 0x11,
+  0xba, 0x09, 0xe9, 0x0c, 0x01, 0x80, 0x32, 0xcd, 0x38, 0xa1, 0x9e, 0x12,
+  0x10, 0x91, 0xed, 0x09, 0x90, 0x1a, 0x33, 0xca, 0x0a, 0xb1, 0x7a, 0x14,
+  0x01, 0x82, 0xac, 0x73, 0x04, 0x88, 0x01, 0x99, 0x28, 0x88, 0x53, 0xb1,
+  0x9f, 0x80, 0x9a, 0x31, 0xa1, 0x8b, 0x21, 0x1a, 0x04, 0xaa, 0x77, 0x91,
+  0x0a, 0x13, 0x98, 0x11, 0xa0, 0x09, 0xfb, 0x9d, 0x81, 0x99, 0x11, 0xfb,
+  0x8e, 0x00, 0x00, 0x01, 0xa8, 0x10, 0xb9, 0x49, 0x27, 0x98, 0x08, 0xb9,
+  0x38, 0x05, 0x89, 0x98, 0xad, 0x41, 0xa1, 0x28, 0x17, 0x98, 0x10, 0x02,
+  0x55, 0x82, 0x28, 0x15, 0x99, 0x10, 0x88, 0x40, 0xb3, 0xcc, 0xa9, 0xad,
+  0x20, 0xd8, 0x9b, 0xa0, 0xad, 0x28, 0x81, 0x23, 0xec, 0x0b, 0x14, 0x00,
+  0x33, 0xc8, 0x8b, 0x91, 0x2a, 0x15, 0x8a, 0x82, 0xde, 0x29, 0x14, 0xa9,
+  0x28, 0x81, 0x42, 0x81, 0x68, 0x15, 0x89, 0x12, 0xa8, 0x48, 0x13, 0x99,
+  0x08, 0xcd, 0x9a, 0xbb, 0x70, 0x84, 0xbc, 0x08, 0x98, 0x42, 0x13, 0x00,
+  0x81, 0x9b, 0x47, 0x82, 0x10, 0xc2, 0xae, 0x10, 0x01, 0x88, 0xcd, 0x8b,
+  0x98, 0xac, 0x30, 0xb8, 0x1b, 0xc8, 0x3b, 0x25, 0x89, 0x44, 0x90, 0x51,
+  0x92, 0x8a, 0x35, 0x81, 0x80, 0xeb, 0x38, 0x04, 0x0a, 0x24, 0xda, 0x19,
+  0x11, 0x72, 0x13, 0xa8, 0x00, 0x99, 0x73, 0x86, 0x8a, 0x80, 0xa9, 0x88,
+  0xa0, 0x08, 0xfb, 0x9e, 0x00, 0x98, 0x08, 0xa0, 0x9c, 0x21, 0x88, 0x42,
+  0x80, 0x54, 0x91, 0x9b, 0x35, 0x98, 0x38, 0x82, 0x8a, 0xf9, 0x9b, 0x42,
+  0xb8, 0x09, 0xf9, 0x0b, 0x44, 0x80, 0x01, 0xa8, 0x39, 0x14, 0x50, 0x26,
+  0xb9, 0x0a, 0x00, 0x20, 0x95, 0xba, 0x88, 0xcb, 0x38, 0xa2, 0x8c, 0x15,
+  0xcb, 0x41, 0x03, 0x41, 0xa1, 0x2b, 0x26, 0xca, 0x29, 0x81, 0x09, 0xf0,
+  0xad, 0x09, 0xba, 0x11, 0xd0, 0x9c, 0x88, 0x9b, 0x51, 0x13, 0x08, 0xa8,
+  0x5b, 0x47, 0x80, 0x20, 0x90, 0x09, 0x23, 0x11, 0x23, 0xdb, 0x8a, 0xb8,
+  0x5a, 0x17, 0xba, 0x29, 0x82, 0x08, 0x01, 0x48, 0x16, 0xb9, 0x48, 0x91,
+  0x0e, 0x02, 0xab, 0x0a, 0xcc, 0x8b, 0xa8, 0x2a, 0xc2, 0xef, 0x18, 0x00,
+  0x10, 0x12, 0x9a, 0x11, 0x09, 0x66, 0x01, 0x19, 0x90, 0x8c, 0x43, 0x91,
+  0xa9, 0xc9, 0x0a, 0x83, 0xbc, 0x43, 0xc8, 0x1c, 0x01, 0x30, 0x25, 0x98,
+  0x62, 0x80, 0x29, 0x03, 0x0c, 0x35, 0xa8, 0x8c, 0xb8, 0x1a, 0x83, 0xcc,
+  0x20, 0xfb, 0x0a, 0x23, 0x28, 0x02, 0xdd, 0x38, 0x01, 0x42, 0x94, 0xad,
+  0x18, 0xa8, 0x19, 0x82, 0xbc, 0xdb, 0xad, 0x22, 0xc1, 0x0b, 0x01, 0x8c,
+  0x43, 0x81, 0x52, 0x02, 0x48, 0x04, 0x09, 0x46, 0x90, 0x39, 0x01, 0x9a,
+  0x88, 0x09, 0x54, 0xc9, 0x8b, 0xa0, 0x8c, 0x35, 0xa8, 0x09, 0xa8, 0x4b,
+  0x84, 0x18, 0x04, 0xed, 0x1a, 0x02, 0x98, 0x98, 0xcc, 0x09, 0xba, 0x49,
+  0x91, 0xab, 0x31, 0xbc, 0x72, 0x03, 0x10, 0x12, 0x21, 0x37, 0xa9, 0x50,
+  0x03, 0x8a, 0x80, 0xaa, 0x20, 0xb0, 0x1c, 0xd1, 0xbf, 0x10, 0x90, 0x62,
+  0xa3, 0x9b, 0x08, 0x40, 0x37, 0x98, 0x29, 0x91, 0x9b, 0x35, 0x90, 0x88,
+  0xfb, 0x0b, 0x82, 0x0a, 0x93, 0xdf, 0x18, 0x92, 0x89, 0x11, 0x80, 0x12,
+  0xcd, 0x58, 0xa2, 0x0b, 0x13, 0xba, 0x89, 0xdc, 0x18, 0x82, 0x0a, 0xa8,
+  0xef, 0x31, 0x84, 0x08, 0x02, 0x09, 0x22, 0x43, 0x46, 0x92, 0x8b, 0x21,
+  0x88, 0x45, 0xa0, 0xab, 0xa0, 0x0a, 0x82, 0xbd, 0x21, 0xfa, 0x8d, 0x22,
+  0x98, 0x08, 0xb8, 0x58, 0xa0, 0x8c, 0x14, 0xa9, 0x30, 0xe9, 0x8c, 0x81,
+  0x89, 0x02, 0xea, 0x18, 0xc8, 0x2b, 0x37, 0x98, 0x08, 0x99, 0x62, 0x13,
+  0x80, 0x84, 0xbb, 0x51, 0x82, 0x29, 0x95, 0xac, 0x89, 0x88, 0x35, 0xd8,
+  0x0b, 0x12, 0xaa, 0x42, 0x81, 0x40, 0x91, 0x2a, 0x16, 0x9a, 0x63, 0xb8,
+  0x1a, 0x92, 0xcc, 0x19, 0x09, 0x11, 0xfe, 0x89, 0x01, 0x89, 0x21, 0xb8,
+  0x8b, 0x08, 0x58, 0x15, 0x90, 0x88, 0xfa, 0x38, 0x06, 0x99, 0x88, 0x9a,
+  0x28, 0xa1, 0x48, 0x84, 0xbc, 0x31, 0x83, 0x72, 0x03, 0x09, 0x33, 0x10,
+  0x63, 0x98, 0x58, 0x84, 0xbb, 0x08, 0xb8, 0x29, 0xe8, 0x8b, 0xb1, 0xcf,
+  0x20, 0x90, 0x18, 0xc0, 0x9d, 0x31, 0x01, 0x14, 0xd9, 0x0a, 0x82, 0x8b,
+  0x26, 0xb8, 0x9a, 0xeb, 0x20, 0x13, 0xab, 0x00, 0xca, 0x78, 0x03, 0x09,
+  0x24, 0x80, 0x23, 0x89, 0x73, 0x84, 0x8b, 0x32, 0xb9, 0x8c, 0x98, 0x30,
+  0xc3, 0xaf, 0x08, 0xcb, 0x61, 0x82, 0x9a, 0x20, 0x98, 0x61, 0x11, 0x32,
+  0xe1, 0xac, 0x33, 0x81, 0x18, 0xda, 0xac, 0x80, 0xa9, 0x21, 0xea, 0x8a,
+  0xb0, 0x0e, 0x25, 0xb8, 0x18, 0x91, 0x50, 0x92, 0x0b, 0x35, 0xa9, 0x29,
+  0xa0, 0x0c, 0x15, 0xa9, 0x22, 0xcc, 0x39, 0xa2, 0x79, 0x24, 0xa8, 0x1a,
+  0x22, 0x73, 0x84, 0x8a, 0x12, 0xba, 0x51, 0x81, 0x8a, 0xe8, 0xbb, 0x18,
+  0x98, 0x88, 0xfa, 0x9e, 0x11, 0xa8, 0x28, 0x81, 0x08, 0x90, 0x3b, 0x37,
+  0xa9, 0x48, 0x92, 0x8b, 0x84, 0xca, 0x31, 0x90, 0x08, 0xfc, 0x3b, 0x25,
+  0xa8, 0x20, 0x82, 0x1b, 0x34, 0x52, 0x17, 0xb9, 0x18, 0x90, 0x40, 0x85,
+  0xca, 0x89, 0x98, 0x08, 0x91, 0x0c, 0xa2, 0xcf, 0x31, 0x82, 0x28, 0x90,
+  0x0c, 0x15, 0x90, 0x22, 0xa2, 0x2c, 0x94, 0x9f, 0x28, 0xa8, 0x89, 0xc8,
+  0x0b, 0xa0, 0xaf, 0x31, 0x92, 0x8b, 0xa8, 0x0a, 0x67, 0x80, 0x11, 0xb8,
+  0x39, 0x24, 0x08, 0x34, 0xc8, 0xab, 0x00, 0x73, 0x83, 0xdb, 0x10, 0x91,
+  0x28, 0x15, 0x08, 0x01, 0xa8, 0x41, 0x83, 0x30, 0xa1, 0xff, 0x10, 0xb0,
+  0x9b, 0x98, 0x09, 0xea, 0xad, 0x18, 0x98, 0x19, 0x83, 0xae, 0x22, 0x90,
+  0x63, 0x03, 0x18, 0xb1, 0x0f, 0x26, 0x91, 0x89, 0x90, 0x0a, 0x03, 0x98,
+  0x43, 0xf9, 0x1b, 0x81, 0x20, 0x25, 0xc8, 0x19, 0x12, 0x48, 0x82, 0x9b,
+  0x36, 0xda, 0x19, 0x81, 0x09, 0xb1, 0xac, 0x28, 0xdb, 0x0a, 0x83, 0x88,
+  0x16, 0xec, 0x18, 0x13, 0x23, 0xb1, 0x9d, 0x21, 0xb9, 0x4a, 0x05, 0xda,
+  0xb9, 0xaa, 0x52, 0xa0, 0x9b, 0xe8, 0x0a, 0x43, 0xa0, 0x21, 0x84, 0x09,
+  0x22, 0x61, 0x17, 0xb0, 0x28, 0x83, 0x09, 0x13, 0x9a, 0x33, 0xd0, 0x8c,
+  0x88, 0x1d, 0x25, 0xdb, 0x28, 0xa1, 0x89, 0x12, 0x28, 0x04, 0xef, 0x29,
+  0x01, 0x88, 0x91, 0xbd, 0x09, 0xa0, 0x38, 0xb0, 0x8b, 0xc1, 0x9f, 0x52,
+  0x83, 0x99, 0x10, 0x28, 0x26, 0x90, 0x32, 0x82, 0x8b, 0x14, 0x8a, 0x34,
+  0xc0, 0x9a, 0xb9, 0xab, 0x04, 0xbe, 0x73, 0xa2, 0x9d, 0x10, 0x20, 0x24,
+  0xa8, 0x18, 0xa2, 0x1a, 0x47, 0x98, 0x18, 0xfa, 0x0a, 0x12, 0x10, 0xc1,
+  0xbe, 0x28, 0x91, 0x89, 0x33, 0xab, 0x88, 0xac, 0x72, 0x82, 0x0b, 0x01,
+  0x9e, 0x32, 0xc0, 0x8b, 0x81, 0x98, 0xb9, 0xaf, 0x72, 0x90, 0x09, 0x03,
+  0x8a, 0x52, 0x12, 0x35, 0x02, 0x8a, 0x81, 0x50, 0x37, 0xb0, 0x8b, 0x80,
+  0x80, 0x80, 0x9b, 0xa0, 0xff, 0x89, 0x21, 0x88, 0xa8, 0xda, 0x19, 0x02,
+  0x18, 0x92, 0x8c, 0x22, 0xdc, 0x2a, 0x23, 0xaa, 0xb8, 0x8b, 0x52, 0xf9,
+  0x1a, 0x24, 0x0a, 0x20, 0xab, 0x74, 0x14, 0x18, 0x90, 0x09, 0x73, 0x80,
+  0x38, 0x83, 0xcd, 0x09, 0x08, 0x33, 0xf9, 0x9a, 0x88, 0x89, 0x42, 0xb8,
+  0x09, 0x92, 0x1b, 0x37, 0x38, 0x13, 0xec, 0x49, 0x12, 0xa9, 0x10, 0x98,
+  0x08, 0xec, 0x0a, 0x92, 0x8a, 0x01, 0xec, 0x18, 0xa1, 0x09, 0x42, 0x01,
+  0x98, 0x9f, 0x60, 0x03, 0xa9, 0x90, 0x9a, 0x31, 0x82, 0x31, 0xd1, 0xad,
+  0x88, 0x31, 0x75, 0x81, 0x9b, 0x30, 0x13, 0x16, 0x88, 0x30, 0x92, 0xab,
+  0x34, 0x90, 0x99, 0xed, 0x8a, 0xa1, 0xca, 0x09, 0xdb, 0x88, 0xd8, 0x9d,
+  0x21, 0x82, 0x11, 0xca, 0x28, 0x85, 0x1a, 0x36, 0x98, 0x88, 0xaa, 0x60,
+  0x04, 0x98, 0x99, 0xbb, 0x72, 0x82, 0x0a, 0x13, 0xbb, 0x80, 0x43, 0x37,
+  0xa1, 0x8c, 0x21, 0x99, 0x41, 0xb8, 0x1b, 0x91, 0xbd, 0x98, 0x9d, 0x23,
+  0xf8, 0x0c, 0x21, 0x98, 0x38, 0x12, 0x24, 0xd0, 0x8b, 0x45, 0x11, 0x11,
+  0xf9, 0x8a, 0x01, 0x89, 0x10, 0xaa, 0xcb, 0xcd, 0x19, 0x34, 0xca, 0x8a,
+  0x89, 0x41, 0x13, 0x19, 0x32, 0xbb, 0x71, 0x03, 0x51, 0x85, 0x9a, 0x10,
+  0x00, 0x33, 0xe8, 0x39, 0x24, 0xca, 0x19, 0x81, 0x61, 0x80, 0x0c, 0x01,
+  0xa9, 0x41, 0xb8, 0x0a, 0xf1, 0xae, 0x10, 0x00, 0x88, 0xdd, 0x8a, 0x81,
+  0x89, 0x31, 0xa8, 0x0a, 0xb0, 0x71, 0x25, 0x81, 0x10, 0x0a, 0x71, 0x14,
+  0x8a, 0x10, 0x08, 0x08, 0x99, 0x40, 0x94, 0xcc, 0x08, 0x90, 0x1a, 0x01,
+  0x88, 0x07, 0xb8, 0x0b, 0x98, 0x73, 0x86, 0xaa, 0x18, 0x90, 0x18, 0x81,
+  0x09, 0xe1, 0x9f, 0x40, 0x81, 0x10, 0xc9, 0x8b, 0x42, 0x82, 0x11, 0xb1,
+  0x89, 0xd3, 0x8d, 0x44, 0x98, 0x9b, 0xaa, 0x29, 0xa3, 0xce, 0x00, 0x99,
+  0x89, 0xb3, 0x1b, 0x67, 0x88, 0x00, 0x08, 0x53, 0x02, 0x38, 0x34, 0xa0,
+  0x8b, 0x10, 0x37, 0x82, 0xbc, 0x89, 0x98, 0x38, 0xa0, 0x9c, 0xc8, 0xbd,
+  0x38, 0x33, 0x01, 0xfc, 0x8f, 0x11, 0x80, 0x08, 0x99, 0x8b, 0xa9, 0x9b,
+  0x41, 0x98, 0x89, 0xd0, 0x1b, 0x37, 0x98, 0x49, 0x33, 0x21, 0xa2, 0x49,
+  0x77, 0x90, 0x08, 0x08, 0x2a, 0x21, 0x99, 0x11, 0xdc, 0x9b, 0x08, 0x40,
+  0x04, 0xec, 0x08, 0x00, 0x20, 0x82, 0x89, 0x04, 0xab, 0x71, 0x11, 0x08,
+  0xb8, 0xad, 0x22, 0x91, 0x09, 0xba, 0x8f, 0x00, 0xcc, 0x20, 0x82, 0x80,
+  0xb9, 0x1b, 0x17, 0xc9, 0x31, 0x02, 0x0b, 0xca, 0xa9, 0x74, 0x88, 0x9a,
+  0xd9, 0x18, 0x33, 0xb0, 0x13, 0xa2, 0xac, 0x54, 0x35, 0x05, 0xa8, 0x18,
+  0x03, 0x41, 0x03, 0xaa, 0x0a, 0x98, 0x8a, 0xe0, 0xb8, 0xf8, 0xbd, 0x28,
+  0xa2, 0x9b, 0x80, 0x8b, 0x80, 0xbd, 0x60, 0x01, 0x39, 0xb4, 0xcc, 0x21,
+  0xa1, 0x49, 0x08, 0x0c, 0xd8, 0x9a, 0x74, 0x80, 0x99, 0x90, 0x20, 0x25,
+  0x92, 0x22, 0xa8, 0x19, 0x26, 0x18, 0x25, 0xca, 0x9a, 0x00, 0x20, 0x08,
+  0xaf, 0x18, 0xb9, 0x8a, 0x12, 0x3c, 0x40, 0x8b, 0x20, 0x25, 0x58, 0x83,
+  0xa9, 0x44, 0xdb, 0x09, 0x32, 0x80, 0xfa, 0x9f, 0x18, 0xa0, 0x09, 0x01,
+  0xcb, 0x0a, 0x08, 0x71, 0x01, 0x89, 0x98, 0x28, 0x46, 0x80, 0x1b, 0x81,
+  0x8a, 0x21, 0x28, 0x35, 0xe9, 0x8b, 0x83, 0x10, 0x26, 0xb0, 0x51, 0x02,
+  0x08, 0x83, 0x70, 0x24, 0xba, 0x2a, 0xa3, 0xa9, 0xc2, 0x9c, 0xc9, 0xfc,
+  0x09, 0x81, 0x89, 0xa9, 0xaf, 0x28, 0x01, 0x11, 0x92, 0x89, 0x21, 0x08,
+  0x72, 0x07, 0x99, 0xa0, 0x10, 0x22, 0xd1, 0xb8, 0x90, 0x89, 0x22, 0xba,
+  0x36, 0xa3, 0xd9, 0x13, 0x42, 0x25, 0xb1, 0x62, 0x92, 0x9b, 0x38, 0x80,
+  0x22, 0xea, 0x8e, 0xa8, 0x0a, 0x32, 0xbd, 0x1a, 0xb8, 0x1c, 0x36, 0x01,
+  0xb2, 0xcc, 0x50, 0x12, 0x29, 0x91, 0xe9, 0x09, 0xa8, 0x80, 0x90, 0xae,
+  0xb0, 0x8c, 0x30, 0xb1, 0xac, 0x33, 0x20, 0x15, 0x10, 0x65, 0x11, 0x2a,
+  0x83, 0x08, 0x44, 0x01, 0x88, 0xa0, 0xac, 0x0c, 0x08, 0x27, 0xd8, 0xaa,
+  0x11, 0x38, 0x42, 0xb8, 0x80, 0xa0, 0x7a, 0x23, 0xa0, 0xa9, 0xcf, 0x89,
+  0x12, 0x99, 0xbb, 0xce, 0x88, 0x98, 0x0b, 0x14, 0x99, 0x28, 0x82, 0x70,
+  0x04, 0x18, 0x43, 0x08, 0x31, 0xc2, 0x10, 0x17, 0xaa, 0x98, 0xab, 0x62,
+  0xa1, 0x1b, 0x01, 0xbe, 0x48, 0x21, 0x24, 0x91, 0x8c, 0x11, 0x10, 0x27,
+  0xa0, 0x0c, 0x08, 0x0b, 0x01, 0xda, 0xb0, 0xce, 0x08, 0x12, 0x0b, 0x98,
+  0xca, 0x10, 0x02, 0x08, 0x36, 0x08, 0x24, 0xfa, 0x49, 0x00, 0x99, 0x30,
+  0x0c, 0x9b, 0x9c, 0x28, 0x14, 0xcb, 0x3b, 0x9c, 0x43, 0x27, 0x80, 0x80,
+  0x80, 0x53, 0x12, 0x52, 0x93, 0xad, 0x28, 0x08, 0x83, 0xe0, 0x0b, 0x98,
+  0x9b, 0x48, 0xe9, 0x19, 0x90, 0x0d, 0x23, 0xa0, 0x12, 0xd9, 0x30, 0x91,
+  0xaf, 0x13, 0x80, 0xa0, 0xfc, 0x89, 0x91, 0x0a, 0x13, 0xfa, 0x19, 0x81,
+  0x39, 0x26, 0x80, 0x80, 0x80, 0x55, 0x03, 0x89, 0x02, 0xb9, 0x48, 0x11,
+  0x82, 0xf0, 0xba, 0x80, 0x09, 0x48, 0xa0, 0xac, 0x22, 0x08, 0x80, 0x97,
+  0x41, 0x80, 0x0c, 0x43, 0x9b, 0x4a, 0xc0, 0xba, 0xaa, 0x8f, 0x80, 0xa0,
+  0x89, 0xfa, 0x0d, 0x30, 0x28, 0x20, 0xa2, 0x29, 0x88, 0x63, 0x27, 0xb8,
+  0x08, 0x08, 0x28, 0x23, 0xcc, 0xb0, 0xca, 0x48, 0x01, 0x1c, 0x14, 0x9d,
+  0x20, 0x83, 0x52, 0x02, 0x39, 0x06, 0xb8, 0x30, 0x91, 0x28, 0x02, 0xbe,
+  0xa8, 0xac, 0x80, 0xf0, 0x9b, 0xa0, 0xab, 0x78, 0x01, 0x98, 0xc9, 0x2b,
+  0x43, 0x10, 0x42, 0xf0, 0xa9, 0x82, 0x80, 0x80, 0xd0, 0xa0, 0xa9, 0x5a,
+  0x03, 0xca, 0x48, 0x82, 0x28, 0x25, 0x23, 0x24, 0x08, 0x52, 0xa2, 0x40,
+  0x24, 0xc8, 0x30, 0xdc, 0x99, 0x90, 0x28, 0xa2, 0xcf, 0x18, 0xa0, 0x18,
+  0x14, 0xca, 0x94, 0x3d, 0x96, 0xf4, 0x22, 0x1d, 0xa8, 0x70, 0x9c, 0x31,
+  0xd9, 0x10, 0xa2, 0xe0, 0x83, 0x81, 0x09, 0x4b, 0x5a, 0xb2, 0x20, 0xf9,
+  0x33, 0x9b, 0x86, 0xc0, 0x21, 0x8c, 0x59, 0x00, 0x0a, 0xb0, 0xb2, 0x4b,
+  0xa3, 0xa4, 0xa8, 0xb2, 0x78, 0x09, 0x2a, 0xa8, 0x29, 0x87, 0xa0, 0xa0,
+  0x29, 0xf2, 0x7a, 0x88, 0x89, 0x28, 0xa9, 0x92, 0x01, 0xba, 0x98, 0x54,
+  0xa2, 0x08, 0x8a, 0x7a, 0x10, 0x84, 0x9b, 0x84, 0x10, 0x2b, 0x05, 0xa2,
+  0x9f, 0x10, 0x29, 0x21, 0xb0, 0xea, 0x08, 0x01, 0xb9, 0x7a, 0x04, 0x99,
+  0x08, 0x89, 0x10, 0x42, 0xc1, 0x31, 0x13, 0xdd, 0x1a, 0x24, 0xa8, 0xab,
+  0x19, 0x80, 0xba, 0xf1, 0x8c, 0x11, 0xc9, 0x9f, 0x42, 0x90, 0x89, 0x80,
+  0x18, 0x02, 0x00, 0x43, 0x35, 0x91, 0xab, 0x74, 0x03, 0xb8, 0x1a, 0x24,
+  0x01, 0x92, 0xbf, 0x09, 0x81, 0xca, 0x38, 0x95, 0xcc, 0x8b, 0x11, 0x01,
+  0xb0, 0x9a, 0x78, 0x14, 0xb9, 0x0b, 0x64, 0x82, 0x8a, 0x20, 0xa1, 0x10,
+  0x10, 0x13, 0x08, 0xff, 0x0b, 0x53, 0x92, 0xcb, 0x8a, 0x00, 0x11, 0x81,
+  0x09, 0x18, 0x98, 0x9c, 0x73, 0x04, 0xac, 0x19, 0x25, 0x98, 0xa9, 0x8c,
+  0x40, 0x02, 0xcc, 0x89, 0x23, 0xc8, 0x8b, 0x33, 0xc0, 0x29, 0x24, 0x31,
+  0x25, 0xea, 0x28, 0x37, 0x81, 0xaa, 0x38, 0x03, 0x18, 0x00, 0xb9, 0x9e,
+  0xb8, 0xbb, 0x72, 0xa1, 0xcf, 0x09, 0x80, 0x98, 0x08, 0x98, 0x08, 0xa8,
+  0xbb, 0x73, 0x34, 0xa0, 0x2b, 0x34, 0xa8, 0x31, 0x25, 0x82, 0x20, 0xd9,
+  0x1b, 0x46, 0xa8, 0x8b, 0x01, 0xa0, 0x9e, 0x22, 0x80, 0x28, 0xf8, 0x8b,
+  0x44, 0x02, 0xa9, 0x31, 0x90, 0x90, 0x72, 0x83, 0xbb, 0x10, 0xb8, 0x60,
+  0xa3, 0xef, 0x09, 0x00, 0x98, 0x08, 0xb9, 0xae, 0x00, 0x81, 0x28, 0x12,
+  0xb8, 0x3a, 0x26, 0x81, 0x30, 0x37, 0x01, 0x02, 0x99, 0xaa, 0x57, 0x02,
+  0xaa, 0x99, 0xcb, 0x19, 0x36, 0xb0, 0xac, 0xa9, 0x09, 0x73, 0x12, 0x9a,
+  0x0a, 0x21, 0x28, 0x55, 0xa1, 0x09, 0x32, 0xa3, 0x9e, 0x11, 0xba, 0x1b,
+  0x92, 0xdf, 0x0a, 0xa9, 0x9c, 0x08, 0xc0, 0xcb, 0x30, 0x93, 0xab, 0x32,
+  0xa0, 0x73, 0x27, 0x88, 0x18, 0x22, 0x01, 0x54, 0x12, 0xb8, 0x0a, 0x11,
+  0x20, 0x37, 0xd9, 0x9b, 0x10, 0xa9, 0x3a, 0x27, 0xba, 0xaa, 0x89, 0x19,
+  0x45, 0x92, 0xbc, 0x20, 0xc1, 0x8c, 0x24, 0x92, 0xad, 0x08, 0x99, 0x0a,
+  0x91, 0xdc, 0x28, 0xa2, 0xcf, 0x28, 0x12, 0x80, 0x19, 0x90, 0x38, 0x36,
+  0x02, 0x31, 0x15, 0xb9, 0x71, 0x34, 0xb0, 0x9a, 0x20, 0x22, 0x22, 0xf8,
+  0xae, 0x20, 0xa8, 0x1a, 0x02, 0xdb, 0x9e, 0x10, 0x01, 0x00, 0xa8, 0x9b,
+  0x62, 0x92, 0x9d, 0x52, 0x03, 0x99, 0x98, 0x80, 0x08, 0x35, 0xa0, 0x0a,
+  0xd9, 0xaf, 0x40, 0x14, 0xc8, 0x8b, 0x80, 0x20, 0x32, 0x90, 0x0a, 0x11,
+  0xa8, 0x68, 0x27, 0xb0, 0x9a, 0x32, 0xa2, 0x0a, 0xc9, 0x8c, 0x33, 0xf8,
+  0xad, 0x21, 0xa1, 0xac, 0x10, 0x90, 0x18, 0x22, 0x9a, 0x52, 0x84, 0xbb,
+  0x76, 0x03, 0xaa, 0x29, 0x13, 0x10, 0x21, 0x90, 0xbc, 0x80, 0xfb, 0x49,
+  0x24, 0xfb, 0x8a, 0x00, 0x89, 0x40, 0x91, 0xa9, 0x98, 0xa9, 0x48, 0x57,
+  0x90, 0xab, 0x20, 0x81, 0x10, 0x01, 0xd9, 0x09, 0xb1, 0x9d, 0x30, 0xb1,
+  0xaf, 0x30, 0x91, 0xad, 0x30, 0x11, 0x32, 0x03, 0xce, 0x61, 0x23, 0x80,
+  0x10, 0x02, 0x0a, 0x65, 0x02, 0xaa, 0x08, 0x88, 0x38, 0x17, 0xfa, 0x9b,
+  0x01, 0x80, 0x08, 0xb0, 0xbe, 0x1a, 0x81, 0x08, 0x81, 0xca, 0x9c, 0x41,
+  0xb0, 0x0a, 0x42, 0xb1, 0x09, 0xa0, 0xce, 0x71, 0x02, 0x88, 0x88, 0x98,
+  0x2a, 0x67, 0x01, 0x89, 0x10, 0x08, 0x43, 0x25, 0x98, 0x18, 0x11, 0x08,
+  0x32, 0x93, 0xbe, 0x18, 0xa1, 0xaf, 0x08, 0xdb, 0xaa, 0x88, 0xdc, 0x0a,
+  0x80, 0xbc, 0x0b, 0x81, 0xba, 0x68, 0x93, 0xaa, 0x30, 0x32, 0x51, 0x36,
+  0xb0, 0x2a, 0x53, 0x82, 0x21, 0x15, 0xb8, 0x19, 0x01, 0x09, 0x47, 0x92,
+  0xac, 0x20, 0xa8, 0x2a, 0x57, 0x90, 0x89, 0x99, 0x99, 0x73, 0x84, 0xaa,
+  0x0a, 0x10, 0xaa, 0x30, 0xb3, 0xcf, 0x19, 0x98, 0x09, 0xb1, 0xec, 0x19,
+  0x13, 0xca, 0x8a, 0x22, 0x01, 0x20, 0xa3, 0x8e, 0x35, 0x02, 0x10, 0x32,
+  0xe9, 0x3a, 0x37, 0x90, 0xab, 0x89, 0x21, 0x37, 0xa0, 0xbe, 0x18, 0x11,
+  0x00, 0x33, 0xc8, 0xae, 0x20, 0x02, 0x43, 0xa0, 0xac, 0x58, 0x83, 0xac,
+  0x10, 0x22, 0xca, 0x99, 0xb9, 0x9c, 0x24, 0xb8, 0x9e, 0x91, 0xcd, 0x28,
+  0x17, 0xa0, 0x9a, 0x00, 0x30, 0x53, 0x81, 0x8a, 0x43, 0xa0, 0x39, 0x54,
+  0xa0, 0x0b, 0x20, 0x81, 0x09, 0xfa, 0xab, 0x20, 0xd2, 0xbd, 0x41, 0xa0,
+  0xad, 0x18, 0x88, 0x00, 0x23, 0xea, 0x18, 0x12, 0x9a, 0x72, 0x15, 0xb9,
+  0x18, 0x33, 0x11, 0x32, 0xa1, 0x0c, 0x34, 0xe9, 0x49, 0x25, 0xb8, 0x9b,
+  0x90, 0x89, 0x58, 0x84, 0xb9, 0xaa, 0xfb, 0x0a, 0x34, 0xb1, 0xbd, 0x89,
+  0x88, 0x18, 0x91, 0xeb, 0x0a, 0x80, 0x99, 0x42, 0xb2, 0xbe, 0x62, 0x02,
+  0x98, 0x31, 0x11, 0x63, 0x14, 0xa9, 0x58, 0x24, 0x80, 0x20, 0x12, 0xac,
+  0x53, 0x12, 0xca, 0x89, 0xaa, 0x38, 0x27, 0xf9, 0xab, 0x08, 0x80, 0x11,
+  0xa2, 0xaf, 0x8a, 0x00, 0x00, 0x22, 0xc8, 0x9d, 0x30, 0xa1, 0x0a, 0x12,
+  0xb0, 0x2a, 0xc2, 0xbf, 0x30, 0x16, 0xb8, 0x19, 0xa0, 0x9d, 0x65, 0x02,
+  0x89, 0x08, 0x80, 0x51, 0x16, 0x80, 0x18, 0x01, 0x08, 0x41, 0x14, 0xbb,
+  0x38, 0x92, 0xb9, 0x10, 0xfa, 0x9e, 0x18, 0xca, 0x89, 0x81, 0xfb, 0x9b,
+  0x81, 0xb9, 0x28, 0x93, 0xaf, 0x09, 0x81, 0x08, 0x34, 0xd1, 0x9b, 0x23,
+  0x14, 0x38, 0x15, 0x98, 0x28, 0x23, 0x20, 0x67, 0x03, 0xa9, 0x40, 0x91,
+  0x2a, 0x65, 0x81, 0x98, 0x98, 0xa9, 0x50, 0x14, 0xca, 0x9a, 0x80, 0xba,
+  0x30, 0xa1, 0xdf, 0x99, 0x80, 0x09, 0x80, 0xeb, 0x8b, 0x22, 0xb0, 0x8c,
+  0x33, 0x98, 0x31, 0x04, 0x9b, 0x36, 0x82, 0x22, 0x55, 0xa1, 0x0b, 0x36,
+  0x82, 0xaa, 0x88, 0x10, 0x74, 0x92, 0xcb, 0x0a, 0x01, 0x88, 0x54, 0xb2,
+  0xad, 0x09, 0x11, 0x32, 0x92, 0xdc, 0x19, 0x33, 0xda, 0x28, 0x23, 0xdb,
+  0x89, 0x80, 0x98, 0x31, 0xd0, 0x9d, 0x00, 0xdc, 0x1b, 0x35, 0xa1, 0xbc,
+  0x08, 0x88, 0x42, 0x03, 0x9a, 0x41, 0xb1, 0x1b, 0x57, 0x92, 0x8a, 0x20,
+  0x13, 0x18, 0x03, 0xcd, 0x40, 0x92, 0xcb, 0x50, 0x83, 0xeb, 0x09, 0x01,
+  0x89, 0x21, 0xd8, 0x8b, 0x13, 0xe9, 0x39, 0x25, 0xda, 0x8a, 0x32, 0x92,
+  0x18, 0xa0, 0xab, 0x31, 0xc0, 0x1c, 0x57, 0x90, 0xac, 0x11, 0x98, 0x28,
+  0x35, 0x98, 0x89, 0xc9, 0x0b, 0x46, 0x84, 0xab, 0x0a, 0x01, 0x19, 0x23,
+  0xca, 0x9e, 0x00, 0xba, 0x50, 0x92, 0xcd, 0x09, 0x02, 0xb8, 0x2a, 0x83,
+  0x10, 0x45, 0xc8, 0x1b, 0x37, 0x92, 0x38, 0x14, 0xa8, 0x41, 0x34, 0xa1,
+  0x09, 0x80, 0x0a, 0x47, 0xa0, 0xbe, 0x09, 0x80, 0x09, 0x01, 0xec, 0xaa,
+  0x88, 0x98, 0x20, 0xa0, 0xbf, 0x18, 0x81, 0x99, 0x31, 0xa1, 0x0c, 0x23,
+  0xb9, 0x79, 0x17, 0x90, 0x19, 0x01, 0x9a, 0x74, 0x23, 0x98, 0x19, 0x81,
+  0x29, 0x57, 0x81, 0x09, 0x11, 0xa9, 0x48, 0x23, 0xc9, 0x89, 0x00, 0xda,
+  0x09, 0xa1, 0xbf, 0x89, 0xc9, 0x8c, 0x11, 0xd9, 0x9c, 0x08, 0xa9, 0x08,
+  0x12, 0xc9, 0x0a, 0x03, 0x89, 0x57, 0x91, 0x9b, 0x53, 0x12, 0x19, 0x33,
+  0x98, 0x28, 0x33, 0x98, 0x72, 0x27, 0xa9, 0x18, 0x83, 0x8c, 0x72, 0x04,
+  0x98, 0x89, 0xb9, 0x50, 0x25, 0xb0, 0x9b, 0x10, 0xb9, 0x30, 0x04, 0xfb,
+  0xab, 0x98, 0x89, 0x01, 0xfc, 0xbb, 0x11, 0xa8, 0xad, 0x18, 0x80, 0x89,
+  0x00, 0xbb, 0x58, 0x15, 0x08, 0x46, 0x81, 0x8b, 0x73, 0x22, 0x08, 0x00,
+  0x19, 0x63, 0x13, 0xb8, 0x1b, 0x13, 0xaa, 0x72, 0x84, 0xbb, 0x9b, 0x08,
+  0x40, 0x04, 0xcd, 0x8b, 0x22, 0xc8, 0x8b, 0x23, 0xda, 0x9b, 0x98, 0x99,
+  0x30, 0xd1, 0x9f, 0x10, 0xb9, 0x8d, 0x62, 0x01, 0xa9, 0x89, 0x00, 0x52,
+  0x14, 0x88, 0x30, 0x84, 0x9a, 0x73, 0x13, 0x98, 0x18, 0x88, 0x11, 0x04,
+  0xda, 0x1a, 0x81, 0xdd, 0x1a, 0x14, 0xc9, 0x9b, 0x88, 0x09, 0x31, 0xd8,
+  0x8c, 0x32, 0xb8, 0x1b, 0x47, 0xa0, 0x8c, 0x32, 0x02, 0x20, 0xc1, 0x9c,
+  0x42, 0x92, 0xac, 0x51, 0x02, 0xcb, 0x09, 0x90, 0x0a, 0x35, 0x90, 0x19,
+  0xc8, 0xaf, 0x51, 0x15, 0xa9, 0xa9, 0x00, 0x20, 0x24, 0xa8, 0x9d, 0x80,
+  0xa9, 0x20, 0x16, 0xda, 0x9b, 0x11, 0x80, 0x08, 0xb8, 0x1c, 0x54, 0xa1,
+  0xad, 0x32, 0x03, 0x10, 0x43, 0xb1, 0x1b, 0x37, 0x01, 0x20, 0xb0, 0x9e,
+  0x52, 0x13, 0xdb, 0x8a, 0x88, 0x10, 0x42, 0xc8, 0xad, 0x18, 0x98, 0x41,
+  0x82, 0xcc, 0x8a, 0x30, 0x88, 0x12, 0xd8, 0xad, 0x11, 0xb8, 0x8d, 0x33,
+  0xd8, 0x9b, 0xa0, 0x8a, 0x69, 0x24, 0x98, 0x18, 0x81, 0x1a, 0x77, 0x03,
+  0x09, 0x21, 0x81, 0x38, 0x36, 0x91, 0x08, 0x12, 0xba, 0x3b, 0x15, 0xbc,
+  0xba, 0xca, 0xbe, 0x21, 0xc0, 0xbc, 0x8a, 0xb9, 0x9c, 0x24, 0xd9, 0x9a,
+  0x88, 0x08, 0x34, 0x91, 0xbf, 0x10, 0x23, 0x91, 0x32, 0xd1, 0x0c, 0x42,
+  0x81, 0x40, 0x05, 0x88, 0x20, 0x16, 0x99, 0x31, 0x27, 0x01, 0x08, 0xa8,
+  0x1a, 0x57, 0x80, 0x99, 0x98, 0x99, 0x2a, 0x14, 0xe9, 0xac, 0x9a, 0x88,
+  0x20, 0xd9, 0xbd, 0x19, 0x90, 0x99, 0x09, 0x90, 0x09, 0x42, 0xa2, 0x41,
+  0x13, 0x2a, 0x77, 0x12, 0x99, 0x28, 0x15, 0x01, 0x81, 0xa9, 0x30, 0x37,
+  0xb8, 0x0b, 0x01, 0x9a, 0x50, 0x25, 0xb9, 0x9c, 0x88, 0x50, 0x43, 0xd0,
+  0x9b, 0x30, 0x92, 0x0c, 0x11, 0xb8, 0x9e, 0xaa, 0x98, 0x20, 0xc0, 0xcf,
+  0x08, 0x90, 0xbb, 0x40, 0x13, 0xb9, 0x9b, 0x08, 0x54, 0x16, 0x98, 0x30,
+  0x15, 0xa8, 0x30, 0x26, 0x88, 0x80, 0x90, 0x28, 0x24, 0xc9, 0x8a, 0x33,
+  0xfa, 0x8d, 0x33, 0x90, 0xba, 0x9a, 0x19, 0x74, 0xa1, 0xbb, 0x30, 0x92,
+  0x9c, 0x73, 0xa1, 0xad, 0x88, 0x21, 0x20, 0xc0, 0xbe, 0x08, 0x04, 0xa9,
+  0x29, 0x03, 0xb9, 0x28, 0x02, 0x4a, 0x26, 0x12, 0x22, 0x15, 0xdb, 0x39,
+  0x47, 0x91, 0x99, 0x9a, 0x19, 0x44, 0x90, 0xbc, 0x98, 0xb9, 0x0a, 0x44,
+  0xb8, 0xaf, 0x08, 0x10, 0x01, 0xa0, 0xac, 0x52, 0x84, 0xa9, 0x30, 0x13,
+  0x0a, 0x44, 0x82, 0x0a, 0x32, 0xb9, 0x52, 0x04, 0xbe, 0x39, 0x25, 0xc8,
+  0x9b, 0x80, 0x08, 0x73, 0xb1, 0xab, 0x00, 0x88, 0x49, 0x35, 0xd9, 0xab,
+  0x10, 0x81, 0x32, 0xb0, 0xcf, 0x19, 0xa8, 0x9b, 0x34, 0xb0, 0xbc, 0x1a,
+  0x9a, 0x69, 0x26, 0x99, 0x18, 0x13, 0x8a, 0x73, 0x07, 0x88, 0x11, 0x01,
+  0x08, 0x33, 0x92, 0x0c, 0x24, 0xd9, 0x0a, 0x12, 0xda, 0x89, 0xa9, 0xae,
+  0x28, 0x81, 0xbc, 0x0b, 0xc8, 0x8b, 0x35, 0xa8, 0xac, 0x88, 0x80, 0x73,
+  0x03, 0xdd, 0x1a, 0x21, 0x80, 0x12, 0xb8, 0x9e, 0x20, 0x10, 0x20, 0x43,
+  0xb9, 0x2a, 0x57, 0x90, 0x28, 0x53, 0x10, 0x21, 0xa1, 0x8c, 0x55, 0x03,
+  0xaa, 0x80, 0xa8, 0x8b, 0x35, 0xc0, 0xbc, 0xbb, 0xbb, 0x50, 0xa3, 0xcf,
+  0x8a, 0x01, 0x99, 0x09, 0xa1, 0x9a, 0x30, 0x90, 0x29, 0x25, 0xca, 0x5a,
+  0x27, 0xa0, 0x09, 0x23, 0x00, 0x32, 0xc1, 0x2b, 0x57, 0x81, 0x8a, 0x21,
+  0x01, 0x29, 0x45, 0x91, 0x89, 0x88, 0x09, 0x66, 0x92, 0xbc, 0x18, 0x01,
+  0xb9, 0x19, 0xa1, 0xcf, 0x89, 0xbb, 0x38, 0x92, 0xde, 0x8a, 0x80, 0xa8,
+  0x19, 0x15, 0x98, 0x99, 0x80, 0x41, 0x37, 0xa1, 0x19, 0x54, 0x91, 0x08,
+  0x32, 0x02, 0x20, 0x80, 0x8b, 0x73, 0xa2, 0x9d, 0x41, 0xb0, 0xad, 0x31,
+  0x02, 0xb9, 0xba, 0xac, 0x71, 0x03, 0xcb, 0x1b, 0x12, 0xbb, 0x60, 0x82,
+  0xcd, 0x09, 0x10, 0x10, 0x03, 0xcf, 0x8b, 0x33, 0xa0, 0x89, 0x12, 0xa9,
+  0x19, 0x13, 0x30, 0x45, 0x06, 0x19, 0x53, 0xb0, 0x0b, 0x46, 0x02, 0x99,
+  0xa9, 0xa9, 0x72, 0x83, 0xda, 0x0a, 0x98, 0x9b, 0x62, 0x91, 0xbc, 0x89,
+  0x08, 0x21, 0x12, 0xeb, 0x1a, 0x25, 0xa8, 0x1a, 0x25, 0xa9, 0x31, 0x03,
+  0xbb, 0x71, 0x90, 0x0b, 0x33, 0xf9, 0x1b, 0x43, 0xb0, 0x9c, 0x81, 0xa9,
+  0x63, 0x05, 0xaa, 0x19, 0x12, 0x0a, 0x64, 0xa1, 0xaa, 0x10, 0xa0, 0x38,
+  0x05, 0xfb, 0x9b, 0x80, 0xba, 0x49, 0x82, 0xce, 0x09, 0xb9, 0x29, 0x73,
+  0x91, 0x9a, 0x20, 0x00, 0x70, 0x43, 0x98, 0x38, 0x24, 0x98, 0x62, 0x02,
+  0x9a, 0x31, 0x02, 0xbb, 0x21, 0xc0, 0x0b, 0x92, 0xff, 0x0b, 0x23, 0xca,
+  0xa9, 0xb8, 0xab, 0x38, 0x83, 0xbd, 0x0b, 0xea, 0x1a, 0x27, 0xb8, 0x9e,
+  0x10, 0x01, 0x20, 0xa1, 0xbc, 0x38, 0x33, 0x89, 0x74, 0x92, 0x8a, 0x62,
+  0x12, 0x80, 0x41, 0x03, 0x42, 0x13, 0xcc, 0x31, 0x27, 0xa8, 0x09, 0x88,
+  0xaa, 0x31, 0x80, 0xaf, 0xab, 0xcc, 0x19, 0x23, 0xfb, 0xac, 0x00, 0x98,
+  0x08, 0x90, 0x9a, 0x10, 0x91, 0x8a, 0x72, 0x94, 0x8b, 0x53, 0x84, 0x89,
+  0x21, 0x01, 0x43, 0x91, 0xac, 0x73, 0x14, 0xa9, 0x29, 0x04, 0x89, 0x42,
+  0x12, 0x19, 0x10, 0xca, 0x52, 0x16, 0xc9, 0x0a, 0x31, 0xc0, 0x89, 0x91,
+  0xda, 0x99, 0xdb, 0x9a, 0x32, 0xf9, 0x9d, 0x88, 0x98, 0x8a, 0x21, 0x90,
+  0x9b, 0xb9, 0x19, 0x77, 0x01, 0x9a, 0x21, 0x05, 0x08, 0x12, 0x03, 0x10,
+  0x15, 0x98, 0x50, 0x13, 0xa9, 0x30, 0x04, 0xeb, 0x39, 0x14, 0x80, 0xa0,
+  0xdc, 0x19, 0x35, 0xb8, 0x8c, 0x18, 0xaa, 0x09, 0x32, 0xfb, 0x9e, 0x80,
+  0x88, 0x12, 0xe9, 0x9d, 0x18, 0x81, 0x99, 0x01, 0x89, 0x09, 0x52, 0x90,
+  0x30, 0x35, 0x18, 0x35, 0x05, 0x99, 0x51, 0x24, 0x00, 0x90, 0xb8, 0x58,
+  0x34, 0xb8, 0xac, 0x98, 0xba, 0x30, 0x04, 0xdd, 0xaa, 0x98, 0x09, 0x32,
+  0xe9, 0xab, 0x32, 0xb0, 0x89, 0x32, 0xd9, 0x49, 0x34, 0xc0, 0x4b, 0x83,
+  0xba, 0x53, 0x91, 0x8c, 0x42, 0x02, 0x0a, 0x11, 0x8b, 0x60, 0x64, 0x90,
+  0x1b, 0x22, 0x8a, 0x52, 0x82, 0xcb, 0x08, 0x91, 0x0c, 0x32, 0xfb, 0xad,
+  0x88, 0xba, 0x2a, 0x83, 0xdd, 0x0a, 0xb8, 0x0b, 0x73, 0x83, 0xaa, 0x10,
+  0x82, 0x24, 0x37, 0x80, 0x19, 0x34, 0x80, 0x41, 0x23, 0xd8, 0x39, 0x13,
+  0xbb, 0x20, 0xd9, 0x9b, 0x14, 0xec, 0x9c, 0x30, 0x91, 0x9a, 0xa9, 0xdb,
+  0x19, 0x06, 0xa8, 0x80, 0xc8, 0x0b, 0x45, 0x92, 0xae, 0x19, 0x00, 0x21,
+  0x11, 0xec, 0x8a, 0x12, 0x88, 0x33, 0x82, 0xad, 0x31, 0x34, 0x01, 0x40,
+  0x82, 0x34, 0x27, 0xb0, 0x1b, 0x37, 0x91, 0x88, 0x88, 0x99, 0x39, 0x85,
+  0xcb, 0x99, 0xbe, 0x8b, 0x63, 0xb0, 0xbc, 0x09, 0x89, 0x80, 0x80, 0x9a,
+  0x1b, 0x01, 0x8e, 0x50, 0x93, 0xbd, 0x31, 0x13, 0xa9, 0x01, 0x98, 0x58,
+  0x06, 0xca, 0x58, 0x25, 0x99, 0x18, 0x13, 0x21, 0x33, 0x15, 0x11, 0x52,
+  0x90, 0x38, 0x47, 0xa8, 0x8c, 0x21, 0xa8, 0x89, 0xba, 0xda, 0xab, 0xec,
+  0x9b, 0x10, 0xb0, 0xbf, 0x0a, 0xa8, 0x0b, 0x13, 0x91, 0x90, 0xa8, 0x4c,
+  0x55, 0x24, 0xa9, 0x38, 0x34, 0x10, 0x13, 0x93, 0x19, 0x27, 0x98, 0x48,
+  0x02, 0xe9, 0x18, 0x14, 0xba, 0x89, 0x01, 0x12, 0x12, 0xed, 0x8b, 0x52,
+  0xa2, 0x8b, 0x08, 0xb8, 0x0d, 0x33, 0xea, 0xab, 0xca, 0x88, 0x43, 0xd2,
+  0xbe, 0x19, 0x01, 0x80, 0x30, 0xa9, 0x8a, 0x24, 0x00, 0x44, 0x24, 0x89,
+  0x61, 0x14, 0x98, 0x28, 0x24, 0x08, 0x11, 0xda, 0x0c, 0x34, 0xb8, 0xab,
+  0xb8, 0xcb, 0x4a, 0x24, 0xaa, 0x8d, 0xa8, 0x1b, 0x36, 0xa2, 0xab, 0x52,
+  0x92, 0x8a, 0x31, 0xb1, 0x0c, 0x83, 0xea, 0x2a, 0x93, 0xff, 0x08, 0x81,
+  0xaa, 0x10, 0x92, 0x8b, 0x08, 0x08, 0x71, 0x44, 0x90, 0x3a, 0x23, 0x22,
+  0x63, 0x31, 0xab, 0x31, 0x02, 0x0c, 0x15, 0xe9, 0x8d, 0x80, 0xaa, 0x0c,
+  0x81, 0xa9, 0xbb, 0xda, 0xac, 0x52, 0x04, 0x99, 0x08, 0xa0, 0x18, 0x57,
+  0x81, 0x98, 0x11, 0x81, 0x21, 0x07, 0xb9, 0x2a, 0x13, 0xaa, 0x11, 0xd0,
+  0x9d, 0x32, 0xc1, 0xaa, 0x38, 0xb2, 0x00, 0x16, 0xe9, 0x89, 0x04, 0x90,
+  0x10, 0xb8, 0xae, 0x51, 0x92, 0xbc, 0x9b, 0xa8, 0x49, 0x04, 0xfa, 0x8b,
+  0x01, 0x08, 0x42, 0x13, 0xac, 0x29, 0x17, 0x11, 0x32, 0x82, 0x39, 0x45,
+  0xa2, 0x09, 0x44, 0x81, 0x9a, 0x01, 0xdb, 0x1a, 0x82, 0xeb, 0x9a, 0xdb,
+  0xac, 0x40, 0x80, 0xac, 0x8b, 0x88, 0x18, 0x11, 0xb9, 0x19, 0x17, 0xa9,
+  0x30, 0x34, 0xcc, 0x20, 0x13, 0xb8, 0x12, 0xca, 0x8b, 0x27, 0xd9, 0x39,
+  0x17, 0x98, 0x88, 0x21, 0x22, 0x24, 0x14, 0x89, 0x53, 0x00, 0x48, 0x43,
+  0xb3, 0x9e, 0x10, 0x82, 0x9a, 0xb8, 0xcd, 0x8a, 0xd8, 0xbc, 0x18, 0xa2,
+  0xcc, 0x8a, 0xb8, 0x99, 0x21, 0x84, 0x00, 0xba, 0xab, 0x72, 0x47, 0x98,
+  0x88, 0x20, 0x11, 0x21, 0x81, 0x8a, 0x32, 0x82, 0x4c, 0x35, 0xd9, 0x2a,
+  0x26, 0x80, 0x80, 0x20, 0x38, 0x54, 0x91, 0xac, 0x51, 0x83, 0xaa, 0x20,
+  0xc8, 0x9c, 0x20, 0xda, 0xbb, 0xac, 0xcb, 0x28, 0xa3, 0xff, 0x89, 0x80,
+  0x00, 0x10, 0x98, 0x8a, 0x11, 0x21, 0x54, 0x23, 0xa1, 0x38, 0x37, 0x92,
+  0x11, 0x23, 0x01, 0x31, 0xe2, 0x9b, 0x62, 0x91, 0xac, 0x08, 0xca, 0x8c,
+  0x24, 0xa8, 0x8a, 0xab, 0xab, 0x64, 0x02, 0xab, 0x39, 0x04, 0x9c, 0x41,
+  0x91, 0x8e, 0x12, 0xa8, 0x8a, 0x93, 0xec, 0x8a, 0x82, 0xc9, 0x20, 0x83,
+  0xad, 0x20, 0x01, 0x48, 0x55, 0x80, 0x09, 0x32, 0x04, 0x21, 0x25, 0xc9,
+  0x2a, 0x83, 0x80, 0x10, 0xd0, 0xbf, 0x08, 0xc8, 0xaa, 0x23, 0xc9, 0xca,
+  0x00, 0xbc, 0x68, 0x23, 0x90, 0x09, 0x98, 0x19, 0x57, 0x03, 0xa9, 0x08,
+  0x12, 0x1a, 0x17, 0xb8, 0x0b, 0x88, 0x90, 0x4a, 0xb1, 0xbf, 0x38, 0x83,
+  0xbb, 0x49, 0x08, 0x58, 0x14, 0x99, 0x1b, 0x42, 0xb4, 0x28, 0x14, 0xf9,
+  0x1b, 0x04, 0xc9, 0x9a, 0xaa, 0x1d, 0x23, 0xe9, 0xac, 0x08, 0x91, 0x18,
+  0x25, 0xb0, 0x0a, 0x32, 0x61, 0x34, 0x83, 0x0a, 0x71, 0x14, 0x09, 0x40,
+  0x01, 0x98, 0x10, 0xb8, 0x19, 0x82, 0xbf, 0x0b, 0xd1, 0xbc, 0x2b, 0x13,
+  0xcb, 0x9d, 0xaa, 0x09, 0x32, 0xc9, 0x09, 0x03, 0xda, 0x89, 0x26, 0xc1,
+  0x8a, 0x82, 0x80, 0x58, 0xb1, 0xcc, 0x53, 0x88, 0x8a, 0x64, 0x92, 0x89,
+  0x31, 0x21, 0x54, 0x01, 0x80, 0x42, 0x14, 0x08, 0x30, 0x15, 0xcb, 0x09,
+  0x21, 0xba, 0xc0, 0xdd, 0x0b, 0xa8, 0xcc, 0x8a, 0x81, 0xcb, 0x9c, 0xa8,
+  0x0a, 0x38, 0x83, 0x0c, 0x21, 0xfa, 0x30, 0x46, 0x80, 0x89, 0x20, 0x02,
+  0x43, 0x12, 0x9b, 0x48, 0x83, 0x89, 0x75, 0xa1, 0x99, 0x51, 0x00, 0x18,
+  0x30, 0x08, 0x61, 0x83, 0xea, 0x28, 0x23, 0xba, 0x80, 0x80, 0xbe, 0x2b,
+  0x98, 0xbe, 0x9a, 0xcd, 0x0a, 0x12, 0xdc, 0x8c, 0x08, 0x89, 0x10, 0x82,
+  0x9b, 0x10, 0x14, 0x28, 0x57, 0x91, 0x19, 0x43, 0x22, 0x18, 0x32, 0x01,
+  0x28, 0x87, 0xaa, 0x71, 0x81, 0xc9, 0x10, 0xa0, 0x9a, 0x41, 0x93, 0x9a,
+  0x0a, 0xcc, 0x50, 0x23, 0xda, 0x19, 0x01, 0xe9, 0x00, 0x01, 0xbb, 0x0b,
+  0xc8, 0xbc, 0x12, 0xfa, 0x9d, 0x00, 0x99, 0x1c, 0x23, 0x9b, 0x09, 0x21,
+  0x20, 0x75, 0x02, 0x80, 0x52, 0x13, 0x20, 0x24, 0x91, 0x2a, 0x23, 0x95,
+  0x28, 0x08, 0xcf, 0x19, 0x90, 0xcb, 0x39, 0xb1, 0xbc, 0x80, 0xae, 0x09,
+  0x24, 0xb1, 0x99, 0xa4, 0xcb, 0x48, 0x17, 0x98, 0x0b, 0x08, 0x18, 0x43,
+  0xc0, 0xda, 0x80, 0xa2, 0x28, 0x23, 0xfa, 0x1a, 0x52, 0x08, 0x18, 0x01,
+  0x10, 0x45, 0x83, 0x9b, 0x21, 0x87, 0x3a, 0x11, 0xe9, 0x0a, 0x82, 0xd0,
+  0x9a, 0xaa, 0xae, 0x11, 0x92, 0xcd, 0x8a, 0x80, 0x19, 0x35, 0x99, 0xb0,
+  0x28, 0x54, 0x38, 0x25, 0x88, 0x3b, 0x36, 0x81, 0x28, 0x81, 0x80, 0x20,
+  0xa7, 0x8e, 0x83, 0x09, 0x1b, 0x0d, 0xb9, 0xad, 0x43, 0xc2, 0xa8, 0x89,
+  0xcb, 0x32, 0x12, 0x99, 0x4a, 0x9b, 0xa8, 0x07, 0xb1, 0xbb, 0x60, 0x88,
+  0x3a, 0xe9, 0x80, 0x8d, 0x33, 0xc8, 0x28, 0x87, 0x98, 0x11, 0x83, 0x30,
+  0x33, 0x53, 0x20, 0x23, 0xa8, 0x22, 0x67, 0xb0, 0x1b, 0x10, 0xb0, 0x89,
+  0xc9, 0xfb, 0x0b, 0xd9, 0x8b, 0x33, 0x8b, 0xbf, 0x18, 0x89, 0x99, 0x61,
+  0x01, 0x80, 0xb8, 0x9d, 0x53, 0x15, 0xa9, 0x08, 0x10, 0xa8, 0x30, 0x11,
+  0x9c, 0xa9, 0x89, 0x55, 0x03, 0xdc, 0x08, 0x25, 0x91, 0x89, 0x23, 0x23,
+  0x25, 0x98, 0x19, 0x63, 0x80, 0x10, 0x06, 0xb0, 0xad, 0x10, 0x80, 0xd9,
+  0xae, 0x09, 0x20, 0xc0, 0xcd, 0x09, 0x08, 0x98, 0x20, 0xa1, 0xba, 0xba,
+  0x41, 0x47, 0x81, 0xa9, 0x40, 0x25, 0x90, 0x09, 0x41, 0x12, 0x00, 0x8a,
+  0x10, 0x25, 0x8b, 0x4a, 0x02, 0xfa, 0x9a, 0x54, 0x02, 0xb9, 0xac, 0x39,
+  0x43, 0xa1, 0x8a, 0x00, 0xd8, 0xab, 0x38, 0x93, 0xbe, 0xac, 0x80, 0x80,
+  0xf9, 0x9e, 0x00, 0x02, 0xaa, 0x2a, 0x32, 0x92, 0x89, 0x42, 0x27, 0x22,
+  0x20, 0x41, 0x44, 0x90, 0x18, 0x35, 0x92, 0xc8, 0x0a, 0x02, 0x02, 0xce,
+  0x99, 0x0a, 0xda, 0xb9, 0x21, 0x92, 0xfd, 0x99, 0x18, 0x11, 0x21, 0x99,
+  0x11, 0xc0, 0x0b, 0x55, 0x23, 0x91, 0xac, 0x20, 0x31, 0x82, 0xaa, 0x00,
+  0x88, 0xfb, 0x2a, 0x22, 0xe8, 0x89, 0x80, 0x05, 0xc8, 0x30, 0x40, 0x26,
+  0x99, 0xac, 0x32, 0x24, 0xa1, 0x08, 0xcc, 0x80, 0x80, 0x80, 0xf0, 0xac,
+  0x8a, 0x30, 0xa3, 0xcf, 0xaa, 0x20, 0x43, 0x10, 0xc0, 0x9a, 0x18, 0x44,
+  0x53, 0x01, 0x09, 0x18, 0x23, 0x43, 0xa0, 0x20, 0x08, 0x02, 0xec, 0xcb,
+  0x12, 0x08, 0xa8, 0xcd, 0xbc, 0x00, 0x53, 0x02, 0xbb, 0xbc, 0x29, 0x74,
+  0x11, 0x91, 0x8a, 0x8b, 0x80, 0x44, 0x98, 0xab, 0x9c, 0x01, 0xcc, 0xc0,
+  0x9a, 0x0a, 0x08, 0x08, 0x88, 0x00, 0xbd, 0x73, 0x24, 0x13, 0x20, 0x64,
+  0x82, 0x12, 0x32, 0x41, 0x05, 0x08, 0x08, 0x48, 0xa0, 0x0a, 0x8d, 0xc0,
+  0xeb, 0xaa, 0x09, 0x21, 0xe8, 0xcb, 0x9a, 0x90, 0x89, 0x44, 0x91, 0xbb,
+  0xbd, 0x30, 0x35, 0x83, 0xb9, 0x8e, 0x20, 0x80, 0x80, 0x04, 0xc8, 0x80,
+  0x20, 0x07, 0x08, 0x08, 0x48, 0x63, 0x81, 0x8a, 0x71, 0x32, 0x00, 0x0b,
+  0x20, 0x30, 0x40, 0x80, 0xa2, 0xcd, 0x9c, 0x19, 0x03, 0xcf, 0xac, 0x00,
+  0x81, 0xba, 0xbd, 0x9a, 0x11, 0x10, 0x01, 0x08, 0xdb, 0x2e, 0x53, 0x33,
+  0x90, 0x89, 0x50, 0x42, 0x08, 0x19, 0x31, 0x82, 0xd0, 0x08, 0x22, 0xab,
+  0x08, 0x43, 0x8e, 0xa9, 0xab, 0x77, 0x01, 0xba, 0x09, 0x48, 0x11, 0x83,
+  0x80, 0x9a, 0xbd, 0x80, 0x20, 0x02, 0xfb, 0x9f, 0x00, 0x98, 0xaa, 0x0b,
+  0x1b, 0xd2, 0xa0, 0x29, 0x42, 0xd0, 0x80, 0x62, 0x13, 0x80, 0x03, 0x22,
+  0x35, 0x01, 0x8a, 0x36, 0xa3, 0xd9, 0x30, 0x21, 0xac, 0x0c, 0x01, 0xaa,
+  0xe8, 0xa9, 0x70, 0x00, 0xca, 0x0c, 0x82, 0x02, 0x13, 0x82, 0xfa, 0x9a,
+  0x81, 0x25, 0x13, 0xdb, 0x9d, 0x20, 0x82, 0x9a, 0x89, 0xcb, 0x08, 0x08,
+  0x08, 0x08, 0xc8, 0x4b, 0x36, 0x84, 0x89, 0x70, 0x22, 0x30, 0x80, 0x2c,
+  0x51, 0x23, 0x91, 0x0a, 0x8c, 0x0c, 0x48, 0x91, 0xde, 0x89, 0x08, 0x88,
+  0x90, 0xfb, 0x9b, 0x11, 0x22, 0x88, 0xa9, 0xcc, 0x30, 0x73, 0x11, 0x80,
+  0x99, 0x28, 0x14, 0x84, 0x99, 0x21, 0x80, 0x80, 0x80, 0x80, 0x80, 0x70,
+  0xf3, 0x08, 0x80, 0x08, 0x56, 0x81, 0xba, 0x08, 0x22, 0x58, 0x22, 0xd8,
+  0xc9, 0x99, 0x8a, 0x80, 0xb0, 0xee, 0x0a, 0x98, 0x9b, 0xa9, 0x08, 0x0e,
+  0x08, 0x58, 0x28, 0x01, 0x08, 0x38, 0x67, 0x02, 0x28, 0x23, 0x80, 0x40,
+  0x23, 0x01, 0x68, 0x8b, 0x80, 0x00, 0xb8, 0xbf, 0x09, 0xa8, 0xea, 0x80,
+  0x8b, 0x80, 0xb0, 0xbf, 0x39, 0xd0, 0x10, 0x34, 0xa1, 0xdc, 0x80, 0x10,
+  0x43, 0x81, 0xeb, 0x8a, 0x13, 0xa0, 0x5a, 0x98, 0xbc, 0x49, 0x33, 0x08,
+  0xa8, 0x8a, 0x48, 0x57, 0x81, 0x0a, 0x52, 0x83, 0x80, 0x83, 0x00, 0x58,
+  0x21, 0x08, 0x08, 0xbe, 0x0c, 0x48, 0x98, 0xbf, 0x89, 0x80, 0x80, 0x9b,
+  0xdd, 0x0a, 0x01, 0x01, 0x48, 0xa9, 0xad, 0x38, 0x63, 0xa2, 0x08, 0xb8,
+  0x41, 0x14, 0xb8, 0x08, 0x22, 0x80, 0x80, 0x34, 0xc0, 0x3b, 0x74, 0x19,
+  0x48, 0xa0, 0x49, 0x46, 0x80, 0x8b, 0x20, 0x12, 0x48, 0x82, 0x9a, 0xab,
+  0xbb, 0x0c, 0x08, 0xfc, 0xcc, 0x09, 0xa8, 0xc9, 0x9a, 0xba, 0x8a, 0x00,
+  0xbb, 0x43, 0x87, 0xbb, 0x48, 0x26, 0x00, 0x23, 0x12, 0x80, 0x35, 0x80,
+  0x50, 0x15, 0x98, 0x19, 0x14, 0x80, 0x9c, 0x01, 0x08, 0x08, 0xb8, 0xaf,
+  0x42, 0xb1, 0x9f, 0x80, 0xa0, 0x49, 0x11, 0xa0, 0x9f, 0x98, 0x89, 0x24,
+  0x91, 0xcc, 0x09, 0x11, 0x9a, 0x08, 0xe8, 0xa9, 0x22, 0x85, 0x80, 0x80,
+  0xe0, 0x41, 0x53, 0x98, 0x39, 0x12, 0x40, 0x12, 0x00, 0x0e, 0x33, 0xa2,
+  0x80, 0x08, 0xbf, 0x08, 0x22, 0xe8, 0xab, 0x89, 0xba, 0x33, 0x97, 0xaf,
+  0x88, 0x02, 0x38, 0x12, 0xd0, 0xbb, 0x14, 0x23, 0x08, 0x08, 0xb8, 0x3c,
+  0x73, 0x9b, 0x8a, 0x80, 0x0e, 0x03, 0x08, 0x0e, 0x08, 0xa4, 0x89, 0x15,
+  0x98, 0x28, 0x37, 0x88, 0x00, 0x21, 0x0d, 0x25, 0x81, 0x99, 0x08, 0xba,
+  0xba, 0x87, 0xe0, 0x8a, 0x19, 0x9b, 0x0a, 0xa8, 0xbe, 0x89, 0x00, 0x88,
+  0x33, 0x00, 0xdf, 0x32, 0x84, 0x10, 0x53, 0x81, 0x2b, 0x53, 0x01, 0x08,
+  0x84, 0xc0, 0x23, 0x22, 0xea, 0x08, 0x84, 0xa9, 0x80, 0x08, 0x0f, 0x21,
+  0xa8, 0x8f, 0x01, 0xbb, 0x4a, 0x03, 0xc8, 0xbc, 0xa0, 0x89, 0x32, 0xb8,
+  0xdf, 0x38, 0x98, 0x89, 0x42, 0xc0, 0xab, 0x54, 0x81, 0x11, 0x20, 0x8a,
+  0x62, 0x16, 0xa8, 0x12, 0x04, 0x08, 0x31, 0xa2, 0x8a, 0x80, 0xb3, 0x08,
+  0xb7, 0xaf, 0x89, 0x03, 0xea, 0xaa, 0x08, 0x0c, 0x48, 0xb8, 0x9d, 0x80,
+  0xa2, 0x20, 0x64, 0xa9, 0x0c, 0x22, 0x20, 0x00, 0xc3, 0xc0, 0x41, 0x81,
+  0xa9, 0x40, 0x80, 0x0d, 0x48, 0x80, 0xb9, 0x05, 0xc8, 0x12, 0x04, 0xaa,
+  0x5a, 0x25, 0xa9, 0x39, 0x03, 0x0d, 0x41, 0x91, 0x8a, 0x00, 0xe8, 0x1b,
+  0x24, 0xca, 0xab, 0x40, 0xab, 0x8a, 0x80, 0xae, 0x49, 0x98, 0x8a, 0x23,
+  0xc0, 0x9e, 0x41, 0xa2, 0x2a, 0x83, 0xc0, 0x30, 0x06, 0xc8, 0x48, 0x03,
+  0xaa, 0x50, 0x14, 0xc9, 0x21, 0xa1, 0x32, 0x32, 0xf8, 0x08, 0x16, 0x98,
+  0x1a, 0x28, 0xda, 0x30, 0x22, 0xbd, 0x08, 0x9d, 0x89, 0x22, 0xf8, 0xab,
+  0x39, 0xc8, 0x80, 0x80, 0xea, 0x09, 0x03, 0x08, 0x68, 0x80, 0xaa, 0x73,
+  0x83, 0x80, 0x40, 0x83, 0x40, 0x14, 0xa9, 0x2a, 0x17, 0x09, 0x28, 0x91,
+  0xbd, 0x39, 0x22, 0xbd, 0x80, 0xac, 0x9c, 0x43, 0xc9, 0x9c, 0x81, 0xc0,
+  0x10, 0x14, 0xcb, 0x19, 0x22, 0xd8, 0x32, 0x82, 0x0d, 0x21, 0x94, 0x0a,
+  0x68, 0x98, 0x2a, 0x15, 0xb8, 0x08, 0x85, 0xc0, 0x21, 0x84, 0x8b, 0x50,
+  0x83, 0xa9, 0x68, 0x98, 0x9c, 0x43, 0x98, 0x89, 0x80, 0xcd, 0x3b, 0x22,
+  0xbd, 0x09, 0xa1, 0xda, 0x48, 0x80, 0x0c, 0x28, 0xd2, 0x10, 0x14, 0xa0,
+  0x0a, 0x32, 0x80, 0x70, 0x13, 0xaa, 0x38, 0x84, 0xbb, 0x34, 0x08, 0x9f,
+  0x15, 0xc2, 0x0b, 0x48, 0x80, 0x08, 0x32, 0xae, 0x49, 0x21, 0xc8, 0x48,
+  0x80, 0x9c, 0x32, 0x85, 0x9b, 0x0a, 0xd8, 0x3c, 0x03, 0xf8, 0x89, 0x81,
+  0xb9, 0x4a, 0x80, 0xca, 0x2a, 0x02, 0x08, 0x78, 0xa9, 0x0c, 0x35, 0x81,
+  0x8b, 0x34, 0x00, 0x58, 0x21, 0xc8, 0x48, 0x84, 0x80, 0x42, 0x98, 0x8f,
+  0x20, 0x01, 0xa9, 0x80, 0xac, 0x0a, 0x85, 0xe0, 0x09, 0x08, 0xac, 0x38,
+  0x94, 0xc9, 0x89, 0xc2, 0x08, 0x22, 0xb8, 0x9e, 0x43, 0xc0, 0x09, 0x41,
+  0xa0, 0x5a, 0x11, 0x80, 0x80, 0x86, 0x80, 0x72, 0x80, 0x8a, 0x41, 0x11,
+  0x89, 0x84, 0xc0, 0x80, 0x84, 0xa0, 0x0a, 0x08, 0xbf, 0x80, 0x80, 0xaa,
+  0x0f, 0xb8, 0x9a, 0x04, 0xa8, 0x9d, 0x03, 0xa8, 0x2a, 0x17, 0xa0, 0x49,
+  0x08, 0x08, 0x25, 0x82, 0xba, 0x26, 0x01, 0x0d, 0x11, 0xb4, 0x80, 0x50,
+  0x9a, 0x08, 0x32, 0x0f, 0x28, 0x01, 0xda, 0x2a, 0x42, 0x0c, 0x08, 0xa8,
+  0x0a, 0x33, 0x08, 0x3d, 0x80, 0xaf, 0x0a, 0x15, 0xa0, 0xd8, 0x80, 0xa9,
+  0x22, 0xb6, 0x9a, 0x58, 0x80, 0x0c, 0x21, 0xa8, 0x8a, 0x87, 0x80, 0x20,
+  0x02, 0x8e, 0x40, 0x83, 0xa9, 0x08, 0x86, 0x80, 0x50, 0xb8, 0x0a, 0x52,
+  0xa0, 0x2a, 0x83, 0xcb, 0x2e, 0x41, 0x98, 0x0a, 0xa8, 0x8b, 0x70, 0xb4,
+  0xa9, 0x80, 0xb0, 0x8a, 0x07, 0x98, 0x0b, 0x80, 0x0f, 0x08, 0xa4, 0xc9,
+  0x48, 0x08, 0xb8, 0x58, 0x08, 0x58, 0x48, 0x98, 0x19, 0x42, 0x80, 0x50,
+  0x21, 0xaa, 0x08, 0x06, 0x88, 0x00, 0xb8, 0x0b, 0x08, 0x88, 0xaf, 0x80,
+  0x8f, 0x8b, 0x80, 0x80, 0x8e, 0x80, 0xd0, 0x48, 0x80, 0x80, 0x80, 0x06,
+  0x8c, 0x12, 0x04, 0x08, 0x08, 0x08, 0x08, 0x07, 0x80, 0x3d, 0x80, 0xa0,
+  0x38, 0x33, 0x8f, 0x80, 0xa2, 0x08, 0x08, 0xb7, 0x08, 0x60, 0x9a, 0x8c,
+  0x40, 0x98, 0x28, 0xaa, 0xbb, 0x3c, 0x80, 0x80, 0x80, 0xf0, 0xeb, 0x21,
+  0x02, 0x8b, 0x00, 0x88, 0x00, 0x27, 0x08, 0x08, 0x07, 0x80, 0x33, 0x08,
+  0x08, 0x58, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xef, 0x08, 0x08,
+  0x08, 0xd8, 0xec, 0x10, 0x82, 0xa0, 0x8b, 0x80, 0xcc, 0x26, 0x01, 0x0d,
+  0x08, 0xc8, 0x21, 0x04, 0xa8, 0x0a, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0xff, 0x85, 0x80, 0x80, 0x86, 0x80, 0x80, 0x50, 0x10, 0x02, 0xb5,
+  0x08, 0x38, 0x02, 0x08, 0x80, 0xd8, 0x8c, 0x80, 0xf0, 0x09, 0x88, 0xae,
+  0x89, 0x05, 0x9c, 0x0a, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0xf8, 0x3b,
+  0x74, 0x08, 0x0c, 0x48, 0x08, 0x80, 0x40, 0x80, 0x80, 0x80, 0x80, 0x35,
+  0x06, 0xaa, 0x38, 0x83, 0x80, 0x80, 0x45, 0x08, 0x08, 0x9f, 0x80, 0x33,
+  0x8f, 0x00, 0xa8, 0xea, 0xb0, 0x48, 0x08, 0xaa, 0xda, 0x0a, 0x58, 0xa0,
+  0x0a, 0x08, 0x08, 0x08, 0x58, 0x03, 0x08, 0x08, 0x36, 0x43, 0x97, 0x0a,
+  0x22, 0x85, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xdf, 0x80,
+  0x80, 0xf0, 0x09, 0x08, 0x08, 0x08, 0x9f, 0x80, 0x86, 0x00, 0xa8, 0xd2,
+  0x08, 0x08, 0x05, 0x08, 0xa8, 0x8b, 0x80, 0x50, 0xb3, 0x8c, 0x80, 0x80,
+  0xf0, 0x83, 0x80, 0x07, 0x80, 0xaa, 0x32, 0x00, 0x34, 0x80, 0x80, 0x80,
+  0x00, 0x88, 0x77, 0xaa, 0x08, 0x08, 0x08, 0x08, 0xaf, 0x08, 0x08, 0x08,
+  0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08,
+  0x08, 0x09, 0xff, 0xff, 0x08, 0x43, 0xb8, 0x0c, 0x08, 0x08, 0x08, 0x27,
+  0x80, 0x80, 0x80, 0x00, 0x37, 0x80, 0x08, 0x80, 0x37, 0x8f, 0x84, 0x80,
+  0x80, 0xb0, 0x8a, 0x8e, 0x22, 0xb0, 0x0b, 0xac, 0xb8, 0x8c, 0x07, 0x08,
+  0xaa, 0xb8, 0x4b, 0x02, 0x07, 0xa8, 0x49, 0x80, 0x05, 0x08, 0x08, 0x68,
+  0x80, 0x80, 0x50, 0x08, 0xd0, 0x28, 0x01, 0x80, 0x8e, 0x00, 0x88, 0x00,
+  0xac, 0x08, 0x07, 0xc8, 0xa0, 0x0a, 0x02, 0x8b, 0x70, 0xc0, 0x08, 0x0c,
+  0x88, 0x85, 0xa2, 0xa9, 0x88, 0x00, 0x08, 0x34, 0x80, 0x80, 0x80, 0x80,
+  0x57, 0x32, 0x80, 0x80, 0x80, 0x80, 0x70, 0x84, 0x97, 0x89, 0x08, 0x2a,
+  0x80, 0xc0, 0x8b, 0x80, 0xe0, 0x0b, 0x80, 0x80, 0x9f, 0xb8, 0x0b, 0x07,
+  0xa8, 0x0a, 0x33, 0x08, 0x08, 0x08, 0x78, 0x03, 0x8f, 0x08, 0x85, 0x82,
+  0x0a, 0x3d, 0x80, 0xb0, 0x03, 0x43, 0x0f, 0x9a, 0x08, 0x85, 0x84, 0xc0,
+  0x80, 0x10, 0xa2, 0x30, 0x48, 0xb2, 0x8b, 0x80, 0x80, 0x70, 0xb3, 0x8c,
+  0x80, 0x80, 0x9f, 0x38, 0x03, 0xbc, 0xbc, 0x00, 0x88, 0x80, 0x00, 0x88,
+  0xf0, 0x0e, 0x38, 0x03, 0x08, 0x9f, 0x68, 0x08, 0x48, 0xa9, 0x00, 0x04,
+  0x08, 0x08, 0x87, 0xa0, 0x19, 0x83, 0x80, 0x70, 0x80, 0x0c, 0x21, 0xb0,
+  0x8a, 0x07, 0x08, 0x0d, 0x08, 0x08, 0x08, 0x88, 0xf0, 0x88, 0xa0, 0x0b,
+  0x48, 0xf3, 0xa9, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00, 0x78,
+  0x56, 0x08, 0x08, 0x08, 0x08, 0x43, 0x87, 0x80, 0x00, 0xb8, 0x3a, 0x03,
+  0x08, 0xcd, 0x33, 0x8f, 0x80, 0x80, 0xba, 0x80, 0x80, 0xf0, 0x6a, 0xb8,
+  0x80, 0x80, 0x80, 0xc0, 0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x57, 0xf0,
+  0x10, 0x91, 0x8a, 0x16, 0x91, 0xaa, 0x2a, 0x03, 0x48, 0x03, 0xc8, 0x0c,
+  0x78, 0x0b, 0x21, 0x80, 0xb0, 0x0c, 0x33, 0xc0, 0x6c, 0xa0, 0x0a, 0x32,
+  0xae, 0x89, 0x85, 0xa2, 0x80, 0x80, 0x0e, 0x28, 0x82, 0x80, 0x80, 0xf0,
+  0x09, 0x32, 0x86, 0xab, 0x5a, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0xd8,
+  0x58, 0x08, 0xf8, 0x28, 0x82, 0x80, 0x80, 0x80, 0x80, 0x36, 0x8f, 0x80,
+  0x85, 0x80, 0x8b, 0x85, 0x80, 0x80, 0x00, 0x88, 0x00, 0x9f, 0x08, 0x78,
+  0xc0, 0x99, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0xe0, 0x8b, 0x34, 0x07,
+  0xaa, 0x00, 0x85, 0x8b, 0x32, 0x86, 0x80, 0x80, 0xba, 0x70, 0x21, 0xc8,
+  0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0xbf, 0x08, 0x08, 0x08, 0xbf,
+  0x43, 0xb8, 0x8b, 0x80, 0x80, 0x80, 0x80, 0xf0, 0x83, 0x87, 0x0b, 0x08,
+  0x80, 0x80, 0x78, 0x03, 0xd0, 0x7b, 0x80, 0x30, 0x32, 0x9e, 0x89, 0x04,
+  0x88, 0x20, 0x83, 0xbb, 0x08, 0x88, 0x00, 0x88, 0xf0, 0x0e, 0x38, 0xcb,
+  0x8a, 0x78, 0x90, 0x8a, 0x80, 0x0f, 0x48, 0x08, 0x08, 0x08, 0xb8, 0x4b,
+  0x33, 0x03, 0x08, 0x08, 0x08, 0x08, 0x57, 0xca, 0x80, 0x07, 0x9a, 0x48,
+  0x80, 0xaa, 0x30, 0x83, 0xf0, 0x83, 0xe0, 0x80, 0x84, 0xa9, 0x80, 0x23,
+  0xf0, 0x80, 0x08, 0x08, 0x80, 0x87, 0x0b, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0xaf, 0x80, 0x00, 0x88, 0x17, 0xba, 0x00, 0x08, 0x88, 0x60, 0x03, 0xbc,
+  0x08, 0x08, 0x08, 0x27, 0x07, 0x0c, 0x08, 0x08, 0x58, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x08, 0x08, 0x80, 0x08, 0x80, 0xaf, 0x06, 0xbc, 0x80, 0x34,
+  0x8f, 0x8b, 0x32, 0x08, 0x08, 0xc8, 0x0c, 0x08, 0x08, 0x08, 0x08, 0xf8,
+  0x3c, 0x73, 0xa0, 0x0a, 0x08, 0x80, 0x43, 0x03, 0x0c, 0x08, 0x08, 0x78,
+  0x32, 0xc3, 0x8a, 0x80, 0x08, 0x68, 0xb3, 0x0c, 0x08, 0x08, 0xf8, 0x0a,
+  0x78, 0x8b, 0x00, 0xab, 0x08, 0x08, 0xb4, 0x08, 0x08, 0xbe, 0x08, 0x57,
+  0x08, 0x8b, 0x80, 0x80, 0x33, 0x80, 0x08, 0x08, 0x80, 0x08, 0x67, 0x08,
+  0x8e, 0x40, 0x08, 0x08, 0x08, 0xe8, 0x48, 0x80, 0x0c, 0x08, 0x04, 0x8c,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0xf0, 0x83, 0xca, 0x30, 0x83, 0xf0, 0x09,
+  0x08, 0x08, 0x78, 0x00, 0x08, 0x08, 0xf8, 0x80, 0x84, 0x94, 0x0a, 0x80,
+  0x80, 0x08, 0x43, 0x80, 0x80, 0xd0, 0x0c, 0x33, 0x80, 0xe0, 0x0b, 0x80,
+  0x80, 0x78, 0xb8, 0x00, 0x88, 0x80, 0x00, 0x88, 0xdf, 0x30, 0x83, 0xf0,
+  0x09, 0x68, 0x08, 0x08, 0x08, 0x8d, 0x22, 0x08, 0x08, 0x80, 0xf8, 0x39,
+  0x82, 0x00, 0xf8, 0x09, 0x20, 0x33, 0xc3, 0x0b, 0x3c, 0x80, 0x40, 0x04,
+  0x08, 0xf8, 0x83, 0x00, 0x88, 0x00, 0x08, 0x88, 0x00, 0xf8, 0x0e, 0x95,
+  0x8a, 0x80, 0xf0, 0x80, 0x28, 0xa2, 0x8a, 0x08, 0xbc, 0x48, 0x03, 0x80,
+  0x08, 0x80, 0x08, 0x70, 0x05, 0x08, 0x08, 0x08, 0x08, 0x78, 0xe4, 0x80,
+  0x84, 0x80, 0x00, 0x88, 0x00, 0x88, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00,
+  0xf8, 0xaf, 0x53, 0xe8, 0x08, 0x08, 0x08, 0x08, 0x08, 0x9f, 0x80, 0x80,
+  0x08, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x78, 0x27, 0x08, 0x08, 0xbe,
+  0x24, 0x33, 0x80, 0x80, 0x80, 0x3f, 0x30, 0xb4, 0x0c, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0xdf, 0x08, 0x80, 0x80, 0x08, 0xbe, 0x78, 0x00, 0xaa, 0x08,
+  0x33, 0x80, 0x80, 0x80, 0xbf, 0x07, 0x08, 0x88, 0x00, 0xf8, 0x48, 0x08,
+  0x08, 0xc8, 0x08, 0x38, 0x02, 0x08, 0xf0, 0x59, 0x08, 0x08, 0x32, 0xb8,
+  0x0c, 0x08, 0x78, 0x81, 0x80, 0xbb, 0x70, 0x80, 0x0c, 0x28, 0x02, 0x8e,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xbf, 0x48, 0x03, 0x08, 0x08,
+  0xbe, 0x08, 0x07, 0x00, 0x08, 0x88, 0x00, 0x3f, 0x08, 0x08, 0xc8, 0x03,
+  0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x78, 0x27, 0xf0, 0x59, 0x08,
+  0x80, 0x08, 0xb0, 0x8b, 0x08, 0x08, 0x80, 0x08, 0x80, 0xff, 0x20, 0x02,
+  0x08, 0xbc, 0x08, 0x08, 0x08, 0x08, 0x78, 0x05, 0x0f, 0x08, 0x08, 0x04,
+  0x88, 0x23, 0x80, 0x8f, 0x80, 0x85, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00,
+  0xe8, 0x8b, 0x80, 0x80, 0x00, 0x88, 0xf0, 0x2e, 0xb3, 0x0b, 0x88, 0x00,
+  0x88, 0x37, 0xf0, 0x88, 0x20, 0x83, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x80, 0x77, 0x03, 0x9f, 0x08, 0x80, 0x07, 0x08, 0x08, 0x0b,
+  0x83, 0x80, 0x80, 0x80, 0xbf, 0x08, 0x08, 0x08, 0x08, 0x08, 0xef, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x78, 0x07, 0x00, 0x08, 0x08,
+  0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xff, 0xff, 0x08, 0x08, 0x78, 0xd1, 0x80, 0x08, 0x80, 0x48, 0x02,
+  0x08, 0x08, 0x08, 0x08, 0x37, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08,
+  0x80, 0x08, 0x08, 0x08, 0xf8, 0xff, 0x09, 0x88, 0x00, 0x88, 0x00, 0x88,
+  0x00, 0xff, 0x09, 0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x70, 0x67, 0x80, 0x08, 0x80, 0x80, 0x37, 0x08, 0x88, 0x80, 0x00,
+  0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0xff, 0x8f, 0x80, 0x80, 0x80,
+  0x80, 0x00, 0xcf, 0x08, 0x08, 0x08, 0x08, 0x70, 0x03, 0x8f, 0x08, 0x38,
+  0x02, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x70,
+  0x17, 0x0f, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00, 0x08,
+  0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x80, 0xff, 0xbf,
+  0x08, 0x27, 0x08, 0xf8, 0x28, 0x82, 0x80, 0x80, 0x80, 0x80, 0x80, 0x70,
+  0x84, 0x80, 0xf0, 0x09, 0x85, 0x80, 0xd0, 0x80, 0x80, 0x08, 0x80, 0x08,
+  0x80, 0x08, 0xbf, 0x80, 0x00, 0x08, 0x45, 0x80, 0x8f, 0x08, 0x08, 0x60,
+  0x80, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x70, 0x05, 0x08, 0x08,
+  0x08, 0x0f, 0x83, 0xf0, 0x88, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+  0xdf, 0x23, 0x00, 0xbc, 0x88, 0x00, 0x88, 0x37, 0x08, 0x08, 0x08, 0xf8,
+  0x03, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x77, 0xc9, 0x80,
+  0x80, 0x00, 0x88, 0x37, 0x0f, 0x08, 0x08, 0x88, 0x00, 0x88, 0x80, 0x00,
+  0x88, 0x00, 0x88, 0x00, 0x88, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08,
+  0x00, 0x00, 0x00, 0x00, 0xa7, 0x08, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00,
+  0xff, 0x04, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x77, 0x77, 0x0e, 0x08, 0x08, 0x68, 0xa9, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0xff, 0x3a,
+  0x85, 0xf0, 0x08, 0x08, 0x08, 0x86, 0x80, 0x00, 0x88, 0x00, 0x88, 0x80,
+  0x00, 0x37, 0xcb, 0x08, 0x58, 0x02, 0x80, 0x08, 0x80, 0xf8, 0x8b, 0x00,
+  0x44, 0x0f, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0xf8, 0x0a, 0x88, 0x34,
+  0x80, 0xf0, 0x83, 0x00, 0x88, 0x00, 0x08, 0x88, 0x00, 0x88, 0x77, 0xc8,
+  0x08, 0x08, 0x86, 0xc0, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x08, 0xbf,
+  0x70, 0x80, 0x80, 0x0d, 0x03, 0x08, 0x08, 0x8b, 0x84, 0x80, 0x80, 0x00,
+  0x88, 0x00, 0x08, 0x78, 0xa7, 0xba, 0x8c, 0x07, 0x83, 0x0c, 0xc8, 0x03,
+  0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80,
+  0xf0, 0xdf, 0x87, 0x80, 0xd0, 0x80, 0x84, 0x80, 0x80, 0x00, 0x08, 0x88,
+  0x00, 0x78, 0x82, 0x8e, 0x80, 0x05, 0x08, 0xaa, 0x88, 0x00, 0x88, 0x00,
+  0x88, 0x00, 0xf8, 0x0e, 0x32, 0x08, 0x8f, 0x08, 0x08, 0x06, 0xaa, 0x85,
+  0x80, 0x80, 0x80, 0x80, 0x07, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x80, 0xdf, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0xdf, 0x80, 0x70, 0x80,
+  0xaa, 0x80, 0x70, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x80, 0x70, 0xa7, 0x8a, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08,
+  0x78, 0x27, 0x8f, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x80, 0xf8, 0x0d,
+  0x78, 0x80, 0x08, 0xaa, 0x08, 0x08, 0x58, 0x83, 0x08, 0x8f, 0x28, 0x83,
+  0x70, 0xc0, 0x08, 0x84, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0xcd, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0xcf, 0x80, 0x80, 0x80, 0x80, 0x08, 0x70, 0x85,
+  0x80, 0x80, 0x80, 0x80, 0x70, 0x03, 0xbc, 0x08, 0x08, 0x68, 0x03, 0xf8,
+  0x88, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0xf8, 0x3d, 0x83, 0x08, 0x80,
+  0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08,
+  0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf0, 0xff, 0x05, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88,
+  0x77, 0x8c, 0x30, 0x85, 0xbb, 0x08, 0x35, 0xb8, 0x0d, 0x08, 0x08, 0x88,
+  0x00, 0x88, 0x00, 0xff, 0x80, 0x78, 0x08, 0xb8, 0x08, 0x08, 0x33, 0x08,
+  0x08, 0x08, 0x88, 0x00, 0x78, 0x87, 0x80, 0x3a, 0x08, 0x9f, 0x80, 0x80,
+  0x80, 0x00, 0xd8, 0x6c, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08,
+  0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x09,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x77, 0xd7, 0x08, 0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0xf8,
+  0xbf, 0x44, 0x08, 0x1f, 0x82, 0xa8, 0x8a, 0x07, 0x88, 0x20, 0xa8, 0x80,
+  0x08, 0x17, 0x88, 0x00, 0xf8, 0x08, 0x58, 0x08, 0x0c, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x9f, 0xa2, 0x80, 0x43, 0x08, 0xf8, 0x21, 0x08, 0x08, 0x08,
+  0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0xf0, 0xff, 0x05, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88, 0x00,
+  0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+  0xff, 0x05, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x77, 0x82, 0xf0, 0x09,
+  0x38, 0x83, 0xb8, 0x0d, 0x08, 0x08, 0x08, 0x08, 0x08, 0x88, 0xef, 0x38,
+  0x03, 0xf8, 0x88, 0x50, 0x98, 0x8a, 0x33, 0x88, 0x00, 0x88, 0x00, 0x88,
+  0x00, 0x88, 0x77, 0xe0, 0x80, 0x80, 0x05, 0xc8, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x08, 0x08,
+  0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xff, 0x04, 0x78, 0x0b, 0x08, 0x08, 0x08, 0x37, 0x8f, 0x80,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08,
+  0xf8, 0x5f, 0x08, 0x08, 0x08, 0x08, 0x88, 0x80, 0xb7, 0x80, 0x77, 0xb9,
+  0x88, 0x70, 0xd1, 0x80, 0x08, 0x08, 0x80, 0x08, 0x80, 0x80, 0x08, 0xcf,
+  0x60, 0x80, 0x80, 0x80, 0xc0, 0x3b, 0x84, 0x80, 0x00, 0x88, 0x00, 0x88,
+  0x70, 0xa6, 0x0b, 0x08, 0x88, 0x50, 0xe4, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x08, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08,
+  0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x8a,
+  0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x77, 0x07, 0x08, 0xf8,
+  0x88, 0x20, 0xb3, 0x0c, 0x08, 0x08, 0x08, 0x08, 0x08, 0xdf, 0x80, 0x80,
+  0x80, 0x17, 0xa8, 0x0b, 0x07, 0x08, 0x88, 0x00, 0x88, 0x00, 0x88, 0x00,
+  0x78, 0xe4, 0x08, 0x08, 0x80, 0x08, 0x80, 0x08, 0x08, 0x80, 0x08, 0x80,
+  0x08, 0x80, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x70, 0x77, 0xe7, 0x80, 0x80, 0x20, 0x83, 0xf0, 0x88, 0x80,
+  0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0xdf, 0x78, 0xb8, 0x00, 0x48, 0xa9,
+  0x80, 0x78, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x68, 0xb3, 0x0c,
+  0x78, 0x00, 0xba, 0x80, 0x80, 0x80, 0x00, 0x88, 0x00, 0x88, 0x00, 0x88,
+  0x00, 0x08, 0x08, 0x08, 0x88, 0x80, 0x80, 0x90, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x80, 0x80, 0xf0, 0xff,
+  0x3f, 0x02, 0x08, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x80,
+  0x80, 0x80, 0x08, 0x08, 0x08, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x70, 0xc7, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+  0x80, 0x80, 0x80, 0x00, 0x00, 0xff, 0xff, 0x86, 0x80, 0x80, 0x8d, 0x40,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0x70, 0x17,
+  0xf8, 0x80, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08, 0x80, 0x08,
+  0x80, 0x08, 0x08, 0x08, 0x08, 0x80, 0x80, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x02, 0x80, 0x80, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x77, 0x8d, 0x80, 0x36, 0xf0, 0x88,
+  0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x88, 0x3f, 0x80, 0x80, 0x80, 0x80,
+  0x80, 0x80, 0x08, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x09, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xf0, 0xff, 0x05, 0x08, 0x08, 0x08, 0x08, 0x88, 0x00, 0x88,
+  0x80, 0x80, 0x80, 0x00, 0x08, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const SoundAsset sound_system_notification_4 = {
+    SOUND_IMA_ADPCM, 44100, 31104, sound_system_notification_4_data, sizeof(sound_system_notification_4_data)
 };
-unsigned int __734443__universfield__system_notification_4_wav_len = 62330;
@@ -0,0 +1,109 @@
+#include "audio_mixer.h"
+
+void Resampler::reset(uint32_t in_rate, uint32_t out_rate) {
+    step_ = (uint32_t)(((uint64_t)in_rate << 16) / (out_rate ? out_rate : in_rate));
+    phase_ = 0;
+    primed_ = false;
+    in_len_ = in_pos_ = 0;
+}
+
+bool Resampler::next(SoundStream &src, int16_t &sample) {
+    if (in_pos_ == in_len_) {
+        in_len_ = src.read(in_, RESAMPLER_INPUT_CHUNK);
+        in_pos_ = 0;
+        if (!in_len_) {
+            return false;
+        }
+    }
+    sample = in_[in_pos_++];
+    return true;
+}
+
+size_t Resampler::process(SoundStream &src, int16_t *out, size_t n) {
+    if (!primed_) {
+        if (!next(src, s0_) || !next(src, s1_)) {
+            return 0;
+        }
+        primed_ = true;
+    }
+    size_t produced = 0;
+    while (produced < n) {
+        while (phase_ >= (1u << 16)) {
+            s0_ = s1_;
+            if (!next(src, s1_)) {
+                return produced;
+            }
+            phase_ -= 1u << 16;
+        }
+        out[produced++] = (int16_t)(s0_ + (((int32_t)(s1_ - s0_) * (int32_t)phase_) >> 16));
+        phase_ += step_;
+    }
+    return produced;
+}
+
+void AudioMixer::play(const SoundAsset &sound, bool preempt) {
+    if (preempt) {
+        stopAll();
+    }
+    Voice *v = &voices_[0];
+    for (Voice &candidate : voices_) {
+        if (!candidate.playing) {
+            v = &candidate;
+            break;
+        }
+        if (candidate.started < v->started) {
+            v = &candidate;
+        }
+    }
+    v->stream.start(&sound);
+    v->resampler.reset(sound.sample_rate, out_rate_);
+    v->playing = true;
+    v->started = ++sequence_;
+}
+
+void AudioMixer::stopAll() {
+    for (Voice &v : voices_) {
+        v.stream.stop();
+        v.playing = false;
+    }
+}
+
+bool AudioMixer::active() const {
+    for (const Voice &v : voices_) {
+        if (v.playing) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AudioMixer::render(int16_t *out, size_t n) {
+    if (!active()) {
+        return false;
+    }
+    int32_t acc[RESAMPLER_INPUT_CHUNK];
+    int16_t tmp[RESAMPLER_INPUT_CHUNK];
+    for (size_t done = 0; done < n; done += RESAMPLER_INPUT_CHUNK) {
+        size_t len = n - done < RESAMPLER_INPUT_CHUNK ? n - done : RESAMPLER_INPUT_CHUNK;
+        for (size_t i = 0; i < len; i++) {
+            acc[i] = 0;
+        }
+        for (Voice &v : voices_) {
+            if (!v.playing) {
+                continue;
+            }
+            size_t got = v.resampler.process(v.stream, tmp, len);
+            for (size_t i = 0; i < got; i++) {
+                acc[i] += tmp[i];
+            }
+            if (got < len) {
+                v.playing = false;
+            }
+        }
+        for (size_t i = 0; i < len; i++) {
+            int32_t s = acc[i];
+            out[done + i] = (int16_t)(s > 32767 ? 32767 : s < -32768 ? -32768 : s);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "sound_asset.h"
+
+#define AUDIO_MAX_VOICES 2
+#define RESAMPLER_INPUT_CHUNK 64
+
+// Linear-interpolation sample rate converter pulling from a SoundStream.
+// Good enough for chimes; there is no anti-alias filter when going down.
+class Resampler {
+  public:
+    void reset(uint32_t in_rate, uint32_t out_rate);
+
+    // Produce up to n output samples, fewer once the stream ends.
+    size_t process(SoundStream &src, int16_t *out, size_t n);
+
+  private:
+    bool next(SoundStream &src, int16_t &sample);
+
+    uint32_t step_ = 1 << 16;  // input samples per output sample, 16.16
+    uint32_t phase_ = 0;       // position between s0_ and s1_, 16.16
+    int16_t s0_ = 0;
+    int16_t s1_ = 0;
+    bool primed_ = false;
+    int16_t in_[RESAMPLER_INPUT_CHUNK];
+    size_t in_len_ = 0;
+    size_t in_pos_ = 0;
+};
+
+// Mixes up to AUDIO_MAX_VOICES sounds at a common output rate. Not thread
+// safe; owned by the playback task.
+class AudioMixer {
+  public:
+    explicit AudioMixer(uint32_t out_rate) : out_rate_(out_rate) {}
+
+    // Start a sound. preempt silences all other voices, otherwise it
+    // plays alongside them, replacing the oldest voice if all are busy.
+    void play(const SoundAsset &sound, bool preempt);
+    void stopAll();
+
+    // Mix n samples into out. Returns false (and leaves out untouched)
+    // if no voice is playing.
+    bool render(int16_t *out, size_t n);
+
+    bool active() const;
+    uint32_t outputRate() const {
+        return out_rate_;
+    }
+
+  private:
+    struct Voice {
+        SoundStream stream;
+        Resampler resampler;
+        bool playing = false;
+        uint32_t started = 0;
+    };
+
+    uint32_t out_rate_;
+    uint32_t sequence_ = 0;
+    Voice voices_[AUDIO_MAX_VOICES];
+};
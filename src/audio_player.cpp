@@ -0,0 +1,60 @@
+#include "audio_player.h"
+
+#include <M5CoreS3.h>
+#include <chrono>
+
+#include "pipeline.h"
+
+// the speaker holds one block playing and one queued
+#define SPEAKER_QUEUE 2
+
+AudioPlayer::AudioPlayer(uint8_t channel)
+    : channel_(channel), commands_(AUDIO_COMMAND_DEPTH), mixer_(AUDIO_OUTPUT_RATE) {}
+
+void AudioPlayer::begin(int core, int prio) {
+    task_ = startPinnedThread("audio", core, 4096, prio, [this] { run(); });
+}
+
+void AudioPlayer::play(const SoundAsset &sound, bool preempt) {
+    commands_.push(Command{&sound, preempt});
+}
+
+void AudioPlayer::run() {
+    const auto block_time = std::chrono::milliseconds(
+        AUDIO_BLOCK_SAMPLES * 1000 / AUDIO_OUTPUT_RATE);
+    for (;;) {
+        bool busy = mixer_.active() || ring_.filled() > 0;
+        // nothing playing: sleep on the command queue
+        Command cmd;
+        uint32_t wait_ms = busy ? 0 : 1000;
+        while (commands_.pop(cmd, wait_ms)) {
+            wait_ms = 0;
+            if (cmd.preempt) {
+                CoreS3.Speaker.stop(channel_);
+                ring_.clear();
+                in_flight_ = 0;
+            }
+            mixer_.play(*cmd.sound, cmd.preempt);
+        }
+
+        // retire the blocks the speaker is done with
+        size_t queued = CoreS3.Speaker.isPlaying(channel_);
+        if (queued < in_flight_) {
+            ring_.consume(in_flight_ - queued);
+            in_flight_ = queued;
+        }
+
+        int16_t *block;
+        while ((block = ring_.writeBlock()) && mixer_.render(block, AUDIO_BLOCK_SAMPLES)) {
+            ring_.commit();
+        }
+        while (in_flight_ < SPEAKER_QUEUE && (block = ring_.readBlock(in_flight_))) {
+            CoreS3.Speaker.playRaw(block, AUDIO_BLOCK_SAMPLES, AUDIO_OUTPUT_RATE,
+                                   false, 1, channel_, false);
+            in_flight_++;
+        }
+        if (ring_.filled() > 0) {
+            std::this_thread::sleep_for(block_time / 2);
+        }
+    }
+}
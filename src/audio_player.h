@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+#include "audio_mixer.h"
+#include "audio_ring.h"
+#include "bounded_queue.h"
+#include "sound_asset.h"
+
+// Output rate of the mixer. Lower than the assets' 44.1 kHz to cut I2S
+// DMA and bus traffic; chimes don't need more.
+#ifndef AUDIO_OUTPUT_RATE
+#define AUDIO_OUTPUT_RATE 22050
+#endif
+#define AUDIO_BLOCK_SAMPLES 512 // ~23 ms at 22.05 kHz
+#define AUDIO_BLOCKS 4
+#define AUDIO_COMMAND_DEPTH 4
+
+// Low-priority playback task. Sounds are decoded, resampled and mixed a
+// block at a time into a small ring, and the speaker plays straight out
+// of the ring, so a chime never needs more than AUDIO_BLOCKS blocks of
+// RAM and never runs on the decode core.
+class AudioPlayer {
+  public:
+    explicit AudioPlayer(uint8_t channel = 0);
+
+    void begin(int core = 0, int prio = 1);
+
+    // Start a sound from any task. preempt cuts off what's playing,
+    // otherwise the sound is mixed in.
+    void play(const SoundAsset &sound, bool preempt = true);
+
+  private:
+    struct Command {
+        const SoundAsset *sound;
+        bool preempt;
+    };
+
+    void run();
+
+    uint8_t channel_;
+    BoundedQueue<Command> commands_;
+    AudioMixer mixer_;
+    AudioRing<AUDIO_BLOCK_SAMPLES, AUDIO_BLOCKS> ring_;
+    size_t in_flight_ = 0; // ring blocks handed to the speaker
+    std::thread task_;
+};
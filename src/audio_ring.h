@@ -0,0 +1,47 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Single-producer single-consumer ring of 16 bit samples, split into
+// fixed-size blocks so the consumer can hand whole blocks to the speaker
+// without copying. A block stays owned by the consumer until consume()d.
+template <size_t BlockSamples, size_t Blocks>
+class AudioRing {
+  public:
+    // Next block to fill, or nullptr if the ring is full.
+    int16_t *writeBlock() {
+        return full() ? nullptr : blocks_[head_ % Blocks];
+    }
+    void commit() {
+        head_++;
+    }
+
+    // Oldest filled block, or nullptr if the ring is empty.
+    int16_t *readBlock(size_t index = 0) {
+        return filled() > index ? blocks_[(tail_ + index) % Blocks] : nullptr;
+    }
+    void consume(size_t n = 1) {
+        tail_ += n;
+    }
+
+    size_t filled() const {
+        return head_ - tail_;
+    }
+    bool full() const {
+        return filled() == Blocks;
+    }
+    void clear() {
+        tail_.store(head_.load());
+    }
+
+    static constexpr size_t blockSamples() {
+        return BlockSamples;
+    }
+
+  private:
+    int16_t blocks_[Blocks][BlockSamples];
+    std::atomic<size_t> head_{0}; // written by the producer only
+    std::atomic<size_t> tail_{0}; // written by the consumer only
+};
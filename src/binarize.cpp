@@ -0,0 +1,163 @@
+#include "binarize.h"
+
+#if QR_BINARIZE_BACKEND == QR_BINARIZE_SSE2
+#include <emmintrin.h>
+#elif QR_BINARIZE_BACKEND == QR_BINARIZE_AVX2
+#include <immintrin.h>
+#endif
+
+void binarizeScalar(const uint8_t *src, uint8_t *dst, size_t n,
+                    uint8_t threshold) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = src[i] < threshold ? 0 : 255;
+    }
+}
+
+void binarizeMapScalar(const uint8_t *src, const uint8_t *threshold,
+                       uint8_t *dst, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        dst[i] = src[i] < threshold[i] ? 0 : 255;
+    }
+}
+
+#if QR_BINARIZE_BACKEND == QR_BINARIZE_SSE2
+
+// max(src, t) == src exactly when src >= t, giving 0xff for white
+void binarize(const uint8_t *src, uint8_t *dst, size_t n, uint8_t threshold) {
+    const __m128i t = _mm_set1_epi8((char)threshold);
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        _mm_storeu_si128((__m128i *)(dst + i),
+                         _mm_cmpeq_epi8(_mm_max_epu8(s, t), s));
+    }
+    binarizeScalar(src + i, dst + i, n - i, threshold);
+}
+
+void binarizeMap(const uint8_t *src, const uint8_t *threshold, uint8_t *dst,
+                 size_t n) {
+    size_t i = 0;
+    for (; i + 16 <= n; i += 16) {
+        __m128i s = _mm_loadu_si128((const __m128i *)(src + i));
+        __m128i t = _mm_loadu_si128((const __m128i *)(threshold + i));
+        _mm_storeu_si128((__m128i *)(dst + i),
+                         _mm_cmpeq_epi8(_mm_max_epu8(s, t), s));
+    }
+    binarizeMapScalar(src + i, threshold + i, dst + i, n - i);
+}
+
+const char *binarizeBackend() {
+    return "sse2";
+}
+
+#elif QR_BINARIZE_BACKEND == QR_BINARIZE_AVX2
+
+void binarize(const uint8_t *src, uint8_t *dst, size_t n, uint8_t threshold) {
+    const __m256i t = _mm256_set1_epi8((char)threshold);
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        _mm256_storeu_si256((__m256i *)(dst + i),
+                            _mm256_cmpeq_epi8(_mm256_max_epu8(s, t), s));
+    }
+    binarizeScalar(src + i, dst + i, n - i, threshold);
+}
+
+void binarizeMap(const uint8_t *src, const uint8_t *threshold, uint8_t *dst,
+                 size_t n) {
+    size_t i = 0;
+    for (; i + 32 <= n; i += 32) {
+        __m256i s = _mm256_loadu_si256((const __m256i *)(src + i));
+        __m256i t = _mm256_loadu_si256((const __m256i *)(threshold + i));
+        _mm256_storeu_si256((__m256i *)(dst + i),
+                            _mm256_cmpeq_epi8(_mm256_max_epu8(s, t), s));
+    }
+    binarizeMapScalar(src + i, threshold + i, dst + i, n - i);
+}
+
+const char *binarizeBackend() {
+    return "avx2";
+}
+
+#elif QR_BINARIZE_BACKEND == QR_BINARIZE_PIE
+
+// The PIE only has signed byte compares, so both operands are flipped
+// into signed range (x ^ 0x80) first. EE.VLD/VST.128 ignore the low four
+// address bits, hence the alignment check and scalar fallback.
+static const uint8_t sign_bit = 0x80;
+
+static bool aligned16(const void *p) {
+    return ((uintptr_t)p & 15) == 0;
+}
+
+void binarize(const uint8_t *src, uint8_t *dst, size_t n, uint8_t threshold) {
+    size_t blocks = aligned16(src) && aligned16(dst) ? n / 16 : 0;
+    if (blocks) {
+        const uint8_t *s = src;
+        uint8_t *d = dst;
+        __asm__ __volatile__(
+            "ee.vldbc.8     q7, %[sign]\n"
+            "ee.vldbc.8     q1, %[thr]\n"
+            "ee.xorq        q1, q1, q7\n"
+            "loopnez        %[cnt], 1f\n"
+            "ee.vld.128.ip  q0, %[s], 16\n"
+            "ee.xorq        q0, q0, q7\n"
+            "ee.vcmp.lt.s8  q2, q0, q1\n"
+            "ee.notq        q2, q2\n"
+            "ee.vst.128.ip  q2, %[d], 16\n"
+            "1:\n"
+            : [s] "+r"(s), [d] "+r"(d)
+            : [cnt] "r"(blocks), [sign] "r"(&sign_bit), [thr] "r"(&threshold)
+            : "memory");
+    }
+    size_t done = blocks * 16;
+    binarizeScalar(src + done, dst + done, n - done, threshold);
+}
+
+void binarizeMap(const uint8_t *src, const uint8_t *threshold, uint8_t *dst,
+                 size_t n) {
+    size_t blocks = aligned16(src) && aligned16(threshold) && aligned16(dst)
+                    ? n / 16 : 0;
+    if (blocks) {
+        const uint8_t *s = src;
+        const uint8_t *t = threshold;
+        uint8_t *d = dst;
+        __asm__ __volatile__(
+            "ee.vldbc.8     q7, %[sign]\n"
+            "loopnez        %[cnt], 1f\n"
+            "ee.vld.128.ip  q0, %[s], 16\n"
+            "ee.vld.128.ip  q1, %[t], 16\n"
+            "ee.xorq        q0, q0, q7\n"
+            "ee.xorq        q1, q1, q7\n"
+            "ee.vcmp.lt.s8  q2, q0, q1\n"
+            "ee.notq        q2, q2\n"
+            "ee.vst.128.ip  q2, %[d], 16\n"
+            "1:\n"
+            : [s] "+r"(s), [t] "+r"(t), [d] "+r"(d)
+            : [cnt] "r"(blocks), [sign] "r"(&sign_bit)
+            : "memory");
+    }
+    size_t done = blocks * 16;
+    binarizeMapScalar(src + done, threshold + done, dst + done, n - done);
+}
+
+const char *binarizeBackend() {
+    return "esp32s3-pie";
+}
+
+#else
+
+void binarize(const uint8_t *src, uint8_t *dst, size_t n, uint8_t threshold) {
+    binarizeScalar(src, dst, n, threshold);
+}
+
+void binarizeMap(const uint8_t *src, const uint8_t *threshold, uint8_t *dst,
+                 size_t n) {
+    binarizeMapScalar(src, threshold, dst, n);
+}
+
+const char *binarizeBackend() {
+    return "scalar";
+}
+
+#endif
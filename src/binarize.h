@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#ifdef ESP_PLATFORM
+#include <sdkconfig.h> // CONFIG_IDF_TARGET_*, for the default backend
+#if !defined(CONFIG_IDF_TARGET)
+#error "sdkconfig.h didn't define the target, the binarize backend can't be picked"
+#endif
+#endif
+
+// Thresholding kernels, dst[i] = src[i] < threshold ? 0 : 255. The backend
+// is picked at compile time with QR_BINARIZE_BACKEND; by default the best
+// one the target supports. All backends produce bit-identical output.
+#define QR_BINARIZE_SCALAR 0
+#define QR_BINARIZE_SSE2 1
+#define QR_BINARIZE_AVX2 2
+#define QR_BINARIZE_PIE 3 // ESP32-S3 processor instruction extensions
+
+#ifndef QR_BINARIZE_BACKEND
+#if defined(__AVX2__)
+#define QR_BINARIZE_BACKEND QR_BINARIZE_AVX2
+#elif defined(__SSE2__)
+#define QR_BINARIZE_BACKEND QR_BINARIZE_SSE2
+#elif defined(CONFIG_IDF_TARGET_ESP32S3)
+#define QR_BINARIZE_BACKEND QR_BINARIZE_PIE
+#else
+#define QR_BINARIZE_BACKEND QR_BINARIZE_SCALAR
+#endif
+#endif
+
+// One threshold for all n pixels.
+void binarize(const uint8_t *src, uint8_t *dst, size_t n, uint8_t threshold);
+
+// A threshold per pixel, e.g. from a local mean (adaptive thresholding).
+void binarizeMap(const uint8_t *src, const uint8_t *threshold, uint8_t *dst,
+                 size_t n);
+
+// Scalar reference versions, always available for equivalence checks.
+void binarizeScalar(const uint8_t *src, uint8_t *dst, size_t n,
+                    uint8_t threshold);
+void binarizeMapScalar(const uint8_t *src, const uint8_t *threshold,
+                       uint8_t *dst, size_t n);
+
+// Name of the compiled-in backend, logged at startup.
+const char *binarizeBackend();
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Fixed-capacity FIFO shared between tasks. Storage is allocated once at
+// construction, push() never blocks: when the queue is full the oldest
+// entry is evicted so the consumer always sees the most recent items.
+template <typename T>
+class BoundedQueue {
+  public:
+    explicit BoundedQueue(size_t capacity) : slots_(capacity ? capacity : 1) {}
+
+    // Returns true if an entry had to be evicted to make room. If evicted
+    // is non-null the dropped entry is moved there so the caller can
+    // release whatever it owns.
+    bool push(const T &item, T *evicted = nullptr) {
+        bool dropped = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (closed_) {
+                if (evicted) {
+                    *evicted = item;
+                }
+                return true;
+            }
+            if (count_ == slots_.size()) {
+                if (evicted) {
+                    *evicted = slots_[head_];
+                }
+                head_ = (head_ + 1) % slots_.size();
+                count_--;
+                dropped = true;
+            }
+            slots_[(head_ + count_) % slots_.size()] = item;
+            count_++;
+        }
+        not_empty_.notify_one();
+        return dropped;
+    }
+
+    // Wait up to timeout_ms for an entry. Returns false on timeout or
+    // once the queue has been closed and drained.
+    bool pop(T &item, uint32_t timeout_ms) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!not_empty_.wait_for(lock, std::chrono::milliseconds(timeout_ms),
+                                 [this] { return count_ > 0 || closed_; })) {
+            return false;
+        }
+        if (count_ == 0) {
+            return false;
+        }
+        item = slots_[head_];
+        head_ = (head_ + 1) % slots_.size();
+        count_--;
+        return true;
+    }
+
+    // Wake all waiters; subsequent pushes are rejected as evictions.
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            closed_ = true;
+        }
+        not_empty_.notify_all();
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return count_;
+    }
+
+    size_t capacity() const {
+        return slots_.size();
+    }
+
+  private:
+    mutable std::mutex mutex_;
+    std::condition_variable not_empty_;
+    std::vector<T> slots_;
+    size_t head_ = 0;
+    size_t count_ = 0;
+    bool closed_ = false;
+};
@@ -0,0 +1,48 @@
+#include "camera_frame_source.h"
+
+#include <Arduino.h>
+
+#include "stage_timer.h"
+
+// camera resolutions the decoder may switch between, cheapest first.
+// The CoreS3's GC0308 sensor tops out at VGA, so there is no SVGA step.
+static const framesize_t frame_sizes[] = {FRAMESIZE_QVGA, FRAMESIZE_HVGA, FRAMESIZE_VGA};
+#define NUM_FRAME_SIZES (int)(sizeof(frame_sizes) / sizeof(frame_sizes[0]))
+
+int CameraFrameSource::numLevels() const {
+    return NUM_FRAME_SIZES;
+}
+
+framesize_t CameraFrameSource::maxFrameSize() {
+    return frame_sizes[NUM_FRAME_SIZES - 1];
+}
+
+bool CameraFrameSource::grab(Frame &frame) {
+    int level = level_;
+    if (level != camera_level_) {
+        sensor_t *s = esp_camera_sensor_get();
+        if (s && s->set_framesize(s, frame_sizes[level]) == 0) {
+            log_i("frame size level %d", level);
+            camera_level_ = level;
+        }
+    }
+    camera_fb_t *fb;
+    {
+        ScopedStage timer(STAGE_CAPTURE);
+        fb = esp_camera_fb_get();
+    }
+    if (!fb) {
+        return false;
+    }
+    frame.buf = fb->buf;
+    frame.len = fb->len;
+    frame.width = fb->width;
+    frame.height = fb->height;
+    frame.timestamp_us = (int64_t)fb->timestamp.tv_sec * 1000000LL + fb->timestamp.tv_usec;
+    frame.handle = fb;
+    return true;
+}
+
+void CameraFrameSource::release(Frame &frame) {
+    esp_camera_fb_return((camera_fb_t *)frame.handle);
+}
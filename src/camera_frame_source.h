@@ -0,0 +1,27 @@
+#pragma once
+
+#include <atomic>
+
+#include "esp_camera.h"
+#include "frame_source.h"
+
+// Frames straight from the esp32-camera driver, zero copy: buf points
+// into the driver's frame buffer until release().
+class CameraFrameSource : public FrameSource {
+  public:
+    bool grab(Frame &frame) override;
+    void release(Frame &frame) override;
+
+    // Applied by the next grab(), on the capture task.
+    void setLevel(int level) override {
+        level_ = level;
+    }
+    int numLevels() const override;
+
+    // The largest frame size, frame buffers must be allocated for it.
+    static framesize_t maxFrameSize();
+
+  private:
+    std::atomic<int> level_{0};
+    int camera_level_ = -1;
+};
@@ -0,0 +1,112 @@
+#include "decode_session.h"
+
+#include <cassert>
+
+#include "stage_timer.h"
+
+DecodeSession::DecodeSession(WorkerPool *pool, int num_levels,
+                             void *(*alloc)(size_t))
+    : pool_(pool), resolution_(num_levels),
+      cache_(PAYLOAD_CACHE_SIZE, DUPLICATE_SUPPRESS_MS) {
+    codes_ = (struct quirc_code *)alloc((MAX_CODES_PER_FRAME + 1) * sizeof(struct quirc_code));
+    assert(codes_ != NULL);
+    num_results_ = pool ? pool->workers() : 1;
+    results_ = new struct ScanResult *[num_results_];
+    for (int i = 0; i < num_results_; i++) {
+        results_[i] = (struct ScanResult *)alloc(sizeof(struct ScanResult));
+        assert(results_[i] != NULL);
+    }
+    scanner_.setPool(pool);
+}
+
+DecodeSession::~DecodeSession() {
+    for (int i = 0; i < num_results_; i++) {
+        free(results_[i]);
+    }
+    delete[] results_;
+    free(codes_);
+}
+
+int DecodeSession::decode(Frame &frame, const std::function<void()> &pixels_taken,
+                          const std::function<void(const ScanResult &)> &post) {
+    struct quirc_code *codes = codes_;
+    struct quirc_code *fused_code = &codes_[MAX_CODES_PER_FRAME];
+    // below the top level a code too small for the coarse check must
+    // still show its finder patterns to the controller, to be stepped up
+    scanner_.setCoarseReject(resolution_.level() == resolution_.levels() - 1);
+    int num_codes = scanner_.scan(frame.buf, frame.len, frame.width, frame.height,
+                                  codes, MAX_CODES_PER_FRAME, pixels_taken);
+
+    // grids are only fused within one track: a full-frame search or a
+    // new track may have found another code, and with several in view
+    // the grids can't be told apart
+    uint32_t track = scanner_.tracker().track();
+    if (!scanner_.lastWindowed() || track != voter_track_ || num_codes > 1) {
+        voter_.reset();
+        voter_track_ = track;
+    }
+    bool fuse = num_codes == 1;
+
+    // grids of a code held in view are settled here, the rest are
+    // decoded in parallel
+    FrameOutcome outcome = {scanner_.lastCapstones(), num_codes, 0, 0};
+    uint32_t now = (uint32_t)(monotonicUs() / 1000);
+    uint32_t grids[MAX_CODES_PER_FRAME];
+    int pending[MAX_CODES_PER_FRAME];
+    int num_pending = 0;
+    for (int i = 0; i < num_codes; i++) {
+        float module_px = ResolutionController::modulePixels(codes[i]);
+        if (outcome.module_px == 0 || module_px < outcome.module_px) {
+            outcome.module_px = module_px;
+        }
+        grids[i] = PayloadCache::gridSignature(codes[i]);
+        if (cache_.lookupGrid(grids[i], now)) {
+            outcome.decoded++;
+            stats_.cache_hits++;
+            continue;
+        }
+        if (fuse) {
+            voter_.add(codes[i]);
+        }
+        pending[num_pending++] = i;
+    }
+
+    auto decodeOne = [&](int n, int worker) {
+        int i = pending[n];
+        struct ScanResult *result = results_[worker];
+        ScopedStage decode_timer(STAGE_DECODE);
+        result->err = QrDecoder::decode(&codes[i], &result->data);
+        // fuse implies a single code, the voter isn't shared here
+        if (result->err && fuse && voter_.vote(fused_code) &&
+                !QrDecoder::decode(fused_code, &result->data)) {
+            result->err = QUIRC_SUCCESS;
+            stats_.fused_decodes++;
+        }
+        result->latency_us = monotonicUs() - frame.timestamp_us;
+        const struct quirc_data &d = result->data;
+        uint32_t hash = result->err ? 0 : PayloadCache::payloadHash(d.payload, d.payload_len);
+        // posts are serialized too, handlers need no locking of their own
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!result->err) {
+            outcome.decoded++;
+            voter_.reset();
+            if (cache_.insert(hash, grids[i], now)) {
+                return;
+            }
+        }
+        post(*result);
+    };
+    if (pool_) {
+        pool_->run(num_pending, decodeOne);
+    } else {
+        for (int n = 0; n < num_pending; n++) {
+            decodeOne(n, 0);
+        }
+    }
+
+    // frames still queued at the old size are harmless, the scanner
+    // follows the frame dimensions
+    resolution_.update(outcome);
+    stats_.decoded += outcome.decoded;
+    return num_codes;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <quirc.h>
+
+#include "module_voter.h"
+#include "payload_cache.h"
+#include "pipeline.h"
+#include "qr_scanner.h"
+#include "resolution_controller.h"
+#include "worker_pool.h"
+
+#define MAX_CODES_PER_FRAME 4
+#define DUPLICATE_SUPPRESS_MS 3000
+#define PAYLOAD_CACHE_SIZE 8
+
+// A decoded code, or a decode error, on its way from the decode task to
+// the UI.
+struct ScanResult {
+    quirc_decode_error_t err;
+    int64_t latency_us; // frame capture to decode result
+    struct quirc_data data;
+};
+
+struct DecodeStats {
+    uint32_t decoded;       // codes decoded or recognized by their grid
+    uint32_t cache_hits;    // grids recognized without decoding
+    uint32_t fused_decodes; // decoded only through multi-frame voting
+};
+
+// Everything the decode task does to a frame, independent of where the
+// frame came from: scan, skip codes decoded recently, decode the rest
+// across the worker pool, fuse a failing tracked code over frames, and
+// pick the resolution for the frames to come. Results of codes not seen
+// recently are handed to post. Runs on the device and the host alike.
+class DecodeSession {
+  public:
+    // pool may be null. Scratch is allocated with alloc (ps_malloc on the
+    // device, to keep it out of internal RAM).
+    DecodeSession(WorkerPool *pool, int num_levels,
+                  void *(*alloc)(size_t) = malloc);
+    ~DecodeSession();
+
+    // Returns the number of codes found. pixels_taken is invoked exactly
+    // once, as soon as frame's pixels are no longer needed; post may be
+    // called from pool workers, one at a time.
+    int decode(Frame &frame, const std::function<void()> &pixels_taken,
+               const std::function<void(const ScanResult &)> &post);
+
+    // Resolution level the following frames should be taken at.
+    int level() const {
+        return resolution_.level();
+    }
+
+    QrScanner &scanner() {
+        return scanner_;
+    }
+
+    const DecodeStats &stats() const {
+        return stats_;
+    }
+
+  private:
+    WorkerPool *pool_;
+    QrScanner scanner_;
+    ResolutionController resolution_;
+    PayloadCache cache_;
+    ModuleVoter voter_;
+    uint32_t voter_track_ = 0; // tracker track the voter's grids belong to
+    DecodeStats stats_ = {};
+    struct quirc_code *codes_;  // MAX_CODES_PER_FRAME + the fused grid
+    struct ScanResult **results_; // per worker scratch
+    int num_results_;
+    std::mutex mutex_; // workers share the cache, voter and counters
+};
@@ -0,0 +1,66 @@
+#include "file_frame_source.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#include "pgm.h"
+#include "stage_timer.h"
+
+// how long grab() idles once the frames have run out
+#define FILE_SOURCE_IDLE_MS 10
+
+FileFrameSource::FileFrameSource(float fps, bool loop)
+    : period_us_(fps > 0 ? (int64_t)(1e6f / fps) : 0), loop_(loop) {}
+
+bool FileFrameSource::add(const char *path) {
+    Image image;
+    if (!readPgm(path, image.pixels, image.width, image.height)) {
+        return false;
+    }
+    frames_.push_back(std::move(image));
+    return true;
+}
+
+void FileFrameSource::add(const uint8_t *pixels, int width, int height) {
+    Image image;
+    image.pixels.assign(pixels, pixels + (size_t)width * height);
+    image.width = width;
+    image.height = height;
+    frames_.push_back(std::move(image));
+}
+
+bool FileFrameSource::grab(Frame &frame) {
+    if (next_ == frames_.size()) {
+        if (!loop_ || frames_.empty()) {
+            finished_ = true;
+            std::this_thread::sleep_for(std::chrono::milliseconds(FILE_SOURCE_IDLE_MS));
+            return false;
+        }
+        next_ = 0;
+    }
+    if (period_us_) {
+        int64_t wait = due_us_ - monotonicUs();
+        if (wait > 0) {
+            std::this_thread::sleep_for(std::chrono::microseconds(wait));
+        }
+        due_us_ = std::max(due_us_, monotonicUs() - period_us_) + period_us_;
+    }
+    const Image &image = frames_[next_++];
+    ScopedStage timer(STAGE_CAPTURE);
+    size_t len = image.pixels.size();
+    uint8_t *buf = new uint8_t[len];
+    memcpy(buf, image.pixels.data(), len);
+    frame.buf = buf;
+    frame.len = len;
+    frame.width = image.width;
+    frame.height = image.height;
+    frame.timestamp_us = monotonicUs();
+    frame.handle = buf;
+    return true;
+}
+
+void FileFrameSource::release(Frame &frame) {
+    delete[] (uint8_t *)frame.handle;
+}
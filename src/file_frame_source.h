@@ -0,0 +1,48 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "frame_source.h"
+
+// Replays recorded frames (binary PGM, see pgm.h) in place of the camera,
+// so the decode path runs on the host. Frames are loaded up front and
+// copied on every grab(): the decoder may binarize in place, like it does
+// with the camera's buffers.
+class FileFrameSource : public FrameSource {
+  public:
+    // fps 0 replays as fast as frames are taken, loop restarts at the
+    // first frame after the last one.
+    explicit FileFrameSource(float fps = 0, bool loop = false);
+
+    // Appends a frame file, false if it can't be read.
+    bool add(const char *path);
+    // Appends a frame already in memory.
+    void add(const uint8_t *pixels, int width, int height);
+
+    bool grab(Frame &frame) override;
+    void release(Frame &frame) override;
+
+    size_t frames() const {
+        return frames_.size();
+    }
+    // All frames have been handed out and the source doesn't loop.
+    bool finished() const {
+        return finished_;
+    }
+
+  private:
+    struct Image {
+        std::vector<uint8_t> pixels;
+        int width;
+        int height;
+    };
+
+    std::vector<Image> frames_;
+    int64_t period_us_;
+    bool loop_;
+    size_t next_ = 0;
+    int64_t due_us_ = 0;
+    std::atomic<bool> finished_{false};
+};
@@ -0,0 +1,146 @@
+#include "frame_codec.h"
+
+#include <cstring>
+
+#define ZERO_RUN 0x00
+#define SMALL_RUN 0x40
+#define LITERAL_RUN 0x80
+#define SHORT_RUN_MAX 64
+#define LITERAL_RUN_MAX 128
+// zeros that end a run of small residuals
+#define ZERO_BREAK 8
+
+static inline bool isSmall(uint8_t r) {
+    return (uint8_t)(r + 8) < 16;
+}
+
+namespace {
+
+// residual of pixel i, predictions from prev or from cur itself
+struct Residuals {
+    const uint8_t *cur;
+    const uint8_t *prev;
+    int width;
+    size_t len;
+
+    uint8_t operator()(size_t i) const {
+        if (prev) {
+            return cur[i] - prev[i];
+        }
+        if (i % width) {
+            return cur[i] - cur[i - 1];
+        }
+        return cur[i] - (i ? cur[i - width] : 128);
+    }
+
+    bool zerosAhead(size_t i, size_t n) const {
+        for (size_t k = 0; k < n; k++) {
+            if (i + k >= len || (*this)(i + k) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace
+
+size_t packFrame(const uint8_t *cur, const uint8_t *prev, int width, int height,
+                 uint8_t *out) {
+    size_t len = (size_t)width * height;
+    Residuals res = {cur, prev, width, len};
+    uint8_t *o = out;
+    size_t i = 0;
+    while (i < len) {
+        size_t n = 0;
+        while (i + n < len && n < SHORT_RUN_MAX && res(i + n) == 0) {
+            n++;
+        }
+        if (n >= 2) {
+            *o++ = ZERO_RUN | (n - 1);
+            i += n;
+            continue;
+        }
+
+        n = 0;
+        while (i + n < len && n < SHORT_RUN_MAX && isSmall(res(i + n)) &&
+                !(res(i + n) == 0 && res.zerosAhead(i + n, ZERO_BREAK))) {
+            n++;
+        }
+        if (n) {
+            *o++ = SMALL_RUN | (n - 1);
+            for (size_t k = 0; k < n; k += 2) {
+                uint8_t lo = res(i + k) & 0xf;
+                uint8_t hi = k + 1 < n ? res(i + k + 1) & 0xf : 0;
+                *o++ = lo | hi << 4;
+            }
+            i += n;
+            continue;
+        }
+
+        // up to where two small residuals in a row start a cheaper run
+        n = 1;
+        while (i + n < len && n < LITERAL_RUN_MAX &&
+                !(isSmall(res(i + n)) && (i + n + 1 == len || isSmall(res(i + n + 1))))) {
+            n++;
+        }
+        *o++ = LITERAL_RUN | (n - 1);
+        for (size_t k = 0; k < n; k++) {
+            *o++ = res(i + k);
+        }
+        i += n;
+    }
+    return o - out;
+}
+
+bool unpackFrame(const uint8_t *in, size_t in_len, const uint8_t *prev, int width,
+                 int height, uint8_t *cur) {
+    size_t len = (size_t)width * height;
+    const uint8_t *end = in + in_len;
+    size_t i = 0;
+    auto put = [&](uint8_t r) {
+        uint8_t pred;
+        if (prev) {
+            pred = prev[i];
+        } else if (i % width) {
+            pred = cur[i - 1];
+        } else {
+            pred = i ? cur[i - width] : 128;
+        }
+        cur[i++] = pred + r;
+    };
+    while (in < end) {
+        uint8_t token = *in++;
+        size_t n;
+        if (token & LITERAL_RUN) {
+            n = (token & 0x7f) + 1;
+            if (i + n > len || (size_t)(end - in) < n) {
+                return false;
+            }
+            for (size_t k = 0; k < n; k++) {
+                put(*in++);
+            }
+        } else if (token & SMALL_RUN) {
+            n = (token & 0x3f) + 1;
+            if (i + n > len || (size_t)(end - in) < (n + 1) / 2) {
+                return false;
+            }
+            for (size_t k = 0; k < n; k++) {
+                uint8_t nibble = k & 1 ? *in++ >> 4 : *in & 0xf;
+                put((uint8_t)((nibble ^ 8) - 8));
+            }
+            if (n & 1) {
+                in++;
+            }
+        } else {
+            n = token + 1;
+            if (i + n > len) {
+                return false;
+            }
+            for (size_t k = 0; k < n; k++) {
+                put(0);
+            }
+        }
+    }
+    return i == len;
+}
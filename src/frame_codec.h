@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Lossless streaming compression of 8-bit grayscale frames for the
+// recorder. Pixels become residuals, against the previous frame or, in a
+// key frame, against the left (first column: upper) neighbour. Residuals
+// are then run-length coded a byte at a time:
+//
+//   0x00-0x3f  run of 1..64 zero residuals
+//   0x40-0x7f  run of 1..64 residuals in [-8, 7], two per byte, low nibble first
+//   0x80-0xff  run of 1..128 residuals stored as bytes
+//
+// A single pass with no tables, cheap enough for a background task on the
+// ESP32-S3. Still scenes compress several times; sensor noise limits
+// what's left.
+
+// Worst-case packed size of a frame of len pixels.
+inline size_t packBound(size_t len) {
+    return len + len / 2 + 16;
+}
+
+// Packs a width x height frame into out (packBound() bytes). prev is the
+// previous frame of the same size, or null for a key frame. Returns the
+// packed size.
+size_t packFrame(const uint8_t *cur, const uint8_t *prev, int width, int height,
+                 uint8_t *out);
+
+// Reverses packFrame(), prev as given to it. False if in isn't a complete
+// frame of that size.
+bool unpackFrame(const uint8_t *in, size_t in_len, const uint8_t *prev, int width,
+                 int height, uint8_t *cur);
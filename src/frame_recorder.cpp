@@ -0,0 +1,271 @@
+#include "frame_recorder.h"
+
+#include <cstring>
+
+#include "frame_codec.h"
+
+static void put16(uint8_t *p, uint16_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void put32(uint8_t *p, uint32_t v) {
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static uint16_t get16(const uint8_t *p) {
+    return p[0] | p[1] << 8;
+}
+
+static uint32_t get32(const uint8_t *p) {
+    return get16(p) | (uint32_t)get16(p + 2) << 16;
+}
+
+void writeRecordHeader(const RecordHeader &h, uint8_t *out) {
+    put32(out, RECORD_MAGIC);
+    out[4] = h.version;
+    out[5] = h.flags;
+    out[6] = h.codes;
+    out[7] = h.decoded;
+    put32(out + 8, h.seq);
+    put32(out + 12, (uint32_t)h.timestamp_us);
+    put32(out + 16, (uint32_t)((uint64_t)h.timestamp_us >> 32));
+    put16(out + 20, h.width);
+    put16(out + 22, h.height);
+    put32(out + 24, h.decode_us);
+    put16(out + 28, h.payload_len);
+    put32(out + 30, h.data_len);
+    put32(out + 34, h.base_seq);
+}
+
+bool parseRecordHeader(const uint8_t *in, RecordHeader &h) {
+    if (get32(in) != RECORD_MAGIC || in[4] != RECORD_VERSION) {
+        return false;
+    }
+    h.version = in[4];
+    h.flags = in[5];
+    h.codes = in[6];
+    h.decoded = in[7];
+    h.seq = get32(in + 8);
+    h.timestamp_us = (int64_t)((uint64_t)get32(in + 16) << 32 | get32(in + 12));
+    h.width = get16(in + 20);
+    h.height = get16(in + 22);
+    h.decode_us = get32(in + 24);
+    h.payload_len = get16(in + 28);
+    h.data_len = get32(in + 30);
+    h.base_seq = get32(in + 34);
+    return true;
+}
+
+// CRC-32 (IEEE), bitwise; a record is packed before it's checksummed, so
+// this runs over a fraction of the frame
+uint32_t crc32(uint32_t crc, const uint8_t *data, size_t len) {
+    crc = ~crc;
+    for (size_t i = 0; i < len; i++) {
+        crc ^= data[i];
+        for (int k = 0; k < 8; k++) {
+            crc = (crc >> 1) ^ (0xedb88320 & -(crc & 1));
+        }
+    }
+    return ~crc;
+}
+
+FrameRecorder::FrameRecorder(size_t max_frame_bytes, int slots, void *(*alloc)(size_t))
+    : max_frame_bytes_(max_frame_bytes), alloc_(alloc), slots_(slots),
+      queue_(slots) {}
+
+FrameRecorder::~FrameRecorder() {
+    stop();
+}
+
+void FrameRecorder::freeBuffers() {
+    for (Slot &slot : slots_) {
+        free(slot.buf);
+        slot.buf = nullptr;
+    }
+    free(prev_);
+    free(packed_);
+    prev_ = packed_ = nullptr;
+}
+
+bool FrameRecorder::start(FrameSink *sink, int core, int prio) {
+    if (running_) {
+        return false;
+    }
+    bool ok = true;
+    for (Slot &slot : slots_) {
+        slot = Slot();
+        slot.buf = (uint8_t *)alloc_(max_frame_bytes_);
+        ok = ok && slot.buf;
+    }
+    prev_ = (uint8_t *)alloc_(max_frame_bytes_);
+    packed_ = (uint8_t *)alloc_(RECORD_HEADER_SIZE + RECORD_PAYLOAD_MAX +
+                                packBound(max_frame_bytes_));
+    if (!ok || !prev_ || !packed_) {
+        freeBuffers();
+        return false;
+    }
+    sink_ = sink;
+    stats_ = {};
+    captures_ = 0;
+    prev_width_ = prev_height_ = 0;
+    running_ = true;
+    thread_ = startPinnedThread("recorder", core, 4096, prio, [this] { writeLoop(); });
+    return true;
+}
+
+void FrameRecorder::stop() {
+    if (!running_) {
+        return;
+    }
+    {
+        // no more captures or submits, the task drains the queue
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    if (thread_.joinable()) {
+        thread_.join();
+    }
+    sink_->flush();
+    // a capture may still be copying into its slot
+    for (;;) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            bool busy = false;
+            for (Slot &slot : slots_) {
+                busy = busy || slot.state == SLOT_FILLING;
+            }
+            if (!busy) {
+                freeBuffers();
+                return;
+            }
+        }
+        std::this_thread::yield();
+    }
+}
+
+void FrameRecorder::capture(const Frame &frame) {
+    Slot *slot = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        captures_++;
+        if ((size_t)frame.width * frame.height <= max_frame_bytes_) {
+            for (Slot &s : slots_) {
+                if (s.state == SLOT_FREE) {
+                    slot = &s;
+                    break;
+                }
+            }
+        }
+        if (!slot) {
+            stats_.skipped++;
+            return;
+        }
+        slot->state = SLOT_FILLING;
+        slot->seq = captures_ - 1;
+        slot->timestamp_us = frame.timestamp_us;
+        slot->width = frame.width;
+        slot->height = frame.height;
+    }
+    memcpy(slot->buf, frame.buf, (size_t)frame.width * frame.height);
+    std::lock_guard<std::mutex> lock(mutex_);
+    slot->state = SLOT_FILLED;
+}
+
+void FrameRecorder::submit(int64_t timestamp_us, const RecordOutcome &outcome) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!running_) {
+        return;
+    }
+    for (size_t i = 0; i < slots_.size(); i++) {
+        Slot &slot = slots_[i];
+        if (slot.state != SLOT_FILLED) {
+            continue;
+        }
+        if (slot.timestamp_us == timestamp_us) {
+            slot.outcome = outcome;
+            slot.state = SLOT_QUEUED;
+            queue_.push((int)i);
+        } else if (slot.timestamp_us < timestamp_us) {
+            // frames are decoded in capture order, this one never will be
+            slot.state = SLOT_FREE;
+            stats_.dropped++;
+        }
+    }
+}
+
+RecorderStats FrameRecorder::stats() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+void FrameRecorder::writeLoop() {
+    int index;
+    for (;;) {
+        if (!queue_.pop(index, 100)) {
+            if (!running_) {
+                return; // stopped and drained
+            }
+            continue;
+        }
+        Slot &slot = slots_[index];
+        write(slot);
+        std::lock_guard<std::mutex> lock(mutex_);
+        slot.state = SLOT_FREE;
+    }
+}
+
+void FrameRecorder::write(Slot &slot) {
+    size_t pixels = (size_t)slot.width * slot.height;
+    bool key = slot.width != prev_width_ || slot.height != prev_height_ ||
+               since_key_ + 1 >= RECORDER_KEY_INTERVAL;
+    const RecordOutcome &o = slot.outcome;
+    uint16_t payload_len = o.payload_len < RECORD_PAYLOAD_MAX ? o.payload_len : RECORD_PAYLOAD_MAX;
+
+    RecordHeader h;
+    h.version = RECORD_VERSION;
+    h.flags = key ? RECORD_KEY : 0;
+    h.codes = o.codes;
+    h.decoded = o.decoded;
+    h.seq = slot.seq;
+    h.timestamp_us = slot.timestamp_us;
+    h.width = slot.width;
+    h.height = slot.height;
+    h.decode_us = o.decode_us;
+    h.payload_len = payload_len;
+    h.base_seq = key ? slot.seq : prev_seq_;
+
+    uint8_t *p = packed_ + RECORD_HEADER_SIZE;
+    memcpy(p, o.payload, payload_len);
+    p += payload_len;
+    h.data_len = packFrame(slot.buf, key ? nullptr : prev_, slot.width, slot.height, p);
+    writeRecordHeader(h, packed_);
+    size_t len = RECORD_HEADER_SIZE + payload_len + h.data_len;
+    uint8_t crc[4];
+    put32(crc, crc32(0, packed_, len));
+    bool ok = sink_->write(packed_, len) && sink_->write(crc, sizeof(crc));
+
+    if (ok) {
+        memcpy(prev_, slot.buf, pixels);
+        prev_width_ = slot.width;
+        prev_height_ = slot.height;
+        prev_seq_ = slot.seq;
+        since_key_ = key ? 0 : since_key_ + 1;
+    } else {
+        // the reader may not have this frame, don't pack against it
+        prev_width_ = prev_height_ = 0;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ok) {
+        stats_.recorded++;
+        stats_.raw_bytes += pixels;
+        stats_.packed_bytes += len + sizeof(crc);
+    } else {
+        stats_.failed++;
+    }
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "bounded_queue.h"
+#include "pipeline.h"
+
+// Frames being copied or packed at once, each a full frame buffer.
+#ifndef RECORDER_SLOTS
+#define RECORDER_SLOTS 2
+#endif
+// every so many frames one is packed on its own, so a stream can be
+// picked up after damage
+#ifndef RECORDER_KEY_INTERVAL
+#define RECORDER_KEY_INTERVAL 30
+#endif
+// bytes of the first decoded payload kept with a frame
+#define RECORD_PAYLOAD_MAX 256
+
+// A recording is a sequence of records, each
+//
+//   header  RECORD_HEADER_SIZE bytes, little endian (see RecordHeader)
+//   payload payload_len bytes
+//   pixels  data_len bytes, packed (frame_codec.h)
+//   crc32   4 bytes over all of the above
+//
+// The magic lets a reader resynchronize on a serial stream with other
+// output mixed in, the CRC rejects records that were damaged, and base_seq
+// tells it whether it holds the frame a delta was packed against.
+#define RECORD_MAGIC 0x52465251 // "QRFR"
+#define RECORD_VERSION 2
+#define RECORD_HEADER_SIZE 38
+#define RECORD_KEY 0x01 // packed without the previous frame
+
+struct RecordHeader {
+    uint8_t version;
+    uint8_t flags;
+    uint8_t codes;        // grids sampled in the frame
+    uint8_t decoded;      // of which decoded or recognized
+    uint32_t seq;         // capture count, gaps are skipped or dropped frames
+    int64_t timestamp_us; // capture time
+    uint16_t width;
+    uint16_t height;
+    uint32_t decode_us;   // time in the decode path
+    uint16_t payload_len;
+    uint32_t data_len;
+    uint32_t base_seq;    // seq of the frame a delta is packed against
+};
+
+void writeRecordHeader(const RecordHeader &h, uint8_t *out);
+// False if out doesn't start with the magic and a known version.
+bool parseRecordHeader(const uint8_t *in, RecordHeader &h);
+uint32_t crc32(uint32_t crc, const uint8_t *data, size_t len);
+
+// What the decode task made of a recorded frame.
+struct RecordOutcome {
+    uint8_t codes;
+    uint8_t decoded;
+    uint32_t decode_us;
+    uint16_t payload_len;
+    uint8_t payload[RECORD_PAYLOAD_MAX];
+};
+
+// Where records go: a file on the SD card, the USB-CDC serial port.
+class FrameSink {
+  public:
+    virtual ~FrameSink() {}
+    virtual bool write(const uint8_t *data, size_t len) = 0;
+    virtual void flush() {}
+};
+
+struct RecorderStats {
+    uint32_t recorded; // records written
+    uint32_t skipped;  // no free slot when the frame was captured
+    uint32_t dropped;  // copied, but dropped by the pipeline before decoding
+    uint32_t failed;   // sink write errors
+    uint64_t raw_bytes;
+    uint64_t packed_bytes;
+};
+
+// Records frames with their decode outcome. The capture task copies a
+// frame into a free slot (capture()), the decode task adds the outcome
+// (submit()), and a background task packs and writes it. Nothing blocks
+// the scanning tasks: without a free slot the frame is skipped, so a slow
+// sink lowers the recording rate, not the scan rate.
+class FrameRecorder {
+  public:
+    // max_frame_bytes is the largest frame that will be recorded. Buffers
+    // are allocated with alloc (ps_malloc on the device) by start().
+    explicit FrameRecorder(size_t max_frame_bytes, int slots = RECORDER_SLOTS,
+                           void *(*alloc)(size_t) = malloc);
+    ~FrameRecorder();
+
+    // Records to sink on a task pinned to core. False if buffers can't be
+    // allocated or it is already running.
+    bool start(FrameSink *sink, int core, int prio);
+    // Writes what has been submitted, then stops.
+    void stop();
+    bool running() const {
+        return running_;
+    }
+
+    // Capture task: copy a frame before it is queued for decoding.
+    void capture(const Frame &frame);
+    // Decode task: the outcome of the frame captured at timestamp_us.
+    // Frames captured before it were dropped by the pipeline.
+    void submit(int64_t timestamp_us, const RecordOutcome &outcome);
+
+    RecorderStats stats() const;
+
+  private:
+    enum SlotState { SLOT_FREE, SLOT_FILLING, SLOT_FILLED, SLOT_QUEUED };
+    struct Slot {
+        SlotState state;
+        uint32_t seq;
+        int64_t timestamp_us;
+        int width;
+        int height;
+        uint8_t *buf;
+        RecordOutcome outcome;
+    };
+
+    void writeLoop();
+    void write(Slot &slot);
+    void freeBuffers();
+
+    size_t max_frame_bytes_;
+    void *(*alloc_)(size_t);
+    std::vector<Slot> slots_;
+    mutable std::mutex mutex_; // slot states and stats
+    BoundedQueue<int> queue_;
+    std::atomic<bool> running_{false};
+    std::thread thread_;
+    FrameSink *sink_ = nullptr;
+    RecorderStats stats_ = {};
+    uint32_t captures_ = 0;
+
+    // background task only
+    uint8_t *prev_ = nullptr; // last written frame, the delta reference
+    uint8_t *packed_ = nullptr;
+    int prev_width_ = 0;
+    int prev_height_ = 0;  // 0 if the next record must be a key frame
+    uint32_t prev_seq_ = 0;
+    uint32_t since_key_ = 0;
+};
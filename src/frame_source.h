@@ -0,0 +1,24 @@
+#pragma once
+
+#include "pipeline.h"
+
+// Where the capture task gets its frames from: the camera on the device,
+// recorded frames on the host. Frames are 8-bit grayscale.
+class FrameSource {
+  public:
+    virtual ~FrameSource() {}
+
+    // Blocks until a frame is available, false if there is none. The frame
+    // is owned by the source until handed back through release().
+    virtual bool grab(Frame &frame) = 0;
+    virtual void release(Frame &frame) = 0;
+
+    // Resolution level (0 the cheapest) for the frames to come, see
+    // ResolutionController. Sources of a fixed size ignore it.
+    virtual void setLevel(int level) {
+        (void)level;
+    }
+    virtual int numLevels() const {
+        return 1;
+    }
+};
@@ -0,0 +1,93 @@
+#include "local_threshold.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "binarize.h"
+
+// MEAN: pixels this far below the local mean are black
+#define MEAN_OFFSET 8
+#define SAUVOLA_R 128.0f
+
+LocalThreshold::LocalThreshold(Method method, int radius, float k)
+    : method_(method), radius_(radius), k_(k), ring_rows_(2 * radius + 2) {}
+
+// Integral row r (sums over source rows < r) from row r - 1 and source
+// row r - 1. Box sums are differences of these, so the unsigned wrap
+// of sqsum cancels out as long as a single window's sum fits 32 bits.
+void LocalThreshold::integrateRow(const uint8_t *src, int row, int width) {
+    size_t w1 = (size_t)width + 1;
+    uint32_t *s = &sum_[(row % ring_rows_) * w1];
+    uint32_t *q = &sqsum_[(row % ring_rows_) * w1];
+    if (row == 0) {
+        std::fill(s, s + w1, 0);
+        std::fill(q, q + w1, 0);
+        return;
+    }
+    const uint32_t *ps = &sum_[((row - 1) % ring_rows_) * w1];
+    const uint32_t *pq = &sqsum_[((row - 1) % ring_rows_) * w1];
+    uint32_t rs = 0, rq = 0;
+    s[0] = q[0] = 0;
+    for (int x = 0; x < width; x++) {
+        uint32_t v = src[x];
+        rs += v;
+        rq += v * v;
+        s[x + 1] = ps[x + 1] + rs;
+        q[x + 1] = pq[x + 1] + rq;
+    }
+}
+
+bool LocalThreshold::apply(const uint8_t *src, int width, int height,
+                           int stride, uint8_t *dst) {
+    if (width <= 0 || height <= 0) {
+        return false;
+    }
+    size_t w1 = (size_t)width + 1;
+    sum_.resize(ring_rows_ * w1);
+    sqsum_.resize(ring_rows_ * w1);
+    row_threshold_.resize(width + 15);
+    // the SIMD kernels want aligned rows
+    uint8_t *thr = row_threshold_.data() + (-(uintptr_t)row_threshold_.data() & 15);
+
+    // window widths only vary near the borders, precompute 1 / width
+    col_inv_.resize(width);
+    for (int x = 0; x < width; x++) {
+        col_inv_[x] = 1.0f / (float)(std::min(width, x + radius_ + 1) - std::max(0, x - radius_));
+    }
+
+    int integrated = -1; // last integral row computed
+    for (int y = 0; y < height; y++) {
+        int y0 = std::max(0, y - radius_);
+        int y1 = std::min(height, y + radius_ + 1);
+        while (integrated < y1) {
+            integrated++;
+            integrateRow(src + (size_t)(integrated - 1) * stride, integrated, width);
+        }
+        const uint32_t *s0 = &sum_[(y0 % ring_rows_) * w1];
+        const uint32_t *s1 = &sum_[(y1 % ring_rows_) * w1];
+        const uint32_t *q0 = &sqsum_[(y0 % ring_rows_) * w1];
+        const uint32_t *q1 = &sqsum_[(y1 % ring_rows_) * w1];
+        float row_inv = 1.0f / (float)(y1 - y0);
+
+        for (int x = 0; x < width; x++) {
+            int x0 = std::max(0, x - radius_);
+            int x1 = std::min(width, x + radius_ + 1);
+            uint32_t sum = (s1[x1] - s1[x0]) - (s0[x1] - s0[x0]);
+            float inv = col_inv_[x] * row_inv;
+            float mean = sum * inv;
+            float t;
+            if (method_ == MEAN) {
+                t = mean - MEAN_OFFSET;
+            } else {
+                uint32_t sq = (q1[x1] - q1[x0]) - (q0[x1] - q0[x0]);
+                float var = sq * inv - mean * mean;
+                float sd = var > 0 ? sqrtf(var) : 0;
+                t = mean * (1.0f + k_ * (sd / SAUVOLA_R - 1.0f));
+            }
+            thr[x] = (uint8_t)std::min(255.0f, std::max(0.0f, t + 0.5f));
+        }
+        binarizeMap(src + (size_t)y * stride, thr,
+                    dst + (size_t)y * width, width);
+    }
+    return true;
+}
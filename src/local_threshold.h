@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Windowed local thresholding in O(1) per pixel from integral images of
+// the pixel values and their squares. Meant for codes on phone screens,
+// where glare, moiré and overlay icons defeat a single global threshold.
+// Only a band of 2 * radius + 2 integral rows is kept, not the whole
+// integral image.
+class LocalThreshold {
+  public:
+    enum Method {
+        MEAN,    // mean of the window minus a small offset
+        SAUVOLA, // mean * (1 + k * (stddev / 128 - 1))
+    };
+
+    explicit LocalThreshold(Method method = SAUVOLA, int radius = 12,
+                            float k = 0.2f);
+
+    // Threshold a width x height image (row stride given) into a bilevel
+    // width x height image in dst, 0 for black and 255 for white.
+    bool apply(const uint8_t *src, int width, int height, int stride,
+               uint8_t *dst);
+
+  private:
+    void integrateRow(const uint8_t *src, int row, int width);
+
+    Method method_;
+    int radius_;
+    float k_;
+    int ring_rows_;
+    std::vector<uint32_t> sum_;   // ring of integral rows, width + 1 each
+    std::vector<uint32_t> sqsum_; // same for squared values, wraps mod 2^32
+    std::vector<float> col_inv_;
+    std::vector<uint8_t> row_threshold_; // over-allocated for 16 byte alignment
+};
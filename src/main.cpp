@@ -1,9 +1,24 @@
 #include <M5CoreS3.h>
 #include <WiFi.h>
 #include <quirc.h>
+#include <mutex>
 #include "734446__universfield__error-10.h"
 #include "734443__universfield__system-notification-4.h"
+#include "audio_player.h"
+#include "binarize.h"
+#include "camera_frame_source.h"
+#include "decode_session.h"
+#include "esp_camera.h"
 #include "esp_wifi.h"
+#include "frame_recorder.h"
+#include "payload_router.h"
+#include "pipeline.h"
+#include "recorder_sinks.h"
+#include "stage_timer.h"
+#include "wifi_lease.h"
+#include "wifi_prescan.h"
+#include "wifi_uri.h"
+#include "worker_pool.h"
 
 typedef enum {
     AS_UNDEFINED,
@@ -11,70 +26,528 @@ typedef enum {
     AS_CONNECTING,    // wifi config available
     AS_CONNECTED,
     AS_CONNECT_FAILED, // wifi config present but connect failed
-    AS_SCANNING_QRCODE
+    AS_SCANNING_QRCODE,
+    AS_SHOWING_RESULT, // code just decoded, feedback running, still scanning
+    AS_REBOOTING       // config erased, restart when the timer expires
 } app_state_t;
 
-// Struct to hold the parsed WiFi configuration
-struct WiFiConfig {
-    String SSID;
-    String type;
-    String password;
+struct WiFiConfig wcfg; // network being joined
+
+// WiFi events as posted by the WiFi task to loop()
+struct WiFiEventMsg {
+    arduino_event_id_t id;
+    uint8_t reason; // disconnect reason, WIFI_REASON_*
 };
+#define WIFI_EVENT_QUEUE_DEPTH 8
+BoundedQueue<WiFiEventMsg> wifi_events(WIFI_EVENT_QUEUE_DEPTH);
 
-wl_status_t wifi_status = WL_STOPPED;
-struct WiFiConfig wcfg;
+// how the current connect attempt started; both are timed from
+// connect_start_ms, which is 0 (boot) for the connect at power-up
+typedef enum {
+    CONNECT_CACHED,   // directed to the cached BSSID/channel, static lease
+    CONNECT_PRESCAN,  // directed to the AP found by the background scan
+    CONNECT_SCAN      // full scan and DHCP
+} connect_path_t;
+
+connect_path_t connect_path = CONNECT_SCAN;
+uint32_t connect_start_ms;
+// a directed connect falls back to a full scan after this
+#define DIRECTED_CONNECT_TIMEOUT_MS 2000
+#define CONNECT_TIMEOUT_MS 15000
+// transient failures are retried after 0.5, 1, 2, 4 s, then we give up
+#define CONNECT_RETRY_MS 500
+#define CONNECT_MAX_RETRIES 4
+int connect_retries;
+
+WiFiPrescan prescan; // loop() only
+
+// the decode task is worker 0, its helper runs on the capture core
+#define DECODE_WORKERS 2
+#define DECODE_HELPER_PRIO 1
+// the recorder packs and writes below the scanning tasks on the capture core
+#define RECORDER_PRIO 1
+
+struct ScanResult *scan_result;   // loop() copy
+
+// read by the capture task, written by loop()
+volatile app_state_t appstate = AS_UNCONFIGURED;
+app_state_t prev_appstate = AS_UNDEFINED;
 
-struct quirc_code *code;
-struct quirc_data *data;
-struct quirc *qr = nullptr;
+// timed states expire through onStateTimeout() instead of delay()
+bool state_timed = false;
+uint32_t state_deadline;
 
-app_state_t appstate = AS_UNCONFIGURED;
-app_state_t prev_appstate = AS_UNDEFINED;
+#define RESULT_SHOW_MS 3000    // decode errors are not reported meanwhile
+#define ERROR_COOLDOWN_MS 500
+#define REBOOT_DELAY_MS 300
+#define LOOP_WAIT_MS 20        // loop() sleeps on the result queue
 
-WiFiConfig parseWiFiQR(const String& qrText);
+uint32_t last_error_ms;
 
 // {scaleX, skewX, transX, skewY, scaleY, transY}
 float affine[6] = {0.25, 0, 0, 0,  0.25, 0};
+#define PREVIEW_WIDTH 160
 
 M5Canvas canvas(&CoreS3.Display);
 M5GFX &display = CoreS3.Display;
 
 #define VSPACE 5
 
+// frames are handed back to the driver as soon as their pixels are
+// taken; with three buffers and CAMERA_GRAB_LATEST the sensor always has
+// a free buffer and the capture task always gets the newest frame
+#define CAMERA_FB_COUNT 3
+#define FRAME_QUEUE_DEPTH 1
+#define RESULT_QUEUE_DEPTH 2
+
+// the capture task pushes the preview while loop() pushes the log canvas
+std::mutex display_mutex;
+
+BoundedQueue<ScanResult> scan_results(RESULT_QUEUE_DEPTH);
+Pipeline *pipeline;
+CameraFrameSource camera;
+WorkerPool *decode_pool;
+DecodeSession *session; // decode task only
+AudioPlayer player;
+PayloadRouter router; // loop() only
+FrameRecorder *recorder;
+SdFrameSink sd_sink(display_mutex);
+SerialFrameSink serial_sink;
+
+void canvasUpdate(void) {
+    std::lock_guard<std::mutex> lock(display_mutex);
+    canvas.pushSprite(0, display.height()/2 + VSPACE);
+}
+
 void chimeError(void) {
-    CoreS3.Speaker.playRaw(
-        __734446__universfield__error_10_wav,
-        __734446__universfield__error_10_wav_len,
-        44100, true);
+    player.play(sound_error_10);
 }
 
 void chimeSuccess(void) {
-    CoreS3.Speaker.playRaw(
-        __734443__universfield__system_notification_4_wav,
-        __734443__universfield__system_notification_4_wav_len,
-        44100, true);
+    player.play(sound_system_notification_4);
 }
 
+// credentials the WiFi driver keeps in NVS, into wcfg
 bool readStoredWiFiConfig() {
     wifi_config_t config;
     esp_err_t err = esp_wifi_get_config(WIFI_IF_STA, &config);
     if (err == ESP_OK) {
-        char ssid[33];
-        memcpy(ssid, config.sta.ssid, 32);
-        ssid[32] = '\0';
-        char password[65];
-        memcpy(password, config.sta.password, 64);
-        password[64] = '\0';
-        log_i("Stored SSID: %s", ssid);
-        log_i("Stored Password: %s", password);
-        return strlen(ssid) > 0;
+        memset(&wcfg, 0, sizeof(wcfg));
+        memcpy(wcfg.ssid, config.sta.ssid, WIFI_SSID_MAX);
+        memcpy(wcfg.password, config.sta.password, WIFI_PASSWORD_MAX);
+        log_i("Stored SSID: %s", wcfg.ssid);
+        log_i("Stored Password: %s", wcfg.password);
+        return strlen(wcfg.ssid) > 0;
     } else {
         log_e("Failed to get Wi-Fi configuration.");
     }
     return false;
 }
 
+// join wcfg's network on the cached channel and BSSID with the cached
+// addresses, skipping both the scan and DHCP
+bool connectCached(void) {
+    WiFiLease lease;
+    if (!loadWiFiLease(lease) || strcmp(lease.ssid, wcfg.ssid) != 0) {
+        return false;
+    }
+    log_i("cached connect: channel %u", lease.channel);
+    WiFi.config(IPAddress(lease.ip), IPAddress(lease.gateway),
+                IPAddress(lease.netmask), IPAddress(lease.dns));
+    WiFi.begin(wcfg.ssid, wcfg.password, lease.channel, lease.bssid);
+    connect_path = CONNECT_CACHED;
+    return true;
+}
+
+// join wcfg's network through an access point from the background scan
+bool connectPrescanned(void) {
+    const ScanEntry *ap = prescan.table().select(wcfg.ssid, millis());
+    if (!ap) {
+        return false;
+    }
+    log_i("prescanned connect: channel %u rssi %d", ap->channel, ap->rssi);
+    WiFi.config(IPAddress(), IPAddress(), IPAddress());
+    WiFi.begin(wcfg.ssid, wcfg.password, ap->channel, ap->bssid);
+    connect_path = CONNECT_PRESCAN;
+    return true;
+}
+
+void connectScan(void) {
+    WiFi.config(IPAddress(), IPAddress(), IPAddress()); // back to DHCP
+    WiFi.begin(wcfg.ssid, wcfg.password);
+    connect_path = CONNECT_SCAN;
+}
+
+void saveLease(void) {
+    WiFiLease lease;
+    memset(&lease, 0, sizeof(lease));
+    strcpy(lease.ssid, wcfg.ssid);
+    memcpy(lease.bssid, WiFi.BSSID(), sizeof(lease.bssid));
+    lease.channel = WiFi.channel();
+    lease.ip = WiFi.localIP();
+    lease.gateway = WiFi.gatewayIP();
+    lease.netmask = WiFi.subnetMask();
+    lease.dns = WiFi.dnsIP();
+    if (!saveWiFiLease(lease)) {
+        log_e("failed to save the WiFi lease");
+    }
+}
+
+bool scanning(void) {
+    return appstate == AS_SCANNING_QRCODE || appstate == AS_SHOWING_RESULT;
+}
+
+void setState(app_state_t state, uint32_t timeout_ms = 0) {
+    appstate = state;
+    state_timed = timeout_ms > 0;
+    state_deadline = millis() + timeout_ms;
+}
+
+// wait for the connect just started, directed ones fall back early
+void awaitConnect(void) {
+    setState(AS_CONNECTING, connect_path == CONNECT_SCAN ? CONNECT_TIMEOUT_MS
+                                                         : DIRECTED_CONNECT_TIMEOUT_MS);
+}
+
+// the directed access point or cached lease didn't work out
+void fallBackToScan(void) {
+    log_i("directed connect failed, scanning");
+    WiFi.disconnect();
+    connectScan();
+    awaitConnect();
+}
+
+// no point retrying, e.g. wrong password: wait for another code
+void connectFailed(const char *why) {
+    canvas.printf("WiFi: %s\r\n", why);
+    canvasUpdate();
+    WiFi.disconnect();
+    connect_retries = 0;
+    setState(AS_SCANNING_QRCODE);
+}
+
+void retryConnect(void) {
+    if (++connect_retries > CONNECT_MAX_RETRIES) {
+        connectFailed("giving up");
+        return;
+    }
+    WiFi.disconnect();
+    setState(AS_CONNECT_FAILED, CONNECT_RETRY_MS << (connect_retries - 1));
+}
+
+void onStateTimeout(void) {
+    switch (appstate) {
+        case AS_SHOWING_RESULT:
+            setState(AS_SCANNING_QRCODE);
+            break;
+        case AS_REBOOTING:
+            ESP.restart();
+            break;
+        case AS_CONNECTING:
+            if (connect_path != CONNECT_SCAN) {
+                fallBackToScan();
+            } else {
+                connectFailed("connect timed out");
+            }
+            break;
+        case AS_CONNECT_FAILED: // retry backoff expired
+            connectScan();
+            awaitConnect();
+            break;
+        default:
+            ;
+    }
+}
+
+// capture task: grab a frame and show it, the decode task does the rest
+bool captureFrame(Frame &frame) {
+    if (!scanning()) {
+        delay(50);
+        return false;
+    }
+    if (!camera.grab(frame)) {
+        return false;
+    }
+    // before the decode task gets it, zero-copy decoding binarizes in place
+    recorder->capture(frame);
+    std::lock_guard<std::mutex> lock(display_mutex);
+    affine[0] = affine[4] = (float)PREVIEW_WIDTH / frame.width;
+    CoreS3.Display.pushGrayscaleImageAffine(affine, frame.width, frame.height,
+                                            frame.buf, lgfx::v1::grayscale_8bit,
+                                            TFT_WHITE, TFT_BLACK);
+    return true;
+}
+
+void releaseFrame(Frame &frame) {
+    camera.release(frame);
+}
+
+// decode task: run the session over the frame and post results to loop()
+void decodeFrame(Frame &frame) {
+    ScopedStage timer(STAGE_FRAME);
+    RecordOutcome outcome = {};
+    uint32_t decoded = session->stats().decoded;
+    int64_t start_us = monotonicUs();
+    int num_codes = session->decode(frame, [&frame] { pipeline->release(frame); },
+                                    [&outcome](const ScanResult &result) {
+                                        const struct quirc_data &d = result.data;
+                                        // posts are serialized, the first decode is kept
+                                        if (!result.err && !outcome.payload_len) {
+                                            int n = d.payload_len < RECORD_PAYLOAD_MAX ?
+                                                    d.payload_len : RECORD_PAYLOAD_MAX;
+                                            memcpy(outcome.payload, d.payload, n);
+                                            outcome.payload_len = n;
+                                        }
+                                        scan_results.push(result);
+                                    });
+    outcome.codes = num_codes;
+    outcome.decoded = session->stats().decoded - decoded;
+    outcome.decode_us = monotonicUs() - start_us;
+    recorder->submit(frame.timestamp_us, outcome);
+    QrScanner &scanner = session->scanner();
+    if (num_codes) {
+        const Roi &w = scanner.lastWindow();
+        log_i("width %u height %u window %dx%d+%d+%d num_codes %d",
+              frame.width, frame.height, w.width, w.height, w.x, w.y, num_codes);
+    }
+
+    const QrScannerStats &st = scanner.stats();
+    if (st.frames % 100 == 0) {
+        log_i("frames %u blur rejects %u windowed %u coarse rejects %u cache hits %u sharpness %u",
+              st.frames, st.blur_rejects, st.windowed, st.coarse_rejects,
+              session->stats().cache_hits, scanner.lastSharpness());
+        log_i("fused decodes %u", session->stats().fused_decodes);
+    }
+    camera.setLevel(session->level());
+}
+
+void handleScanResult(struct ScanResult &result) {
+    struct quirc_data *data = &result.data;
+    uint32_t now = millis();
+
+    if (result.err) {
+        // most likely a blurred re-read of the code we're showing
+        if (appstate == AS_SHOWING_RESULT ||
+                (int32_t)(now - last_error_ms) < ERROR_COOLDOWN_MS) {
+            return;
+        }
+        last_error_ms = now;
+        chimeError();
+        canvas.printf("decode: %s\r\n",quirc_strerror(result.err));
+        canvasUpdate();
+        return;
+    }
+
+    chimeSuccess();
+
+    log_i("payload '%s'", data->payload);
+    log_i("latency %lld us", result.latency_us);
+    log_i("Version: %d", data->version);
+    log_i("ECC level: %c", "MLHQ"[data->ecc_level]);
+    log_i("Mask: %d", data->mask);
+    log_i("Length: %d", data->payload_len);
+    log_i("Payload: %s", data->payload);
+
+    router.dispatch((const char *)data->payload, data->payload_len);
+}
+
+// payload handlers, the views point into scan_result
+void showPayload(const char *label, PayloadView text) {
+    canvas.printf("%s: %.*s\r\n", label, (int)text.len, text.data);
+    canvasUpdate();
+    setState(AS_SHOWING_RESULT, RESULT_SHOW_MS);
+}
+
+void onText(const PayloadMatch &match) {
+    showPayload("QR", match.payload);
+}
+
+void onWiFi(const PayloadMatch &match) {
+    if (!parseWiFiUri(match.payload.data, match.payload.len, wcfg) || !wcfg.ssid[0]) {
+        showPayload("QR", match.payload);
+        return;
+    }
+    log_i("SSID '%s'", wcfg.ssid);
+    log_i("type '%s'", wcfg.type);
+    log_i("password '%s'", wcfg.password);
+
+    WiFi.persistent(true);
+    connect_start_ms = millis();
+    connect_retries = 0;
+    prescan.stop();
+    if (!connectPrescanned()) {
+        connectScan();
+    }
+    awaitConnect();
+    canvas.printf("SSID: %s\r\n", wcfg.ssid);
+    // canvas.printf("Password: %s\r\n", wcfg.password);
+    canvasUpdate();
+}
+
+void onUrl(const PayloadMatch &match) {
+    showPayload("URL", match.payload);
+}
+
+void onMecard(const PayloadMatch &match) {
+    showPayload("Contact", match.body());
+}
+
+void onDpp(const PayloadMatch &match) {
+    // Easy Connect enrollment isn't supported, just say what it is
+    showPayload("DPP", match.body());
+}
+
+// stage timings: 't' on the serial console prints them, 'r' resets
+// them, a tap on the screen shows them on the display
+void showTimings(bool serial) {
+    if (serial) {
+        stageReport([](const char *line) { Serial.println(line); });
+    }
+    stageReport([](const char *line) { canvas.printf("%s\r\n", line); }, true);
+    canvasUpdate();
+}
+
+// frame recording: 'R' records to the microSD card, 'U' streams over
+// USB-CDC for a host to capture to a file, 'X' stops
+void startRecording(bool sd) {
+    if (recorder->running()) {
+        Serial.println("already recording");
+        return;
+    }
+    if (sd && !sd_sink.open()) {
+        Serial.println("no SD card");
+        return;
+    }
+    PipelineConfig pcfg;
+    if (!recorder->start(sd ? (FrameSink *)&sd_sink : &serial_sink,
+                         pcfg.capture_core, RECORDER_PRIO)) {
+        Serial.println("recorder start failed");
+        return;
+    }
+    if (sd) {
+        Serial.printf("recording to %s\r\n", sd_sink.path());
+    }
+}
+
+void stopRecording(void) {
+    if (!recorder->running()) {
+        return;
+    }
+    recorder->stop();
+    sd_sink.close();
+    RecorderStats st = recorder->stats();
+    Serial.printf("recorded %u skipped %u dropped %u failed %u ratio %.2f\r\n",
+                  st.recorded, st.skipped, st.dropped, st.failed,
+                  st.packed_bytes ? (float)st.raw_bytes / st.packed_bytes : 0.0f);
+}
+
+void pollSerialCommands(void) {
+    while (Serial.available()) {
+        switch (Serial.read()) {
+            case 't':
+                showTimings(true);
+                break;
+            case 'r':
+                stageReset();
+                Serial.println("timings reset");
+                break;
+            case 'R':
+                startRecording(true);
+                break;
+            case 'U':
+                startRecording(false);
+                break;
+            case 'X':
+                stopRecording();
+                break;
+            default:
+                ;
+        }
+    }
+    if (CoreS3.Touch.getCount() && CoreS3.Touch.getDetail().wasClicked()) {
+        showTimings(false);
+    }
+}
+
+// WiFi task: hand the event over to loop()
+void onWiFiEvent(WiFiEvent_t event, WiFiEventInfo_t info) {
+    WiFiEventMsg msg = {event, 0};
+    if (event == ARDUINO_EVENT_WIFI_STA_DISCONNECTED) {
+        msg.reason = info.wifi_sta_disconnected.reason;
+    }
+    wifi_events.push(msg);
+}
+
+void onConnected(void) {
+    uint32_t latency = millis() - connect_start_ms;
+    const char *path = connect_path == CONNECT_CACHED ? "cached" :
+                       connect_path == CONNECT_PRESCAN ? "prescan" : "scan";
+    canvas.printf("WiFi: Connected\r\n");
+    canvas.printf("IP: %s (%s, %u ms)\r\n",
+                  WiFi.localIP().toString().c_str(), path, latency);
+    canvasUpdate();
+    log_i("%s to IP: %u ms via %s",
+          connect_start_ms ? "connect" : "boot", latency, path);
+    saveLease();
+    connect_retries = 0;
+    setState(AS_CONNECTED);
+}
+
+void onDisconnected(uint8_t reason) {
+    log_i("disconnected, reason %u", reason);
+    if (reason == WIFI_REASON_ASSOC_LEAVE) {
+        return; // our own WiFi.disconnect()
+    }
+    switch (appstate) {
+        case AS_CONNECTED:
+            canvas.printf("WiFi: disconnected\r\n");
+            canvasUpdate();
+            connect_start_ms = millis();
+            retryConnect();
+            break;
+        case AS_CONNECTING:
+            if (connect_path != CONNECT_SCAN) {
+                fallBackToScan();
+                break;
+            }
+            switch (reason) {
+                case WIFI_REASON_NO_AP_FOUND:
+                    connectFailed("SSID not found");
+                    break;
+                case WIFI_REASON_AUTH_FAIL:
+                case WIFI_REASON_AUTH_EXPIRE:
+                case WIFI_REASON_4WAY_HANDSHAKE_TIMEOUT:
+                case WIFI_REASON_HANDSHAKE_TIMEOUT:
+                    connectFailed("authentication failed");
+                    break;
+                default:
+                    retryConnect();
+            }
+            break;
+        default:
+            ;
+    }
+}
+
+void handleWiFiEvent(const WiFiEventMsg &event) {
+    switch (event.id) {
+        case ARDUINO_EVENT_WIFI_STA_GOT_IP:
+            onConnected();
+            break;
+        case ARDUINO_EVENT_WIFI_STA_DISCONNECTED:
+            onDisconnected(event.reason);
+            break;
+        default:
+            ;
+    }
+}
+
 void setup() {
+    router.on(SCHEME_TEXT, onText);
+    router.on(SCHEME_WIFI, onWiFi);
+    router.on(SCHEME_URL, onUrl);
+    router.on(SCHEME_MECARD, onMecard);
+    router.on(SCHEME_DPP, onDpp);
 
     M5.begin();
     auto cfg = M5.config();
@@ -91,28 +564,50 @@ void setup() {
 
     // tweak the default camera config
     CoreS3.Camera.config->pixel_format = PIXFORMAT_GRAYSCALE;
-    CoreS3.Camera.config->frame_size = FRAMESIZE_VGA;
+    // frame buffers are allocated for the largest size we switch to
+    CoreS3.Camera.config->frame_size = CameraFrameSource::maxFrameSize();
+    CoreS3.Camera.config->fb_count = CAMERA_FB_COUNT;
+    CoreS3.Camera.config->fb_location = CAMERA_FB_IN_PSRAM;
+    CoreS3.Camera.config->grab_mode = CAMERA_GRAB_LATEST;
     if (!CoreS3.Camera.begin()) {
         CoreS3.Display.setTextColor(RED);
         CoreS3.Display.drawString("Camera Init Fail", CoreS3.Display.width() / 2, CoreS3.Display.height() / 2);
         while (1);
     }
 
-    code = (struct quirc_code *)ps_malloc(sizeof(struct quirc_code));
-    data = (struct quirc_data *)ps_malloc(sizeof(struct quirc_data));
-
-    assert(code != NULL);
-    assert(data != NULL);
-
-    WiFi.begin();
+    scan_result = (struct ScanResult *)ps_malloc(sizeof(struct ScanResult));
+    assert(scan_result != NULL);
+
+    log_i("binarize backend %s", binarizeBackend());
+    PipelineConfig pcfg;
+    decode_pool = new WorkerPool(DECODE_WORKERS - 1, pcfg.capture_core,
+                                 pcfg.decode_stack, DECODE_HELPER_PRIO);
+    session = new DecodeSession(decode_pool, camera.numLevels(), ps_malloc);
+    recorder = new FrameRecorder(640 * 480, RECORDER_SLOTS, ps_malloc); // up to VGA
+    pcfg.queue_depth = FRAME_QUEUE_DEPTH;
+    pcfg.capture = captureFrame;
+    pcfg.decode = decodeFrame;
+    pcfg.release = releaseFrame;
+    pipeline = new Pipeline(pcfg);
+    pipeline->start();
+    player.begin();
+
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(onWiFiEvent, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+    WiFi.setAutoReconnect(false); // retries are ours, with backoff
+    WiFi.mode(WIFI_STA);
     // WiFi.printDiag(Serial);
 
     if (readStoredWiFiConfig()) {
         canvas.printf("Click Power button for reset to defaults\r\n");
-        canvas.pushSprite(0, display.height()/2+ VSPACE);
-        appstate = AS_CONNECTING;
+        canvasUpdate();
+        connect_start_ms = 0; // timed from boot
+        if (!connectCached()) {
+            connectScan();
+        }
+        awaitConnect();
     } else {
-        appstate = AS_SCANNING_QRCODE;
+        setState(AS_SCANNING_QRCODE);
     }
 }
 
@@ -120,17 +615,22 @@ void loop() {
     esp_err_t err;
 
     M5.update();
-    if (CoreS3.BtnPWR.wasClicked()) {
+    if (CoreS3.BtnPWR.wasClicked() && appstate != AS_REBOOTING) {
 
         canvas.printf("erasing WiFi config\r\n");
-        canvas.pushSprite(0, display.height()/2+ VSPACE);
+        canvasUpdate();
 
         WiFi.eraseAP();
+        clearWiFiLease();
         WiFi.disconnect(); // reboot here
         canvas.printf("rebooting..\r\n");
-        canvas.pushSprite(0, display.height()/2+ VSPACE);
-        delay(300);
-        ESP.restart();
+        canvasUpdate();
+        setState(AS_REBOOTING, REBOOT_DELAY_MS);
+    }
+    pollSerialCommands();
+    if (state_timed && (int32_t)(millis() - state_deadline) >= 0) {
+        state_timed = false;
+        onStateTimeout();
     }
 
     if (appstate ^ prev_appstate) { // appstate changes
@@ -145,184 +645,21 @@ void loop() {
                 ;
         }
     }
-    wl_status_t ws = WiFi.status();
-    if (ws ^ wifi_status) {
-        wifi_status = ws; // track changes
-
-        switch (ws) {
-            case WL_CONNECTED:
-                canvas.printf("WiFi: Connected\r\n");
-                canvas.printf("IP: %s\r\n", WiFi.localIP().toString().c_str());
-                break;
-            case WL_NO_SSID_AVAIL:
-                canvas.printf("WiFi: SSID %s not found\r\n", wcfg.SSID.c_str());
-                break;
-            case WL_DISCONNECTED:
-                canvas.printf("WiFi: disconnected\r\n");
-                break;
-            default:
-                // canvas.printf("WiFi status: %d\r\n", ws);
-                break;
-        }
-        canvas.pushSprite(0, display.height()/2 + VSPACE);
-
-        log_i("wifi_status=%d", wifi_status);
-    }
-    if ((appstate == AS_SCANNING_QRCODE) && CoreS3.Camera.get()) {
-        camera_fb_t *fb = CoreS3.Camera.fb;
-        if (fb) {
-
-            CoreS3.Display.pushGrayscaleImageAffine(affine, fb->width, fb->height,
-                                                    (uint8_t *)CoreS3.Camera.fb->buf,
-                                                    lgfx::v1::grayscale_8bit,
-                                                    TFT_WHITE, TFT_BLACK);
-            int width = fb->width;
-            int height = fb->height;
-            if (!qr) {
-                // once only - if not needed anymore, free with quirc_destroy(qr)
-                qr = quirc_new();
-                assert(quirc_resize(qr, width, height) >= 0);
-            }
+    prescan.poll(millis(), scanning());
 
-            uint8_t *image = quirc_begin(qr, &width, &height);
-            if (image) {
-                memcpy(image, fb->buf, fb->len);
-
-                quirc_end(qr);
-                int num_codes = quirc_count(qr);
-                if (num_codes) {
-                    log_i("width %u height %u num_codes %d",
-                          fb->width, fb->height,num_codes);
-                }
-
-                for (int i = 0; i < num_codes; i++) {
-                    quirc_extract(qr, i, code);
-                    quirc_decode_error_t err = quirc_decode(code, data);
-                    if (err == QUIRC_ERROR_DATA_ECC) {
-                        quirc_flip(code);
-                        err = quirc_decode(code, data);
-                    }
-                    if (!err) {
-                        chimeSuccess();
-
-                        log_i("payload '%s'", data->payload);
-                        log_i("Version: %d", data->version);
-                        log_i("ECC level: %c", "MLHQ"[data->ecc_level]);
-                        log_i("Mask: %d", data->mask);
-                        log_i("Length: %d", data->payload_len);
-                        log_i("Payload: %s", data->payload);
-
-                        const String payload = String((const char *)data->payload);
-
-                        wcfg = parseWiFiQR(payload);
-                        log_i("SSID '%s'", wcfg.SSID.c_str());
-                        log_i("type '%s'", wcfg.type.c_str());
-                        log_i("password '%s'", wcfg.password.c_str());
-
-                        if (wcfg.SSID.length() > 0) {
-                            WiFi.begin(wcfg.SSID.c_str(), wcfg.password.c_str());
-                            WiFi.persistent(true);
-                            appstate = AS_CONNECTING;
-                            canvas.printf("SSID: %s\r\n", wcfg.SSID.c_str());
-                            // canvas.printf("Password: %s\r\n", wcfg.password.c_str());
-                            canvas.pushSprite(0, display.height()/2+ VSPACE);
-                        } else {
-                            canvas.printf("QR: %s\r\n", payload.c_str());
-                            canvas.pushSprite(0, display.height()/2+ VSPACE);
-                        }
-                        delay(3000);
-                    } else {
-                        chimeError();
-                        canvas.printf("decode: %s\r\n",quirc_strerror(err));
-                        canvas.pushSprite(0, display.height()/2+ VSPACE);
-
-                        delay(500);
-                    }
-                }
-            }
-            CoreS3.Camera.free();
-        }
+    WiFiEventMsg event;
+    while (wifi_events.pop(event, 0)) {
+        handleWiFiEvent(event);
     }
-    yield();
-}
 
-
-// Function to unescape special characters
-String unescape(const String& str) {
-    String result = "";
-    int i = 0;
-    while (i < str.length()) {
-        if (str[i] == '\\' && i + 1 < str.length()) {
-            char next = str[i + 1];
-            if (next == '\\') {
-                result += '\\';
-            } else if (next == ';') {
-                result += ';';
-            } else if (next == ',') {
-                result += ',';
-            } else if (next == '"') {
-                result += '"';
-            } else if (next == ':') {
-                result += ':';
-            } else {
-                // Unknown escape, add both
-                result += '\\';
-                result += next;
-            }
-            i += 2; // Skip both \\ and next
-        } else {
-            result += str[i];
-            i++;
+    // sleeps here until the decoder posts something or LOOP_WAIT_MS passes
+    uint32_t wait_ms = LOOP_WAIT_MS;
+    while (scan_results.pop(*scan_result, wait_ms)) {
+        wait_ms = 0;
+        if (scanning()) { // else stale, e.g. still queued after WIFI: was seen
+            handleScanResult(*scan_result);
         }
     }
-    return result;
-}
-
-// Helper function to process a single key-value pair
-void processPair(const String& pair, WiFiConfig& config) {
-    int colon = pair.indexOf(':');
-    if (colon != -1) {
-        String key = pair.substring(0, colon);
-        String value = pair.substring(colon + 1);
-        value = unescape(value);
-        if (value.startsWith("\"") && value.endsWith("\"")) {
-            value = value.substring(1, value.length() - 1);
-        }
-        if (key == "S") {
-            config.SSID = value;
-        } else if (key == "T") {
-            config.type = value;
-        } else if (key == "P") {
-            config.password = value;
-        }
-        // Add more fields if needed (e.g., H for hidden networks)
-    }
-}
-
-// Main function to parse WiFi QR code text
-WiFiConfig parseWiFiQR(const String& qrText) {
-    WiFiConfig config;
-    if (!qrText.startsWith("WIFI:")) {
-        // Handle error: not a valid WiFi QR code
-        return config;
-    }
-    String content = qrText.substring(5); // Remove "WIFI:"
-    // Remove trailing semicolons
-    while (content.endsWith(";")) {
-        content = content.substring(0, content.length() - 1);
-    }
-    // Split by semicolons
-    int start = 0;
-    int end = content.indexOf(';');
-    while (end != -1) {
-        String pair = content.substring(start, end);
-        processPair(pair, config);
-        start = end + 1;
-        end = content.indexOf(';', start);
-    }
-    // Process the last pair
-    String lastPair = content.substring(start);
-    processPair(lastPair, config);
-    return config;
+    yield();
 }
 
@@ -0,0 +1,59 @@
+#include "module_voter.h"
+
+#include <cstring>
+
+ModuleVoter::ModuleVoter(int depth) : depth_(depth) {}
+
+void ModuleVoter::reset() {
+    count_ = 0;
+    next_ = 0;
+}
+
+void ModuleVoter::add(const struct quirc_code &code) {
+    if (depth_ <= 0) {
+        return;
+    }
+    if (code.size != size_) {
+        reset();
+        size_ = code.size;
+        bytes_ = ((size_t)size_ * size_ + 7) / 8;
+        history_.resize(bytes_ * depth_);
+    }
+    memcpy(&history_[bytes_ * next_], code.cell_bitmap, bytes_);
+    memcpy(corners_, code.corners, sizeof(corners_));
+    next_ = (next_ + 1) % depth_;
+    if (count_ < depth_) {
+        count_++;
+    }
+}
+
+bool ModuleVoter::vote(struct quirc_code *code) const {
+    if (count_ < 2) {
+        return false;
+    }
+    int latest = (next_ + depth_ - 1) % depth_;
+    int majority = count_ / 2 + 1;
+    bool even = count_ % 2 == 0;
+    memset(code->cell_bitmap, 0, sizeof(code->cell_bitmap));
+    // slots 0..count_-1 are filled whether or not the ring has wrapped
+    for (size_t i = 0; i < bytes_; i++) {
+        int votes[8] = {0};
+        for (int f = 0; f < count_; f++) {
+            uint8_t b = history_[bytes_ * f + i];
+            for (int bit = 0; bit < 8; bit++) {
+                votes[bit] += (b >> bit) & 1;
+            }
+        }
+        uint8_t tie_break = history_[bytes_ * latest + i];
+        uint8_t out = 0;
+        for (int bit = 0; bit < 8; bit++) {
+            bool set = votes[bit] >= majority ||
+                       (even && votes[bit] == count_ / 2 && ((tie_break >> bit) & 1));
+            out |= (uint8_t)set << bit;
+        }
+        code->cell_bitmap[i] = out;
+    }
+    code->size = size_;
+    memcpy(code->corners, corners_, sizeof(corners_));
+    return true;
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <quirc.h>
+#include <vector>
+
+// Grids of the same code accumulated for a vote; 0 disables fusion.
+#ifndef QR_FUSION_FRAMES
+#define QR_FUSION_FRAMES 5
+#endif
+
+// Fuses the sampled grids of one tracked code over consecutive frames.
+// A marginal code usually gets a few different modules wrong in each
+// frame, so a per-module majority over the last frames can decode when
+// no single frame does. Grids must be added before QrDecoder::decode(),
+// which may mirror them.
+class ModuleVoter {
+  public:
+    explicit ModuleVoter(int depth = QR_FUSION_FRAMES);
+
+    // Record a grid. A grid of a different size starts over.
+    void add(const struct quirc_code &code);
+
+    // Grids recorded since the last reset, at most depth.
+    int frames() const {
+        return count_;
+    }
+
+    // Write the per-module majority of the recorded grids into code, with
+    // the corners of the latest one. Ties go to the latest grid. Returns
+    // false if fewer than two grids were recorded.
+    bool vote(struct quirc_code *code) const;
+
+    void reset();
+
+  private:
+    int depth_;
+    int size_ = 0;         // grid size of the recorded grids
+    size_t bytes_ = 0;     // bitmap bytes per grid
+    int count_ = 0;
+    int next_ = 0;         // ring slot of the next grid
+    struct quirc_point corners_[4];
+    std::vector<uint8_t> history_; // depth_ bitmaps
+};
@@ -0,0 +1,257 @@
+// Host build of the scanner (pio run -e native): replays recorded frames
+// through the same capture/decode path as the device and prints what the
+// device would do with each payload, WiFi provisioning included.
+//
+//   .pio/build/native/program [--fps N] [--loop] frame.pgm...
+//   .pio/build/native/program --unpack recording.qrr dir
+//
+// Without --fps every frame is decoded in order on this thread. With it,
+// frames are paced like the camera and go through the Pipeline, so
+// frames the decoder can't keep up with are dropped as on the device.
+//
+// --unpack turns a recording from the device's frame recorder into a
+// corpus clip: dir/0001.pgm, ... and dir/frames.tsv with what the device
+// made of each frame.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <quirc.h>
+#include <thread>
+#include <vector>
+
+#include "decode_session.h"
+#include "file_frame_source.h"
+#include "payload_router.h"
+#include "pgm.h"
+#include "pipeline.h"
+#include "record_reader.h"
+#include "stage_timer.h"
+#include "wifi_uri.h"
+#include "worker_pool.h"
+
+#define DECODE_WORKERS 2
+#define RESULT_QUEUE_DEPTH 16
+#define POLL_MS 20
+
+struct ReplayStats {
+    uint32_t results;
+    uint32_t errors;
+};
+
+static ReplayStats replay;
+static PayloadRouter router;
+
+static void printPayload(const char *what, const PayloadView &p) {
+    printf("%s '%.*s'\n", what, (int)p.len, p.data);
+}
+
+static void onText(const PayloadMatch &match) {
+    printPayload("text", match.payload);
+}
+
+static void onWiFi(const PayloadMatch &match) {
+    WiFiConfig wcfg;
+    if (!parseWiFiUri(match.payload.data, match.payload.len, wcfg) || !wcfg.ssid[0]) {
+        printPayload("text", match.payload);
+        return;
+    }
+    printf("wifi: would join SSID '%s' type '%s' password '%s'\n",
+           wcfg.ssid, wcfg.type, wcfg.password);
+}
+
+static void onUrl(const PayloadMatch &match) {
+    printPayload("url", match.payload);
+}
+
+static void onMecard(const PayloadMatch &match) {
+    printPayload("mecard", match.payload);
+}
+
+static void onDpp(const PayloadMatch &match) {
+    printPayload("dpp", match.payload);
+}
+
+static void handleScanResult(const ScanResult &result) {
+    replay.results++;
+    if (result.err) {
+        replay.errors++;
+        printf("decode: %s\n", quirc_strerror(result.err));
+        return;
+    }
+    const struct quirc_data &d = result.data;
+    printf("latency %lld us version %d ecc %c mask %d length %d\n",
+           (long long)result.latency_us, d.version, "MLHQ"[d.ecc_level],
+           d.mask, d.payload_len);
+    router.dispatch((const char *)d.payload, d.payload_len);
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "usage: %s [--fps N] [--loop] frame.pgm...\n", prog);
+    fprintf(stderr, "       %s --unpack recording.qrr dir\n", prog);
+    exit(2);
+}
+
+// payloads with the corpus manifest's \t, \n and \\ escapes
+static void printEscaped(FILE *f, const std::vector<uint8_t> &payload) {
+    for (uint8_t c : payload) {
+        if (c == '\t' || c == '\n' || c == '\\') {
+            fputc('\\', f);
+            c = c == '\t' ? 't' : c == '\n' ? 'n' : c;
+        }
+        fputc(c, f);
+    }
+}
+
+static int unpack(const char *recording, const char *dir) {
+    FILE *in = fopen(recording, "rb");
+    if (!in) {
+        perror(recording);
+        return 1;
+    }
+    char path[1024];
+    snprintf(path, sizeof(path), "%s/frames.tsv", dir);
+    FILE *tsv = fopen(path, "w");
+    if (!tsv) {
+        perror(path);
+        fclose(in);
+        return 1;
+    }
+    fprintf(tsv, "# file\tseq\ttimestamp_us\twidth\theight\tcodes\tdecoded\tdecode_us\tpayload\n");
+    RecordReader reader(in);
+    RecordHeader h;
+    std::vector<uint8_t> payload, pixels;
+    int status = 0;
+    while (reader.next(h, payload, pixels)) {
+        char name[32];
+        snprintf(name, sizeof(name), "%04u.pgm", reader.stats().records);
+        snprintf(path, sizeof(path), "%s/%s", dir, name);
+        if (!writePgm(path, pixels.data(), h.width, h.height)) {
+            perror(path);
+            status = 1;
+            break;
+        }
+        fprintf(tsv, "%s\t%u\t%lld\t%u\t%u\t%u\t%u\t%u\t", name, h.seq,
+                (long long)h.timestamp_us, h.width, h.height, h.codes, h.decoded, h.decode_us);
+        printEscaped(tsv, payload);
+        fputc('\n', tsv);
+    }
+    fclose(tsv);
+    fclose(in);
+    const RecordReaderStats &st = reader.stats();
+    printf("frames %u damaged %u unreferenced %u skipped bytes %llu\n", st.records,
+           st.damaged, st.unreferenced, (unsigned long long)st.skipped_bytes);
+    return status;
+}
+
+int main(int argc, char **argv) {
+    float fps = 0;
+    bool loop = false;
+    int first = 1;
+    if (argc == 4 && !strcmp(argv[1], "--unpack")) {
+        return unpack(argv[2], argv[3]);
+    }
+    for (; first < argc && !strncmp(argv[first], "--", 2); first++) {
+        if (!strcmp(argv[first], "--fps") && first + 1 < argc) {
+            fps = atof(argv[++first]);
+        } else if (!strcmp(argv[first], "--loop")) {
+            loop = true;
+        } else {
+            usage(argv[0]);
+        }
+    }
+    if (loop && fps <= 0) {
+        fprintf(stderr, "--loop needs --fps\n");
+        usage(argv[0]);
+    }
+
+    FileFrameSource source(fps, loop);
+    for (int i = first; i < argc; i++) {
+        if (!source.add(argv[i])) {
+            fprintf(stderr, "%s: not a binary PGM\n", argv[i]);
+            return 1;
+        }
+    }
+    if (!source.frames()) {
+        usage(argv[0]);
+    }
+
+    router.on(SCHEME_TEXT, onText);
+    router.on(SCHEME_WIFI, onWiFi);
+    router.on(SCHEME_URL, onUrl);
+    router.on(SCHEME_MECARD, onMecard);
+    router.on(SCHEME_DPP, onDpp);
+
+    PipelineConfig pcfg;
+    WorkerPool pool(DECODE_WORKERS - 1, pcfg.capture_core, pcfg.decode_stack, 1);
+    DecodeSession session(&pool, source.numLevels());
+    BoundedQueue<ScanResult> results(RESULT_QUEUE_DEPTH);
+    auto post = [&results](const ScanResult &result) {
+        results.push(result);
+    };
+    ScanResult result;
+
+    if (fps <= 0) {
+        Frame frame;
+        while (source.grab(frame)) {
+            ScopedStage timer(STAGE_FRAME);
+            frame.held = true;
+            session.decode(frame, [&] {
+                if (frame.held) {
+                    frame.held = false;
+                    source.release(frame);
+                }
+            }, post);
+            if (frame.held) {
+                source.release(frame);
+            }
+            while (results.pop(result, 0)) {
+                handleScanResult(result);
+            }
+        }
+        printf("frames %zu\n", source.frames());
+    } else {
+        Pipeline *pipeline = nullptr;
+        pcfg.capture = [&source](Frame &frame) {
+            return source.grab(frame);
+        };
+        pcfg.decode = [&](Frame &frame) {
+            ScopedStage timer(STAGE_FRAME);
+            session.decode(frame, [&] { pipeline->release(frame); }, post);
+        };
+        pcfg.release = [&source](Frame &frame) {
+            source.release(frame);
+        };
+        pipeline = new Pipeline(pcfg);
+        pipeline->start();
+        // with --loop this runs until interrupted
+        for (;;) {
+            while (results.pop(result, POLL_MS)) {
+                handleScanResult(result);
+            }
+            PipelineStats st = pipeline->stats();
+            if (source.finished() && st.decoded + st.dropped == st.captured) {
+                break;
+            }
+        }
+        pipeline->stop();
+        while (results.pop(result, 0)) {
+            handleScanResult(result);
+        }
+        PipelineStats st = pipeline->stats();
+        printf("frames %u decoded %u dropped %u\n", st.captured, st.decoded, st.dropped);
+        delete pipeline;
+    }
+
+    const QrScannerStats &st = session.scanner().stats();
+    const DecodeStats &ds = session.stats();
+    printf("results %u errors %u cache hits %u fused decodes %u\n",
+           replay.results, replay.errors, ds.cache_hits, ds.fused_decodes);
+    printf("blur rejects %u windowed %u coarse rejects %u\n",
+           st.blur_rejects, st.windowed, st.coarse_rejects);
+    stageReport([](const char *line) {
+        printf("%s\n", line);
+    });
+    return 0;
+}
@@ -0,0 +1,421 @@
+#include "qr_encoder.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+// ISO/IEC 18004 table 9, indexed by level and version
+static const uint8_t ecc_per_block[4][41] = {
+    {0, 7, 10, 15, 20, 26, 18, 20, 24, 30, 18, 20, 24, 26, 30, 22, 24, 28, 30, 28, 28,
+     28, 28, 30, 30, 26, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30},
+    {0, 10, 16, 26, 18, 24, 16, 18, 22, 22, 26, 30, 22, 22, 24, 24, 28, 28, 26, 26, 26,
+     26, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28, 28},
+    {0, 13, 22, 18, 26, 18, 24, 18, 22, 20, 24, 28, 26, 24, 20, 30, 24, 28, 28, 26, 30,
+     28, 30, 30, 30, 30, 28, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30},
+    {0, 17, 28, 22, 16, 22, 28, 26, 26, 24, 28, 24, 28, 22, 24, 24, 30, 28, 28, 26, 28,
+     30, 24, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30, 30},
+};
+
+static const uint8_t num_blocks[4][41] = {
+    {0, 1, 1, 1, 1, 1, 2, 2, 2, 2, 4, 4, 4, 4, 4, 6, 6, 6, 6, 7, 8,
+     8, 9, 9, 10, 12, 12, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21, 22, 24, 25},
+    {0, 1, 1, 1, 2, 2, 4, 4, 4, 5, 5, 5, 8, 9, 9, 10, 10, 11, 13, 14, 16,
+     17, 17, 18, 20, 21, 23, 25, 26, 28, 29, 31, 33, 35, 37, 38, 40, 43, 45, 47, 49},
+    {0, 1, 1, 2, 2, 4, 4, 6, 6, 8, 8, 8, 10, 12, 16, 12, 17, 16, 18, 21, 20,
+     23, 23, 25, 27, 29, 34, 34, 35, 38, 40, 43, 45, 48, 51, 53, 56, 59, 62, 65, 68},
+    {0, 1, 1, 2, 4, 4, 4, 5, 6, 8, 8, 11, 11, 16, 16, 18, 16, 19, 21, 25, 25,
+     25, 34, 30, 32, 35, 37, 40, 42, 45, 48, 51, 54, 57, 60, 63, 66, 70, 74, 77, 81},
+};
+
+// level bits of the format information
+static const int ecc_format_bits[4] = {1, 0, 3, 2};
+
+// modules left for codewords once the function patterns are placed
+static int rawDataModules(int version) {
+    int n = (16 * version + 128) * version + 64;
+    if (version >= 2) {
+        int align = version / 7 + 2;
+        n -= (25 * align - 10) * align - 55;
+        if (version >= 7) {
+            n -= 36;
+        }
+    }
+    return n;
+}
+
+static int dataCodewords(int version, QrEcc ecc) {
+    return rawDataModules(version) / 8 - ecc_per_block[ecc][version] * num_blocks[ecc][version];
+}
+
+// GF(256) with the QR polynomial x^8 + x^4 + x^3 + x^2 + 1
+static uint8_t gfMul(uint8_t a, uint8_t b) {
+    int r = 0;
+    for (int i = 7; i >= 0; i--) {
+        r = (r << 1) ^ ((r >> 7) * 0x11d);
+        r ^= ((b >> i) & 1) * a;
+    }
+    return (uint8_t)r;
+}
+
+// coefficients of prod(x - 2^i), highest first without the leading 1
+static std::vector<uint8_t> rsDivisor(int degree) {
+    std::vector<uint8_t> d(degree);
+    d[degree - 1] = 1;
+    uint8_t root = 1;
+    for (int i = 0; i < degree; i++) {
+        for (int j = 0; j < degree; j++) {
+            d[j] = gfMul(d[j], root);
+            if (j + 1 < degree) {
+                d[j] ^= d[j + 1];
+            }
+        }
+        root = gfMul(root, 2);
+    }
+    return d;
+}
+
+static std::vector<uint8_t> rsRemainder(const uint8_t *data, int len,
+                                        const std::vector<uint8_t> &divisor) {
+    std::vector<uint8_t> r(divisor.size());
+    for (int i = 0; i < len; i++) {
+        uint8_t factor = data[i] ^ r[0];
+        r.erase(r.begin());
+        r.push_back(0);
+        for (size_t j = 0; j < r.size(); j++) {
+            r[j] ^= gfMul(divisor[j], factor);
+        }
+    }
+    return r;
+}
+
+namespace {
+
+class Matrix {
+  public:
+    Matrix(QrSymbol &s) : s_(s), function_((size_t)s.size * s.size) {
+        s_.modules.assign((size_t)s.size * s.size, 0);
+    }
+
+    void set(int x, int y, bool dark, bool function = true) {
+        s_.modules[(size_t)y * s_.size + x] = dark;
+        function_[(size_t)y * s_.size + x] = function;
+    }
+
+    bool isFunction(int x, int y) const {
+        return function_[(size_t)y * s_.size + x];
+    }
+
+    void drawFunctionPatterns();
+    void drawFormat(QrEcc ecc, int mask);
+    void drawCodewords(const std::vector<uint8_t> &codewords);
+    void applyMask(int mask);
+    long penalty() const;
+
+  private:
+    void drawFinder(int cx, int cy);
+    void drawAlignment(int cx, int cy);
+
+    QrSymbol &s_;
+    std::vector<uint8_t> function_;
+};
+
+} // namespace
+
+void Matrix::drawFinder(int cx, int cy) {
+    int n = s_.size;
+    for (int dy = -4; dy <= 4; dy++) {
+        for (int dx = -4; dx <= 4; dx++) {
+            int x = cx + dx, y = cy + dy;
+            if (x < 0 || y < 0 || x >= n || y >= n) {
+                continue;
+            }
+            int d = std::max(abs(dx), abs(dy));
+            set(x, y, d != 2 && d != 4);
+        }
+    }
+}
+
+void Matrix::drawAlignment(int cx, int cy) {
+    for (int dy = -2; dy <= 2; dy++) {
+        for (int dx = -2; dx <= 2; dx++) {
+            set(cx + dx, cy + dy, std::max(abs(dx), abs(dy)) != 1);
+        }
+    }
+}
+
+void Matrix::drawFunctionPatterns() {
+    int n = s_.size, version = s_.version;
+    for (int i = 0; i < n; i++) {
+        set(6, i, i % 2 == 0);
+        set(i, 6, i % 2 == 0);
+    }
+    drawFinder(3, 3);
+    drawFinder(n - 4, 3);
+    drawFinder(3, n - 4);
+
+    if (version > 1) {
+        int align = version / 7 + 2;
+        int step = version == 32 ? 26 : (version * 4 + align * 2 + 1) / (align * 2 - 2) * 2;
+        std::vector<int> pos(align);
+        pos[0] = 6;
+        for (int i = align - 1, p = n - 7; i > 0; i--, p -= step) {
+            pos[i] = p;
+        }
+        for (int i = 0; i < align; i++) {
+            for (int j = 0; j < align; j++) {
+                // the finder corners
+                if ((i == 0 && j == 0) || (i == 0 && j == align - 1) ||
+                        (i == align - 1 && j == 0)) {
+                    continue;
+                }
+                drawAlignment(pos[i], pos[j]);
+            }
+        }
+    }
+
+    // reserve the format areas, filled in per mask
+    drawFormat(QR_ECC_L, 0);
+
+    if (version >= 7) {
+        int rem = version;
+        for (int i = 0; i < 12; i++) {
+            rem = (rem << 1) ^ ((rem >> 11) * 0x1f25);
+        }
+        long bits = (long)version << 12 | rem;
+        for (int i = 0; i < 18; i++) {
+            bool bit = (bits >> i) & 1;
+            int a = n - 11 + i % 3, b = i / 3;
+            set(a, b, bit);
+            set(b, a, bit);
+        }
+    }
+}
+
+void Matrix::drawFormat(QrEcc ecc, int mask) {
+    int n = s_.size;
+    int data = ecc_format_bits[ecc] << 3 | mask;
+    int rem = data;
+    for (int i = 0; i < 10; i++) {
+        rem = (rem << 1) ^ ((rem >> 9) * 0x537);
+    }
+    int bits = (data << 10 | rem) ^ 0x5412;
+    auto bit = [bits](int i) {
+        return ((bits >> i) & 1) != 0;
+    };
+
+    // around the top left finder
+    for (int i = 0; i <= 5; i++) {
+        set(8, i, bit(i));
+    }
+    set(8, 7, bit(6));
+    set(8, 8, bit(7));
+    set(7, 8, bit(8));
+    for (int i = 9; i < 15; i++) {
+        set(14 - i, 8, bit(i));
+    }
+
+    // split between the other two finders
+    for (int i = 0; i < 8; i++) {
+        set(n - 1 - i, 8, bit(i));
+    }
+    for (int i = 8; i < 15; i++) {
+        set(8, n - 15 + i, bit(i));
+    }
+    set(8, n - 8, true);
+}
+
+// two-module columns zigzagging up and down from the right edge
+void Matrix::drawCodewords(const std::vector<uint8_t> &codewords) {
+    int n = s_.size;
+    size_t i = 0, bits = codewords.size() * 8;
+    for (int right = n - 1; right >= 1; right -= 2) {
+        if (right == 6) {
+            right = 5; // skip the vertical timing pattern
+        }
+        bool upward = ((right + 1) & 2) == 0;
+        for (int vert = 0; vert < n; vert++) {
+            int y = upward ? n - 1 - vert : vert;
+            for (int j = 0; j < 2; j++) {
+                int x = right - j;
+                if (isFunction(x, y)) {
+                    continue;
+                }
+                // remainder bits stay light
+                bool dark = i < bits && ((codewords[i >> 3] >> (7 - (i & 7))) & 1);
+                set(x, y, dark, false);
+                i++;
+            }
+        }
+    }
+}
+
+void Matrix::applyMask(int mask) {
+    int n = s_.size;
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            bool invert;
+            switch (mask) {
+                case 0: invert = (x + y) % 2 == 0; break;
+                case 1: invert = y % 2 == 0; break;
+                case 2: invert = x % 3 == 0; break;
+                case 3: invert = (x + y) % 3 == 0; break;
+                case 4: invert = (x / 3 + y / 2) % 2 == 0; break;
+                case 5: invert = x * y % 2 + x * y % 3 == 0; break;
+                case 6: invert = (x * y % 2 + x * y % 3) % 2 == 0; break;
+                default: invert = ((x + y) % 2 + x * y % 3) % 2 == 0; break;
+            }
+            if (invert && !isFunction(x, y)) {
+                s_.modules[(size_t)y * n + x] ^= 1;
+            }
+        }
+    }
+}
+
+// the four penalty rules of ISO/IEC 18004 section 7.8.3
+long Matrix::penalty() const {
+    int n = s_.size;
+    long score = 0;
+    auto at = [this, n](int x, int y) {
+        return s_.modules[(size_t)y * n + x];
+    };
+    static const uint8_t finder_like[2][11] = {
+        {1, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0},
+        {0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1},
+    };
+    for (int pass = 0; pass < 2; pass++) {
+        // rows, then columns
+        auto m = [&](int a, int b) {
+            return pass ? at(b, a) : at(a, b);
+        };
+        for (int b = 0; b < n; b++) {
+            int run = 1;
+            for (int a = 1; a <= n; a++) {
+                if (a < n && m(a, b) == m(a - 1, b)) {
+                    run++;
+                    continue;
+                }
+                if (run >= 5) {
+                    score += run - 2;
+                }
+                run = 1;
+            }
+            for (int a = 0; a + 11 <= n; a++) {
+                for (const uint8_t *p : finder_like) {
+                    int k = 0;
+                    while (k < 11 && m(a + k, b) == p[k]) {
+                        k++;
+                    }
+                    if (k == 11) {
+                        score += 40;
+                    }
+                }
+            }
+        }
+    }
+    int dark = 0;
+    for (int y = 0; y < n; y++) {
+        for (int x = 0; x < n; x++) {
+            dark += at(x, y);
+            if (x + 1 < n && y + 1 < n && at(x, y) == at(x + 1, y) &&
+                    at(x, y) == at(x, y + 1) && at(x, y) == at(x + 1, y + 1)) {
+                score += 3;
+            }
+        }
+    }
+    score += abs(dark * 100 / (n * n) - 50) / 5 * 10;
+    return score;
+}
+
+bool qrEncode(const uint8_t *data, size_t len, QrEcc ecc, QrSymbol &symbol,
+              int min_version, int mask) {
+    int version = std::max(min_version, 1);
+    for (;; version++) {
+        if (version > 40) {
+            return false;
+        }
+        int count_bits = version < 10 ? 8 : 16;
+        if (len < (1u << count_bits) &&
+                4 + count_bits + len * 8 <= (size_t)dataCodewords(version, ecc) * 8) {
+            break;
+        }
+    }
+
+    // byte mode segment, terminator and padding
+    int capacity = dataCodewords(version, ecc);
+    std::vector<uint8_t> bytes;
+    uint32_t acc = 0;
+    int acc_bits = 0;
+    auto put = [&](uint32_t v, int n) {
+        acc = acc << n | v;
+        acc_bits += n;
+        while (acc_bits >= 8) {
+            acc_bits -= 8;
+            bytes.push_back((uint8_t)(acc >> acc_bits));
+        }
+    };
+    put(4, 4);
+    put((uint32_t)len, version < 10 ? 8 : 16);
+    for (size_t i = 0; i < len; i++) {
+        put(data[i], 8);
+    }
+    int terminator = std::min(4, capacity * 8 - ((int)bytes.size() * 8 + acc_bits));
+    put(0, terminator);
+    if (acc_bits) {
+        put(0, 8 - acc_bits);
+    }
+    for (uint8_t pad = 0xec; (int)bytes.size() < capacity; pad ^= 0xec ^ 0x11) {
+        bytes.push_back(pad);
+    }
+
+    // split into blocks, the long ones last, and interleave
+    int blocks = num_blocks[ecc][version];
+    int ecc_len = ecc_per_block[ecc][version];
+    int raw = rawDataModules(version) / 8;
+    int short_blocks = blocks - raw % blocks;
+    int short_data = raw / blocks - ecc_len;
+    std::vector<uint8_t> divisor = rsDivisor(ecc_len);
+    std::vector<std::vector<uint8_t>> block_ecc(blocks);
+    std::vector<int> block_start(blocks);
+    for (int b = 0, k = 0; b < blocks; b++) {
+        int n = short_data + (b < short_blocks ? 0 : 1);
+        block_start[b] = k;
+        block_ecc[b] = rsRemainder(&bytes[k], n, divisor);
+        k += n;
+    }
+    std::vector<uint8_t> codewords;
+    for (int i = 0; i <= short_data; i++) {
+        for (int b = 0; b < blocks; b++) {
+            if (i < short_data || b >= short_blocks) {
+                codewords.push_back(bytes[block_start[b] + i]);
+            }
+        }
+    }
+    for (int i = 0; i < ecc_len; i++) {
+        for (int b = 0; b < blocks; b++) {
+            codewords.push_back(block_ecc[b][i]);
+        }
+    }
+
+    symbol.version = version;
+    symbol.size = 17 + 4 * version;
+    Matrix m(symbol);
+    m.drawFunctionPatterns();
+    m.drawCodewords(codewords);
+
+    if (mask < 0) {
+        long best = -1;
+        for (int i = 0; i < 8; i++) {
+            m.applyMask(i);
+            m.drawFormat(ecc, i);
+            long score = m.penalty();
+            if (best < 0 || score < best) {
+                best = score;
+                mask = i;
+            }
+            m.applyMask(i); // XOR undoes it
+        }
+    }
+    m.applyMask(mask);
+    m.drawFormat(ecc, mask);
+    symbol.mask = mask;
+    return true;
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Error correction levels, weakest first.
+enum QrEcc : uint8_t { QR_ECC_L, QR_ECC_M, QR_ECC_Q, QR_ECC_H };
+
+// An encoded QR code symbol, without its quiet zone.
+struct QrSymbol {
+    int version = 0;
+    int size = 0; // modules per side, 17 + 4 * version
+    int mask = 0;
+    std::vector<uint8_t> modules; // row major, 1 is dark
+
+    bool dark(int x, int y) const {
+        return modules[(size_t)y * size + x];
+    }
+};
+
+// Encodes data in byte mode into the smallest version, not below
+// min_version, that holds it. mask -1 picks the mask with the lowest
+// penalty score, like phone and web encoders do. False if the data
+// doesn't fit version 40.
+bool qrEncode(const uint8_t *data, size_t len, QrEcc ecc, QrSymbol &symbol,
+              int min_version = 1, int mask = -1);
@@ -0,0 +1,92 @@
+#include "record_reader.h"
+
+#include <cstring>
+
+#include "frame_codec.h"
+
+#define READ_CHUNK 65536
+// sanity limit on header sizes, well above the camera's VGA
+#define RECORD_MAX_SIDE 4096
+
+bool RecordReader::fill(size_t len) {
+    if (pos_ > READ_CHUNK) {
+        buf_.erase(buf_.begin(), buf_.begin() + pos_);
+        pos_ = 0;
+    }
+    while (buf_.size() - pos_ < len) {
+        size_t old = buf_.size();
+        buf_.resize(old + READ_CHUNK);
+        size_t n = fread(&buf_[old], 1, READ_CHUNK, file_);
+        buf_.resize(old + n);
+        if (!n) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// past len bytes that aren't a record, up to the next possible magic
+void RecordReader::skip(size_t len) {
+    size_t end = pos_ + len;
+    while (end < buf_.size() && buf_[end] != (RECORD_MAGIC & 0xff)) {
+        end++;
+    }
+    stats_.skipped_bytes += end - pos_;
+    pos_ = end;
+}
+
+bool RecordReader::next(RecordHeader &header, std::vector<uint8_t> &payload,
+                        std::vector<uint8_t> &pixels) {
+    for (;;) {
+        if (!fill(RECORD_HEADER_SIZE)) {
+            stats_.skipped_bytes += buf_.size() - pos_;
+            pos_ = buf_.size();
+            return false;
+        }
+        RecordHeader h;
+        if (!parseRecordHeader(&buf_[pos_], h) || !h.width || !h.height ||
+            h.width > RECORD_MAX_SIDE || h.height > RECORD_MAX_SIDE ||
+            h.payload_len > RECORD_PAYLOAD_MAX ||
+            h.data_len > packBound((size_t)h.width * h.height)) {
+            skip(1);
+            continue;
+        }
+        size_t len = RECORD_HEADER_SIZE + h.payload_len + h.data_len;
+        if (!fill(len + 4)) {
+            skip(1); // truncated, the stream ended mid-record
+            continue;
+        }
+        const uint8_t *p = &buf_[pos_];
+        uint32_t crc = p[len] | p[len + 1] << 8 | p[len + 2] << 16 | (uint32_t)p[len + 3] << 24;
+        if (crc32(0, p, len) != crc) {
+            // a record may start anywhere inside a damaged one; the
+            // reference stays, deltas name the frame they need
+            stats_.damaged++;
+            skip(1);
+            continue;
+        }
+        pos_ += len + 4;
+
+        bool key = h.flags & RECORD_KEY;
+        if (!key && (!have_prev_ || h.base_seq != prev_seq_ || h.width != prev_width_ ||
+                     h.height != prev_height_)) {
+            stats_.unreferenced++;
+            continue;
+        }
+        pixels.resize((size_t)h.width * h.height);
+        if (!unpackFrame(p + RECORD_HEADER_SIZE + h.payload_len, h.data_len,
+                         key ? nullptr : prev_.data(), h.width, h.height, pixels.data())) {
+            stats_.damaged++;
+            continue;
+        }
+        payload.assign(p + RECORD_HEADER_SIZE, p + RECORD_HEADER_SIZE + h.payload_len);
+        prev_ = pixels;
+        prev_width_ = h.width;
+        prev_height_ = h.height;
+        prev_seq_ = h.seq;
+        have_prev_ = true;
+        stats_.records++;
+        header = h;
+        return true;
+    }
+}
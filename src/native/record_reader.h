@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "frame_recorder.h"
+
+struct RecordReaderStats {
+    uint32_t records;       // frames returned
+    uint32_t damaged;       // records that failed the CRC or didn't unpack
+    uint32_t unreferenced;  // intact, but packed against a frame that was lost
+    uint64_t skipped_bytes; // not part of an intact record, e.g. log output
+};
+
+// Reads the frames of a recording (frame_recorder.h) from a file or a
+// captured serial stream. Anything that isn't an intact record is
+// skipped; a frame packed against one that was lost is skipped too, up to
+// the next key frame.
+class RecordReader {
+  public:
+    explicit RecordReader(FILE *file) : file_(file) {}
+
+    // The next frame, false at the end of the input.
+    bool next(RecordHeader &header, std::vector<uint8_t> &payload,
+              std::vector<uint8_t> &pixels);
+
+    const RecordReaderStats &stats() const {
+        return stats_;
+    }
+
+  private:
+    bool fill(size_t len);
+    void skip(size_t len);
+
+    FILE *file_;
+    std::vector<uint8_t> buf_;
+    size_t pos_ = 0;
+    std::vector<uint8_t> prev_;
+    int prev_width_ = 0;
+    int prev_height_ = 0;
+    uint32_t prev_seq_ = 0;
+    bool have_prev_ = false;
+    RecordReaderStats stats_ = {};
+};
@@ -0,0 +1,221 @@
+#include "synth_frame.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+static const float deg = (float)M_PI / 180;
+
+// 3x3 homogeneous transforms, row major
+struct Mat3 {
+    float m[9];
+
+    Mat3 operator*(const Mat3 &b) const {
+        Mat3 r;
+        for (int i = 0; i < 3; i++) {
+            for (int j = 0; j < 3; j++) {
+                r.m[i * 3 + j] = m[i * 3] * b.m[j] + m[i * 3 + 1] * b.m[3 + j] +
+                                 m[i * 3 + 2] * b.m[6 + j];
+            }
+        }
+        return r;
+    }
+
+    Mat3 inverse() const {
+        const float *a = m;
+        Mat3 r = {{a[4] * a[8] - a[5] * a[7], a[2] * a[7] - a[1] * a[8], a[1] * a[5] - a[2] * a[4],
+                   a[5] * a[6] - a[3] * a[8], a[0] * a[8] - a[2] * a[6], a[2] * a[3] - a[0] * a[5],
+                   a[3] * a[7] - a[4] * a[6], a[1] * a[6] - a[0] * a[7], a[0] * a[4] - a[1] * a[3]}};
+        float det = a[0] * r.m[0] + a[1] * r.m[3] + a[2] * r.m[6];
+        for (float &v : r.m) {
+            v /= det;
+        }
+        return r;
+    }
+};
+
+// maps code plane coordinates in modules, the quiet zone starting at 0,
+// to frame pixels
+static Mat3 codeToFrame(const QrSymbol &symbol, const SynthParams &p) {
+    float extent = symbol.size + 2 * p.quiet;
+    float half = extent / 2;
+    float d = p.distance * extent * p.module_px; // camera distance, pixels
+    float c = cosf(p.rotate_deg * deg), s = sinf(p.rotate_deg * deg);
+    float cx = cosf(p.tilt_x_deg * deg), sx = sinf(p.tilt_x_deg * deg);
+    float cy = cosf(p.tilt_y_deg * deg), sy = sinf(p.tilt_y_deg * deg);
+
+    // code plane centered and scaled to pixels, rotated in plane
+    Mat3 plane = {{p.module_px * c, -p.module_px * s, -half * p.module_px * (c - s),
+                   p.module_px * s, p.module_px * c, -half * p.module_px * (s + c),
+                   0, 0, 1}};
+    // tilt (rotation about x, then y) keeping columns 1 and 2 of the
+    // rotation, the plane's z is 0; pushed out to distance d
+    float r[9] = {cy, sy * sx, 0, 0, cx, 0, -sy, cy * sx, 0};
+    Mat3 pose = {{r[0], r[1], 0, r[3], r[4], 0, r[6], r[7], d}};
+    // pinhole with focal length d, so the center keeps module_px
+    Mat3 camera = {{d, 0, p.center_x * p.width, 0, d, p.center_y * p.height, 0, 0, 1}};
+    return camera * pose * plane;
+}
+
+static float gauss(uint32_t &state) {
+    // sum of four uniforms, variance scaled to 1
+    float sum = 0;
+    for (int i = 0; i < 4; i++) {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        sum += (state >> 8) * (1.0f / (1 << 24));
+    }
+    return (sum - 2) * 1.7320508f;
+}
+
+// separable gaussian, the vertical pass a row at a time to stay in cache
+static void blur(std::vector<float> &img, int width, int height, float sigma) {
+    int radius = (int)ceilf(3 * sigma);
+    std::vector<float> kernel(2 * radius + 1);
+    float total = 0;
+    for (int i = -radius; i <= radius; i++) {
+        kernel[i + radius] = expf(-0.5f * i * i / (sigma * sigma));
+        total += kernel[i + radius];
+    }
+    for (float &k : kernel) {
+        k /= total;
+    }
+    std::vector<float> tmp(img.size());
+    std::vector<float> padded(width + 2 * radius);
+    for (int y = 0; y < height; y++) {
+        const float *in = &img[(size_t)y * width];
+        std::fill(padded.begin(), padded.begin() + radius, in[0]);
+        std::copy(in, in + width, padded.begin() + radius);
+        std::fill(padded.end() - radius, padded.end(), in[width - 1]);
+        float *out = &tmp[(size_t)y * width];
+        for (int x = 0; x < width; x++) {
+            const float *window = &padded[x];
+            float sum = 0;
+            for (int k = 0; k <= 2 * radius; k++) {
+                sum += kernel[k] * window[k];
+            }
+            out[x] = sum;
+        }
+    }
+    for (int y = 0; y < height; y++) {
+        float *out = &img[(size_t)y * width];
+        std::fill(out, out + width, 0.0f);
+        for (int k = -radius; k <= radius; k++) {
+            const float *in = &tmp[(size_t)std::min(std::max(y + k, 0), height - 1) * width];
+            float weight = kernel[k + radius];
+            for (int x = 0; x < width; x++) {
+                out[x] += weight * in[x];
+            }
+        }
+    }
+}
+
+void renderQrFrame(const QrSymbol &symbol, const SynthParams &p, uint8_t *pixels) {
+    int w = p.width, h = p.height;
+    Mat3 fwd = codeToFrame(symbol, p);
+    Mat3 inv = fwd.inverse();
+    int extent = symbol.size + 2 * p.quiet;
+
+    // only the code's bounding box needs sampling
+    int x0 = 0, y0 = 0, x1 = w, y1 = h;
+    float xs[4], ys[4];
+    bool in_front = true;
+    for (int i = 0; i < 4; i++) {
+        float u = (i & 1) * extent, v = (i >> 1) * extent;
+        float z = fwd.m[6] * u + fwd.m[7] * v + fwd.m[8];
+        in_front = in_front && z > 0;
+        xs[i] = (fwd.m[0] * u + fwd.m[1] * v + fwd.m[2]) / z;
+        ys[i] = (fwd.m[3] * u + fwd.m[4] * v + fwd.m[5]) / z;
+    }
+    if (in_front) {
+        x0 = std::max(0, (int)floorf(*std::min_element(xs, xs + 4)));
+        y0 = std::max(0, (int)floorf(*std::min_element(ys, ys + 4)));
+        x1 = std::min(w, (int)ceilf(*std::max_element(xs, xs + 4)) + 1);
+        y1 = std::min(h, (int)ceilf(*std::max_element(ys, ys + 4)) + 1);
+    }
+    float center = extent / 2.0f;
+    float logo_half = p.logo * symbol.size / 2;
+    float mid = (p.dark + p.light) / 2.0f;
+
+    // 2x2 supersampled coverage of modules, quiet zone and overlay
+    std::vector<float> img((size_t)w * h, (float)p.background);
+    static const float offsets[4][2] = {{0.25f, 0.25f}, {0.75f, 0.25f},
+                                        {0.25f, 0.75f}, {0.75f, 0.75f}};
+    const float *m = inv.m;
+    for (int y = y0; y < y1; y++) {
+        for (int x = x0; x < x1; x++) {
+            float sum = 0;
+            for (const float *o : offsets) {
+                float fx = x + o[0], fy = y + o[1];
+                float z = m[6] * fx + m[7] * fy + m[8];
+                float iz = 1 / z;
+                float u = (m[0] * fx + m[1] * fy + m[2]) * iz;
+                float v = (m[3] * fx + m[4] * fy + m[5]) * iz;
+                if (z <= 0 || u < 0 || v < 0 || u >= extent || v >= extent) {
+                    sum += p.background;
+                    continue;
+                }
+                float du = fabsf(u - center), dv = fabsf(v - center);
+                if (du < logo_half && dv < logo_half) {
+                    // light tile with a dark glyph, like the shortcut icon
+                    float r = hypotf(du, dv) / logo_half;
+                    sum += r < 0.45f ? p.dark : r < 0.6f ? mid : p.light;
+                    continue;
+                }
+                int mx = (int)u - p.quiet, my = (int)v - p.quiet;
+                bool dark = mx >= 0 && my >= 0 && mx < symbol.size && my < symbol.size &&
+                            symbol.dark(mx, my);
+                sum += dark ? p.dark : p.light;
+            }
+            img[(size_t)y * w + x] = sum / 4;
+        }
+    }
+
+    if (p.moire > 0) {
+        // two gratings, sin(k(x c + y s)) + sin(k(y c - x s)), split into
+        // per column and per row terms
+        float c = cosf(p.moire_angle_deg * deg), s = sinf(p.moire_angle_deg * deg);
+        float k = 2 * (float)M_PI / p.moire_period_px;
+        std::vector<float> col(4 * w), row(4 * h);
+        for (int x = 0; x < w; x++) {
+            col[4 * x] = sinf(k * x * c);
+            col[4 * x + 1] = cosf(k * x * c);
+            col[4 * x + 2] = sinf(-k * x * s);
+            col[4 * x + 3] = cosf(-k * x * s);
+        }
+        for (int y = 0; y < h; y++) {
+            row[4 * y] = cosf(k * y * s);
+            row[4 * y + 1] = sinf(k * y * s);
+            row[4 * y + 2] = cosf(k * y * c);
+            row[4 * y + 3] = sinf(k * y * c);
+        }
+        float amplitude = p.moire * 0.5f;
+        for (int y = 0; y < h; y++) {
+            const float *r = &row[4 * y];
+            float *out = &img[(size_t)y * w];
+            for (int x = 0; x < w; x++) {
+                const float *q = &col[4 * x];
+                float a = q[0] * r[0] + q[1] * r[1];
+                float b = q[2] * r[2] + q[3] * r[3];
+                out[x] *= 1 + amplitude * (a + b);
+            }
+        }
+    }
+
+    if (p.blur_px > 0) {
+        blur(img, w, h, p.blur_px);
+    }
+
+    // gamma on the 8-bit level, noise after it like sensor noise
+    float curve[256];
+    for (int i = 0; i < 256; i++) {
+        curve[i] = 255 * powf(i / 255.0f, p.gamma);
+    }
+    uint32_t state = p.seed * 2654435761u | 1;
+    for (size_t i = 0; i < img.size(); i++) {
+        int level = (int)std::min(std::max(img[i] + 0.5f, 0.0f), 255.0f);
+        float v = curve[level] + (p.noise > 0 ? p.noise * gauss(state) : 0);
+        pixels[i] = (uint8_t)std::min(std::max(v + 0.5f, 0.0f), 255.0f);
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstdint>
+
+#include "qr_encoder.h"
+
+// How a synthetic frame is taken: where the code sits, how the camera
+// sees it and what degrades the image. The defaults are a sharp, flat,
+// well lit code in the middle of a VGA frame.
+struct SynthParams {
+    int width = 640;
+    int height = 480;
+    float module_px = 4;     // module edge at the code center, in pixels
+    float center_x = 0.5f;   // code center, fraction of the frame
+    float center_y = 0.5f;
+    float rotate_deg = 0;    // in the code plane
+    float tilt_x_deg = 0;    // code plane tilted about the horizontal axis
+    float tilt_y_deg = 0;    // and the vertical one
+    float distance = 3;      // camera distance in code widths, less is more perspective
+    float blur_px = 0;       // gaussian sigma
+    float noise = 0;         // gaussian sigma, gray levels
+    float gamma = 1;         // applied to the 0..1 intensity
+    float moire = 0;         // relative amplitude of a screen pixel grid beat
+    float moire_period_px = 9;
+    float moire_angle_deg = 12;
+    float logo = 0;          // center overlay edge, fraction of the symbol edge
+    uint8_t dark = 30;
+    uint8_t light = 220;
+    uint8_t background = 120;
+    int quiet = 4;           // quiet zone, modules
+    uint32_t seed = 1;       // noise
+};
+
+// Renders symbol into a params.width x params.height 8-bit grayscale frame.
+void renderQrFrame(const QrSymbol &symbol, const SynthParams &params, uint8_t *pixels);
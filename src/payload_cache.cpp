@@ -0,0 +1,212 @@
+#include "payload_cache.h"
+
+PayloadCache::PayloadCache(size_t capacity, uint32_t ttl_ms)
+    : ttl_ms_(ttl_ms), entries_(capacity) {
+    size_t keys = capacity * (1 + PAYLOAD_CACHE_GRIDS);
+    size_t n = 1;
+    while (n < 2 * keys) {
+        n <<= 1;
+    }
+    slots_.resize(n);
+    free_.reserve(capacity);
+    clear();
+}
+
+void PayloadCache::clear() {
+    for (Slot &s : slots_) {
+        s.entry = -1;
+    }
+    free_.clear();
+    for (int i = (int)entries_.size() - 1; i >= 0; i--) {
+        free_.push_back((int16_t)i);
+    }
+    size_ = 0;
+    head_ = tail_ = -1;
+}
+
+uint32_t PayloadCache::payloadHash(const uint8_t *payload, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ payload[i]) * 16777619u;
+    }
+    return h;
+}
+
+uint32_t PayloadCache::gridSignature(const struct quirc_code &code) {
+    uint32_t h = (2166136261u ^ (uint32_t)code.size) * 16777619u;
+    size_t len = ((size_t)code.size * code.size + 7) / 8;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ code.cell_bitmap[i]) * 16777619u;
+    }
+    return h;
+}
+
+static size_t slotOf(uint64_t key, size_t mask) {
+    // fold and mix so the namespace bit spreads over the index
+    uint64_t h = key * 0x9e3779b97f4a7c15ull;
+    return (size_t)(h >> 32) & mask;
+}
+
+int PayloadCache::find(uint64_t key) const {
+    size_t mask = slots_.size() - 1;
+    for (size_t i = slotOf(key, mask);; i = (i + 1) & mask) {
+        const Slot &s = slots_[i];
+        if (s.entry < 0) {
+            return -1;
+        }
+        if (s.key == key) {
+            return (int)i;
+        }
+    }
+}
+
+void PayloadCache::put(uint64_t key, int entry) {
+    size_t mask = slots_.size() - 1;
+    size_t i = slotOf(key, mask);
+    while (slots_[i].entry >= 0 && slots_[i].key != key) {
+        i = (i + 1) & mask;
+    }
+    slots_[i].key = key;
+    slots_[i].entry = (int16_t)entry;
+}
+
+// remove key if it still points at entry; backward-shift deletion keeps
+// probe chains intact without tombstones
+void PayloadCache::erase(uint64_t key, int entry) {
+    int found = find(key);
+    if (found < 0 || slots_[found].entry != entry) {
+        return;
+    }
+    size_t mask = slots_.size() - 1;
+    size_t hole = (size_t)found;
+    for (size_t i = (hole + 1) & mask; slots_[i].entry >= 0; i = (i + 1) & mask) {
+        size_t home = slotOf(slots_[i].key, mask);
+        // move i into the hole unless its home lies cyclically in (hole, i]
+        if (((i - home) & mask) >= ((i - hole) & mask)) {
+            slots_[hole] = slots_[i];
+            hole = i;
+        }
+    }
+    slots_[hole].entry = -1;
+}
+
+void PayloadCache::unlink(int entry) {
+    Entry &e = entries_[entry];
+    if (e.prev >= 0) {
+        entries_[e.prev].next = e.next;
+    } else {
+        head_ = e.next;
+    }
+    if (e.next >= 0) {
+        entries_[e.next].prev = e.prev;
+    } else {
+        tail_ = e.prev;
+    }
+}
+
+void PayloadCache::touch(int entry, uint32_t now_ms) {
+    Entry &e = entries_[entry];
+    e.last_ms = now_ms;
+    if (head_ == entry) {
+        return;
+    }
+    unlink(entry);
+    e.prev = -1;
+    e.next = (int16_t)head_;
+    if (head_ >= 0) {
+        entries_[head_].prev = (int16_t)entry;
+    }
+    head_ = entry;
+    if (tail_ < 0) {
+        tail_ = entry;
+    }
+}
+
+void PayloadCache::remove(int entry) {
+    Entry &e = entries_[entry];
+    erase(payloadKey(e.payload), entry);
+    for (int i = 0; i < e.num_grids; i++) {
+        erase(gridKey(e.grids[i]), entry);
+    }
+    unlink(entry);
+    free_.push_back((int16_t)entry);
+    size_--;
+}
+
+bool PayloadCache::fresh(int entry, uint32_t now_ms) {
+    if (now_ms - entries_[entry].last_ms < ttl_ms_) {
+        return true;
+    }
+    remove(entry);
+    return false;
+}
+
+void PayloadCache::addGrid(int entry, uint32_t grid_sig) {
+    Entry &e = entries_[entry];
+    for (int i = 0; i < e.num_grids; i++) {
+        if (e.grids[i] == grid_sig) {
+            put(gridKey(grid_sig), entry); // may have moved to another entry
+            return;
+        }
+    }
+    if (e.num_grids == PAYLOAD_CACHE_GRIDS) {
+        erase(gridKey(e.grids[e.next_grid]), entry);
+    } else {
+        e.num_grids++;
+    }
+    e.grids[e.next_grid] = grid_sig;
+    e.next_grid = (uint8_t)((e.next_grid + 1) % PAYLOAD_CACHE_GRIDS);
+    put(gridKey(grid_sig), entry);
+}
+
+bool PayloadCache::lookupGrid(uint32_t grid_sig, uint32_t now_ms) {
+    int slot = find(gridKey(grid_sig));
+    if (slot < 0) {
+        return false;
+    }
+    int entry = slots_[slot].entry;
+    if (!fresh(entry, now_ms)) {
+        return false;
+    }
+    touch(entry, now_ms);
+    return true;
+}
+
+bool PayloadCache::insert(uint32_t payload_hash, uint32_t grid_sig,
+                          uint32_t now_ms) {
+    int slot = find(payloadKey(payload_hash));
+    if (slot >= 0) {
+        int entry = slots_[slot].entry;
+        if (fresh(entry, now_ms)) {
+            addGrid(entry, grid_sig);
+            touch(entry, now_ms);
+            return true;
+        }
+    }
+    if (entries_.empty()) {
+        return false;
+    }
+    if (free_.empty()) {
+        remove(tail_);
+    }
+    int entry = free_.back();
+    free_.pop_back();
+    Entry &e = entries_[entry];
+    e.payload = payload_hash;
+    e.num_grids = 0;
+    e.next_grid = 0;
+    e.prev = e.next = -1;
+    if (tail_ < 0) {
+        head_ = tail_ = entry;
+    } else {
+        // link at the tail so touch() moves it to the front
+        e.prev = (int16_t)tail_;
+        entries_[tail_].next = (int16_t)entry;
+        tail_ = entry;
+    }
+    size_++;
+    put(payloadKey(payload_hash), entry);
+    addGrid(entry, grid_sig);
+    touch(entry, now_ms);
+    return false;
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <quirc.h>
+#include <vector>
+
+// Grid signatures remembered per payload: sampling noise can flip a few
+// modules, so a code held in view produces a handful of distinct grids.
+#define PAYLOAD_CACHE_GRIDS 4
+
+// Recently decoded codes, so a code held in front of the camera is
+// reported once. Entries are found by payload hash or by the signature of
+// a sampled grid; a grid seen before skips quirc_decode() altogether.
+// Every sighting refreshes an entry, it expires ttl_ms after the code was
+// last seen, and the least recently seen entry makes room for a new one.
+// Lookups are O(1) through a fixed open-addressing index; nothing is
+// allocated after construction. Not thread safe.
+class PayloadCache {
+  public:
+    explicit PayloadCache(size_t capacity = 8, uint32_t ttl_ms = 3000);
+
+    // A fresh entry has this grid: refresh it and return true.
+    bool lookupGrid(uint32_t grid_sig, uint32_t now_ms);
+
+    // Record a decoded payload and the grid it came from. Returns true if
+    // the payload was already cached, i.e. this is a repeat.
+    bool insert(uint32_t payload_hash, uint32_t grid_sig, uint32_t now_ms);
+
+    void clear();
+
+    size_t size() const {
+        return size_;
+    }
+
+    // FNV-1a over the payload bytes.
+    static uint32_t payloadHash(const uint8_t *payload, size_t len);
+    // FNV-1a over the grid size and sampled modules.
+    static uint32_t gridSignature(const struct quirc_code &code);
+
+  private:
+    struct Entry {
+        uint32_t payload;
+        uint32_t grids[PAYLOAD_CACHE_GRIDS];
+        uint8_t num_grids;
+        uint8_t next_grid;
+        uint32_t last_ms;
+        int16_t prev; // LRU list, most recent at head_
+        int16_t next;
+    };
+    struct Slot {
+        uint64_t key;
+        int16_t entry; // -1 if empty
+    };
+
+    static uint64_t payloadKey(uint32_t hash) {
+        return hash;
+    }
+    static uint64_t gridKey(uint32_t sig) {
+        return (1ull << 32) | sig;
+    }
+
+    int find(uint64_t key) const;
+    void put(uint64_t key, int entry);
+    void erase(uint64_t key, int entry);
+    void addGrid(int entry, uint32_t grid_sig);
+    bool fresh(int entry, uint32_t now_ms);
+    void touch(int entry, uint32_t now_ms);
+    void unlink(int entry);
+    void remove(int entry);
+
+    uint32_t ttl_ms_;
+    std::vector<Entry> entries_;
+    std::vector<Slot> slots_; // power of two, at most half full
+    std::vector<int16_t> free_;
+    size_t size_ = 0;
+    int head_ = -1;
+    int tail_ = -1;
+};
@@ -0,0 +1,104 @@
+#include "payload_router.h"
+
+struct SchemePrefix {
+    const char *prefix; // upper case
+    size_t len;
+    PayloadScheme scheme;
+};
+
+#define PREFIX(s, scheme) {s, sizeof(s) - 1, scheme}
+
+// Add schemes here; the index below is rebuilt at compile time.
+static constexpr SchemePrefix scheme_prefixes[] = {
+    PREFIX("WIFI:", SCHEME_WIFI),
+    PREFIX("HTTP://", SCHEME_URL),
+    PREFIX("HTTPS://", SCHEME_URL),
+    PREFIX("URLTO:", SCHEME_URL),
+    PREFIX("MECARD:", SCHEME_MECARD),
+    PREFIX("DPP:", SCHEME_DPP),
+};
+#define NUM_SCHEME_PREFIXES (sizeof(scheme_prefixes) / sizeof(scheme_prefixes[0]))
+#define PREFIXES_PER_LETTER 2
+
+static constexpr char upper(char c) {
+    return c >= 'a' && c <= 'z' ? (char)(c - 'a' + 'A') : c;
+}
+
+// prefixes by first letter, -1 for unused slots
+struct PrefixIndex {
+    int8_t slots[26][PREFIXES_PER_LETTER];
+    bool valid;
+};
+
+static constexpr PrefixIndex buildIndex() {
+    PrefixIndex index = {};
+    index.valid = true;
+    for (auto &letter : index.slots) {
+        for (auto &slot : letter) {
+            slot = -1;
+        }
+    }
+    for (size_t i = 0; i < NUM_SCHEME_PREFIXES; i++) {
+        int letter = scheme_prefixes[i].prefix[0] - 'A';
+        if (letter < 0 || letter >= 26) {
+            index.valid = false;
+            continue;
+        }
+        int s = 0;
+        while (s < PREFIXES_PER_LETTER && index.slots[letter][s] >= 0) {
+            s++;
+        }
+        if (s == PREFIXES_PER_LETTER) {
+            index.valid = false;
+            continue;
+        }
+        index.slots[letter][s] = (int8_t)i;
+    }
+    return index;
+}
+
+static constexpr PrefixIndex prefix_index = buildIndex();
+static_assert(prefix_index.valid,
+              "scheme prefixes must start with A-Z, at most PREFIXES_PER_LETTER per letter");
+
+PayloadMatch matchScheme(const char *payload, size_t len) {
+    PayloadMatch match = {SCHEME_TEXT, {payload, len}, 0};
+    if (len == 0) {
+        return match;
+    }
+    int letter = upper(payload[0]) - 'A';
+    if (letter < 0 || letter >= 26) {
+        return match;
+    }
+    for (int8_t i : prefix_index.slots[letter]) {
+        if (i < 0) {
+            break;
+        }
+        const SchemePrefix &p = scheme_prefixes[i];
+        if (len < p.len) {
+            continue;
+        }
+        size_t n = 1;
+        while (n < p.len && upper(payload[n]) == p.prefix[n]) {
+            n++;
+        }
+        if (n == p.len) {
+            match.scheme = p.scheme;
+            match.prefix_len = p.len;
+            break;
+        }
+    }
+    return match;
+}
+
+PayloadScheme PayloadRouter::dispatch(const char *payload, size_t len) const {
+    PayloadMatch match = matchScheme(payload, len);
+    if (!handlers_[match.scheme]) {
+        match.scheme = SCHEME_TEXT;
+        match.prefix_len = 0;
+    }
+    if (handlers_[match.scheme]) {
+        handlers_[match.scheme](match);
+    }
+    return match.scheme;
+}
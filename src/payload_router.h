@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// A decoded payload, not owned; points into quirc_data::payload.
+struct PayloadView {
+    const char *data;
+    size_t len;
+};
+
+enum PayloadScheme : uint8_t {
+    SCHEME_TEXT, // anything without a known prefix
+    SCHEME_WIFI, // WIFI:T:WPA;S:..;P:..;;
+    SCHEME_URL,  // http://, https://, URLTO:
+    SCHEME_MECARD,
+    SCHEME_DPP,  // Wi-Fi Easy Connect bootstrapping URI
+    NUM_PAYLOAD_SCHEMES
+};
+
+struct PayloadMatch {
+    PayloadScheme scheme;
+    PayloadView payload;
+    size_t prefix_len; // bytes of the scheme prefix at the start of payload
+
+    // The payload after the scheme prefix.
+    PayloadView body() const {
+        return {payload.data + prefix_len, payload.len - prefix_len};
+    }
+};
+
+// Classify a payload by its prefix (ASCII case-insensitive). The prefix
+// table is indexed by first letter at compile time, so a payload costs
+// one table lookup and at most a couple of prefix compares however many
+// schemes there are.
+PayloadMatch matchScheme(const char *payload, size_t len);
+
+// Hands each payload to the handler registered for its scheme, or to the
+// SCHEME_TEXT handler if its scheme has none.
+class PayloadRouter {
+  public:
+    using Handler = std::function<void(const PayloadMatch &)>;
+
+    void on(PayloadScheme scheme, Handler handler) {
+        handlers_[scheme] = std::move(handler);
+    }
+
+    // Returns the scheme that handled the payload.
+    PayloadScheme dispatch(const char *payload, size_t len) const;
+
+  private:
+    Handler handlers_[NUM_PAYLOAD_SCHEMES];
+};
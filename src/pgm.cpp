@@ -0,0 +1,55 @@
+#include "pgm.h"
+
+#include <cctype>
+#include <cstdio>
+
+// next header integer, skipping whitespace and # comments
+static int readHeaderInt(FILE *f) {
+    int c = fgetc(f);
+    while (c != EOF && (isspace(c) || c == '#')) {
+        if (c == '#') {
+            while (c != EOF && c != '\n') {
+                c = fgetc(f);
+            }
+        }
+        c = fgetc(f);
+    }
+    int v = -1;
+    while (c != EOF && isdigit(c)) {
+        v = (v < 0 ? 0 : v * 10) + (c - '0');
+        c = fgetc(f);
+    }
+    // c is the single whitespace byte ending the field
+    return v;
+}
+
+bool readPgm(const char *path, std::vector<uint8_t> &pixels, int &width,
+             int &height) {
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        return false;
+    }
+    bool ok = false;
+    if (fgetc(f) == 'P' && fgetc(f) == '5') {
+        width = readHeaderInt(f);
+        height = readHeaderInt(f);
+        int maxval = readHeaderInt(f);
+        if (width > 0 && height > 0 && maxval > 0 && maxval < 256) {
+            pixels.resize((size_t)width * height);
+            ok = fread(pixels.data(), 1, pixels.size(), f) == pixels.size();
+        }
+    }
+    fclose(f);
+    return ok;
+}
+
+bool writePgm(const char *path, const uint8_t *pixels, int width, int height) {
+    FILE *f = fopen(path, "wb");
+    if (!f) {
+        return false;
+    }
+    fprintf(f, "P5\n%d %d\n255\n", width, height);
+    size_t n = (size_t)width * height;
+    bool ok = fwrite(pixels, 1, n, f) == n;
+    return fclose(f) == 0 && ok;
+}
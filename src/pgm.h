@@ -0,0 +1,10 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Binary (P5) 8-bit PGM files, the on-disk format for recorded and
+// replayed grayscale frames.
+bool readPgm(const char *path, std::vector<uint8_t> &pixels, int &width,
+             int &height);
+bool writePgm(const char *path, const uint8_t *pixels, int width, int height);
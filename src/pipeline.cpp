@@ -0,0 +1,118 @@
+#include "pipeline.h"
+
+#ifdef ESP_PLATFORM
+#include "esp_pthread.h"
+#include "esp_timer.h"
+#else
+#include <chrono>
+#endif
+
+int64_t monotonicUs() {
+#ifdef ESP_PLATFORM
+    return esp_timer_get_time();
+#else
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+               std::chrono::steady_clock::now().time_since_epoch()).count();
+#endif
+}
+
+std::thread startPinnedThread(const char *name, int core, size_t stack_size,
+                              int prio, std::function<void()> fn) {
+#ifdef ESP_PLATFORM
+    esp_pthread_cfg_t cfg = esp_pthread_get_default_config();
+    cfg.thread_name = name;
+    cfg.pin_to_core = core;
+    cfg.stack_size = stack_size;
+    cfg.prio = prio;
+    esp_pthread_set_cfg(&cfg);
+    std::thread t(std::move(fn));
+    // don't leak the settings into unrelated threads created later
+    cfg = esp_pthread_get_default_config();
+    esp_pthread_set_cfg(&cfg);
+    return t;
+#else
+    (void)name;
+    (void)core;
+    (void)stack_size;
+    (void)prio;
+    return std::thread(std::move(fn));
+#endif
+}
+
+Pipeline::Pipeline(const PipelineConfig &cfg)
+    : cfg_(cfg), queue_(cfg.queue_depth) {}
+
+Pipeline::~Pipeline() {
+    stop();
+}
+
+bool Pipeline::start() {
+    if (running_ || !cfg_.capture || !cfg_.decode || !cfg_.release) {
+        return false;
+    }
+    running_ = true;
+    decode_thread_ = startPinnedThread("qr_decode", cfg_.decode_core,
+                                       cfg_.decode_stack, cfg_.decode_prio,
+                                       [this] { decodeLoop(); });
+    capture_thread_ = startPinnedThread("qr_capture", cfg_.capture_core,
+                                        cfg_.capture_stack, cfg_.capture_prio,
+                                        [this] { captureLoop(); });
+    return true;
+}
+
+void Pipeline::stop() {
+    if (!running_) {
+        return;
+    }
+    running_ = false;
+    queue_.close();
+    if (capture_thread_.joinable()) {
+        capture_thread_.join();
+    }
+    if (decode_thread_.joinable()) {
+        decode_thread_.join();
+    }
+}
+
+PipelineStats Pipeline::stats() const {
+    return PipelineStats{captured_.load(), dropped_.load(), decoded_.load()};
+}
+
+void Pipeline::release(Frame &frame) {
+    if (frame.held) {
+        frame.held = false;
+        cfg_.release(frame);
+    }
+}
+
+void Pipeline::captureLoop() {
+    Frame frame, evicted;
+    while (running_) {
+        if (!cfg_.capture(frame)) {
+            continue;
+        }
+        frame.held = true;
+        captured_++;
+        if (queue_.push(frame, &evicted)) {
+            dropped_++;
+            release(evicted);
+        }
+    }
+}
+
+void Pipeline::decodeLoop() {
+    Frame frame;
+    while (running_) {
+        if (!queue_.pop(frame, 100)) {
+            continue;
+        }
+        cfg_.decode(frame);
+        release(frame);
+        decoded_++;
+    }
+    // hand back whatever was still queued when we were stopped
+    while (queue_.pop(frame, 0)) {
+        dropped_++;
+        release(frame);
+    }
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+#include "bounded_queue.h"
+
+// One captured grayscale frame on its way from the capture task to the
+// decode task. handle belongs to the producer (camera_fb_t on the device)
+// and is only interpreted by PipelineConfig::release. held is true until
+// the frame has been handed back, buf must not be touched after that.
+struct Frame {
+    uint8_t *buf = nullptr;
+    size_t len = 0;
+    int width = 0;
+    int height = 0;
+    int64_t timestamp_us = 0;
+    void *handle = nullptr;
+    bool held = false;
+};
+
+struct PipelineStats {
+    uint32_t captured;  // frames handed in by the capture callback
+    uint32_t dropped;   // evicted from the queue before being decoded
+    uint32_t decoded;   // frames that went through the decode callback
+};
+
+struct PipelineConfig {
+    size_t queue_depth = 1;
+    int capture_core = 0;
+    int decode_core = 1;
+    int capture_prio = 2;
+    int decode_prio = 1;
+    size_t capture_stack = 4096;
+    size_t decode_stack = 16384;
+
+    // Blocks until a frame is available. Returning false just retries,
+    // so it may also be used to idle while scanning is paused.
+    std::function<bool(Frame &)> capture;
+    // May call Pipeline::release() as soon as it no longer needs the
+    // pixels, otherwise the frame is released when it returns.
+    std::function<void(Frame &)> decode;
+    // Hands a frame back to its producer, at most once per frame.
+    std::function<void(Frame &)> release;
+};
+
+// Capture and decode on two tasks, pinned to different cores on the
+// ESP32-S3 and plain std::threads on the host. Frames travel through a
+// bounded queue which drops the oldest frame when decoding falls behind,
+// so the decoder always works on the most recent image.
+class Pipeline {
+  public:
+    explicit Pipeline(const PipelineConfig &cfg);
+    ~Pipeline();
+
+    bool start();
+    void stop();
+    bool running() const {
+        return running_;
+    }
+    PipelineStats stats() const;
+
+    // Give a frame back to its producer before decode() returns, e.g. once
+    // its pixels have been copied. Safe to call more than once.
+    void release(Frame &frame);
+
+  private:
+    void captureLoop();
+    void decodeLoop();
+
+    PipelineConfig cfg_;
+    BoundedQueue<Frame> queue_;
+    std::atomic<bool> running_{false};
+    std::atomic<uint32_t> captured_{0};
+    std::atomic<uint32_t> dropped_{0};
+    std::atomic<uint32_t> decoded_{0};
+    std::thread capture_thread_;
+    std::thread decode_thread_;
+};
+
+// std::thread pinned to a core with the given stack and priority on the
+// ESP32 (via esp_pthread), an ordinary thread elsewhere.
+std::thread startPinnedThread(const char *name, int core, size_t stack_size,
+                              int prio, std::function<void()> fn);
+
+// Microseconds since boot on the ESP32 (esp_timer), since an arbitrary
+// epoch on the host; the clock Frame::timestamp_us is taken from.
+int64_t monotonicUs();
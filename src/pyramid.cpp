@@ -0,0 +1,40 @@
+#include "pyramid.h"
+
+static void downsample2(const uint8_t *src, int width, int height, int stride,
+                        uint8_t *dst) {
+    int dw = width / 2, dh = height / 2;
+    for (int y = 0; y < dh; y++) {
+        const uint8_t *r0 = src + (2 * y) * stride;
+        const uint8_t *r1 = r0 + stride;
+        for (int x = 0; x < dw; x++) {
+            *dst++ = (uint8_t)((r0[0] + r0[1] + r1[0] + r1[1] + 2) >> 2);
+            r0 += 2;
+            r1 += 2;
+        }
+    }
+}
+
+static void downsample4(const uint8_t *src, int width, int height, int stride,
+                        uint8_t *dst) {
+    int dw = width / 4, dh = height / 4;
+    for (int y = 0; y < dh; y++) {
+        const uint8_t *row = src + (4 * y) * stride;
+        for (int x = 0; x < dw; x++) {
+            const uint8_t *p = row + 4 * x;
+            unsigned sum = 0;
+            for (int i = 0; i < 4; i++, p += stride) {
+                sum += p[0] + p[1] + p[2] + p[3];
+            }
+            *dst++ = (uint8_t)((sum + 8) >> 4);
+        }
+    }
+}
+
+void downsample(const uint8_t *src, int width, int height, int stride,
+                int factor, uint8_t *dst) {
+    if (factor == 4) {
+        downsample4(src, width, height, stride, dst);
+    } else {
+        downsample2(src, width, height, stride, dst);
+    }
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <cstdint>
+
+// Box-filter a width x height image with the given row stride down by
+// factor (2 or 4) into dst, which is (width / factor) x (height / factor).
+void downsample(const uint8_t *src, int width, int height, int stride,
+                int factor, uint8_t *dst);
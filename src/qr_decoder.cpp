@@ -0,0 +1,115 @@
+#include "qr_decoder.h"
+
+#include <cstring>
+// struct quirc is opaque in quirc.h; zero-copy swaps its image pointer
+#include <quirc_internal.h>
+
+QrDecoder::QrDecoder(bool zero_copy) : zero_copy_(zero_copy) {}
+
+QrDecoder::~QrDecoder() {
+    release();
+    if (qr_) {
+        quirc_destroy(qr_);
+    }
+}
+
+bool QrDecoder::ensureSize(int width, int height) {
+    if (!qr_) {
+        qr_ = quirc_new();
+        if (!qr_) {
+            return false;
+        }
+    }
+    if (width == width_ && height == height_) {
+        return true;
+    }
+    // quirc_resize() copies from and frees the current image
+    release();
+    if (quirc_resize(qr_, width, height) < 0) {
+        width_ = height_ = 0;
+        return false;
+    }
+    width_ = width;
+    height_ = height;
+    return true;
+}
+
+bool QrDecoder::load(uint8_t *image, size_t len, int width, int height) {
+    release();
+    if (len < (size_t)width * height || !ensureSize(width, height)) {
+        return false;
+    }
+    uint8_t *buf = quirc_begin(qr_, nullptr, nullptr);
+    if (!buf) {
+        return false;
+    }
+    if (zero_copy_) {
+        // quirc_end() thresholds into image and, when QUIRC_PIXEL_ALIAS_IMAGE
+        // is set, labels in the same buffer; quirc_extract() reads it later
+        own_image_ = qr_->image;
+        qr_->image = image;
+    } else {
+        memcpy(buf, image, (size_t)width * height);
+    }
+    return true;
+}
+
+uint8_t *QrDecoder::begin(int width, int height) {
+    release();
+    if (!ensureSize(width, height)) {
+        return nullptr;
+    }
+    return quirc_begin(qr_, nullptr, nullptr);
+}
+
+bool QrDecoder::loadWindow(const uint8_t *image, int stride, int x, int y,
+                           int width, int height) {
+    uint8_t *buf = begin(width, height);
+    if (!buf) {
+        return false;
+    }
+    const uint8_t *src = image + (size_t)y * stride + x;
+    for (int row = 0; row < height; row++) {
+        memcpy(buf, src, width);
+        buf += width;
+        src += stride;
+    }
+    return true;
+}
+
+int QrDecoder::detect() {
+    quirc_end(qr_);
+    return quirc_count(qr_);
+}
+
+int QrDecoder::detect(uint8_t *image, size_t len, int width, int height) {
+    if (!load(image, len, width, height)) {
+        return 0;
+    }
+    return detect();
+}
+
+int QrDecoder::capstones() const {
+    return qr_ ? qr_->num_capstones : 0;
+}
+
+void QrDecoder::extract(int index, struct quirc_code *code) const {
+    quirc_extract(qr_, index, code);
+}
+
+quirc_decode_error_t QrDecoder::decode(struct quirc_code *code,
+                                       struct quirc_data *data) {
+    quirc_decode_error_t err = quirc_decode(code, data);
+    if (err == QUIRC_ERROR_DATA_ECC) {
+        quirc_flip(code);
+        err = quirc_decode(code, data);
+    }
+    return err;
+}
+
+void QrDecoder::release() {
+    if (own_image_) {
+        qr_->image = own_image_;
+        own_image_ = nullptr;
+    }
+}
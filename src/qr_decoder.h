@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <quirc.h>
+
+// Zero-copy mode: quirc binarizes and labels directly in the frame buffer
+// handed to detect() instead of in its own copy. The buffer is clobbered.
+#ifndef QR_ZERO_COPY
+#define QR_ZERO_COPY 0
+#endif
+
+// Owns the quirc instance used by the decode task and follows the frame
+// dimensions. Not thread safe, use one instance per task.
+class QrDecoder {
+  public:
+    explicit QrDecoder(bool zero_copy = QR_ZERO_COPY);
+    ~QrDecoder();
+
+    // Hand a width x height grayscale image to quirc. In copy mode the
+    // pixels are copied and image may be reused as soon as this returns;
+    // in zero-copy mode it is used in place and must stay valid until
+    // release() is called.
+    bool load(uint8_t *image, size_t len, int width, int height);
+
+    // quirc's own width x height image buffer, for stages that render
+    // straight into it. Follow with detect().
+    uint8_t *begin(int width, int height);
+
+    // Copy a width x height window at (x, y) out of an image with the
+    // given row stride. Always copies, whatever the zero-copy mode.
+    bool loadWindow(const uint8_t *image, int stride, int x, int y,
+                    int width, int height);
+
+    // Binarize the loaded image and locate codes, returns the code count.
+    int detect();
+
+    // load() followed by detect().
+    int detect(uint8_t *image, size_t len, int width, int height);
+
+    // Finder patterns seen by the last detect(), whether or not they
+    // could be grouped into a code.
+    int capstones() const;
+
+    // Sample the grid of code #index of the last detect(). After this the
+    // code no longer refers to the image.
+    void extract(int index, struct quirc_code *code) const;
+
+    // Decode an extracted grid, retrying mirrored on ECC failure.
+    static quirc_decode_error_t decode(struct quirc_code *code,
+                                       struct quirc_data *data);
+
+    // Detach an image bound by load() so it can be handed back to its
+    // producer. No-op in copy mode.
+    void release();
+
+    bool zeroCopy() const {
+        return zero_copy_;
+    }
+
+  private:
+    bool ensureSize(int width, int height);
+
+    bool zero_copy_;
+    struct quirc *qr_ = nullptr;
+    int width_ = 0;
+    int height_ = 0;
+    uint8_t *own_image_ = nullptr; // quirc's buffer while a frame is bound
+};
@@ -0,0 +1,141 @@
+#include "qr_scanner.h"
+
+#include "pyramid.h"
+#include "stage_timer.h"
+
+QrScanner::QrScanner(int pyramid_factor)
+    : pyramid_factor_(pyramid_factor), local_threshold_(QR_LOCAL_THRESHOLD),
+      frame_gate_(QR_SHARPNESS_RATIO), window_gate_(QR_SHARPNESS_RATIO), coarse_(false),
+      windowed_(false),
+      tracker_(QR_ROI_MAX_MISSES) {}
+
+// Run quirc's region labelling and finder pattern search on the decimated
+// frame. Frames without a single finder pattern can't contain a code.
+bool QrScanner::coarseReject(const uint8_t *image, int width, int height) {
+    ScopedStage timer(STAGE_COARSE);
+    int f = pyramid_factor_;
+    uint8_t *buf = coarse_.begin(width / f, height / f);
+    if (!buf) {
+        return false;
+    }
+    downsample(image, width, height, width, f, buf);
+    coarse_.detect();
+    return coarse_.capstones() == 0;
+}
+
+// Get the search window into the decoder: thresholded into quirc's
+// buffer by the local threshold stage, copied, or bound in place (zero
+// copy, full frames only). bound tells the caller the image is still in
+// use.
+bool QrScanner::load(QrDecoder &decoder, uint8_t *image, size_t len,
+                     int width, int height, bool &bound) {
+    ScopedStage timer(STAGE_LOAD);
+    if (local_threshold_) {
+        uint8_t *buf = decoder.begin(window_.width, window_.height);
+        return buf && threshold_.apply(image + (size_t)window_.y * width + window_.x,
+                                       window_.width, window_.height, width, buf);
+    }
+    if (window_.width < width || window_.height < height) {
+        return decoder.loadWindow(image, width, window_.x, window_.y,
+                                  window_.width, window_.height);
+    }
+    bound = decoder.zeroCopy();
+    return decoder.load(image, len, width, height);
+}
+
+int QrScanner::scan(uint8_t *image, size_t len, int width, int height,
+                    struct quirc_code *codes, int max_codes,
+                    const std::function<void()> &pixels_taken) {
+    stats_.frames++;
+    capstones_ = 0;
+    if (width != width_ || height != height_) {
+        // camera resolution changed, old positions are meaningless
+        tracker_.reset();
+        width_ = width;
+        height_ = height;
+    }
+    window_ = tracker_.predict(width, height);
+    bool windowed = window_.width < width || window_.height < height;
+    if (windowed && !was_windowed_) {
+        window_gate_.reset(); // a new track, the last one's code may have been sharper
+    }
+    was_windowed_ = windowed;
+    if (len < (size_t)width * height) {
+        pixels_taken();
+        return 0;
+    }
+
+    // measured where the code is expected, the rest of the frame may
+    // well be out of focus
+    {
+        ScopedStage timer(STAGE_SHARPNESS);
+        sharpness_ = sharpness(image + (size_t)window_.y * width + window_.x,
+                               window_.width, window_.height, width,
+                               QR_SHARPNESS_STEP);
+    }
+    SharpnessGate &gate = windowed ? window_gate_ : frame_gate_;
+    if (QR_SHARPNESS_RATIO > 0 && !gate.pass(sharpness_)) {
+        stats_.blur_rejects++;
+        tracker_.miss(); // no code seen here either
+        pixels_taken();
+        return 0;
+    }
+
+    if (windowed) {
+        stats_.windowed++;
+    } else if (coarse_reject_ && pyramid_factor_ > 1 && coarseReject(image, width, height)) {
+        stats_.coarse_rejects++;
+        pixels_taken();
+        return 0;
+    }
+
+    QrDecoder &decoder = windowed ? windowed_ : full_;
+    bool bound = false;
+    if (!load(decoder, image, len, width, height, bound)) {
+        pixels_taken();
+        return 0;
+    }
+    if (!bound) {
+        pixels_taken();
+    }
+    int num_codes;
+    {
+        ScopedStage timer(STAGE_DETECT);
+        num_codes = decoder.detect();
+    }
+    capstones_ = decoder.capstones();
+    if (num_codes > max_codes) {
+        num_codes = max_codes;
+    }
+    // quirc_extract() only reads the decoder, grids may be sampled in
+    // parallel
+    auto extract = [&](int i, int) {
+        decoder.extract(i, &codes[i]);
+        for (int c = 0; c < 4; c++) {
+            codes[i].corners[c].x += window_.x;
+            codes[i].corners[c].y += window_.y;
+        }
+    };
+    if (num_codes) {
+        ScopedStage timer(STAGE_EXTRACT);
+        if (pool_) {
+            pool_->run(num_codes, extract);
+        } else {
+            for (int i = 0; i < num_codes; i++) {
+                extract(i, 0);
+            }
+        }
+    }
+    if (bound) {
+        // grids are sampled, the image isn't needed for decoding
+        decoder.release();
+        pixels_taken();
+    }
+
+    if (num_codes) {
+        tracker_.hit(codes[0].corners);
+    } else {
+        tracker_.miss();
+    }
+    return num_codes;
+}
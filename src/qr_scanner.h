@@ -0,0 +1,130 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <quirc.h>
+
+#include "local_threshold.h"
+#include "qr_decoder.h"
+#include "roi_tracker.h"
+#include "sharpness.h"
+#include "worker_pool.h"
+
+#ifndef QR_ROI_MAX_MISSES
+#define QR_ROI_MAX_MISSES 3
+#endif
+
+// Decimation of the coarse detection level, 2 or 4; 0 disables it.
+#ifndef QR_PYRAMID_FACTOR
+#define QR_PYRAMID_FACTOR 2
+#endif
+
+// Frames whose focus measure is below this fraction of the recent
+// average are skipped; 0 disables the gate.
+#ifndef QR_SHARPNESS_RATIO
+#define QR_SHARPNESS_RATIO 0.6f
+#endif
+#define QR_SHARPNESS_STEP 4
+
+// Feed quirc a bilevel image from the local (Sauvola) threshold stage
+// instead of the raw frame. Helps with codes on phone screens.
+#ifndef QR_LOCAL_THRESHOLD
+#define QR_LOCAL_THRESHOLD 0
+#endif
+
+struct QrScannerStats {
+    uint32_t frames;
+    uint32_t blur_rejects;   // below the sharpness gate
+    uint32_t windowed;       // searched only around a tracked code
+    uint32_t coarse_rejects; // no finder pattern on the coarse level
+};
+
+// Per-frame detection front end of the decode task: locates codes in a
+// frame and samples their grids, leaving only quirc_decode() to the
+// caller. Frames much blurrier than the recent ones are skipped outright.
+// Full frames are then checked for finder patterns on a
+// decimated copy and only searched at full resolution if some are seen.
+// Once a code is found, following frames are searched only in a window
+// around it (see RoiTracker).
+class QrScanner {
+  public:
+    explicit QrScanner(int pyramid_factor = QR_PYRAMID_FACTOR);
+
+    // Locate up to max_codes codes and extract them into codes[], corners
+    // in frame coordinates. pixels_taken is invoked exactly once, as soon
+    // as image is no longer needed, which may be before scan() returns.
+    int scan(uint8_t *image, size_t len, int width, int height,
+             struct quirc_code *codes, int max_codes,
+             const std::function<void()> &pixels_taken);
+
+    // Focus measure of the last frame (see sharpness()).
+    uint32_t lastSharpness() const {
+        return sharpness_;
+    }
+
+    // Finder patterns seen in the last frame.
+    int lastCapstones() const {
+        return capstones_;
+    }
+
+    // Window searched in the last frame.
+    const Roi &lastWindow() const {
+        return window_;
+    }
+
+    // Whether the last frame was searched only around a tracked code.
+    bool lastWindowed() const {
+        return was_windowed_;
+    }
+
+    RoiTracker &tracker() {
+        return tracker_;
+    }
+
+    const QrScannerStats &stats() const {
+        return stats_;
+    }
+
+    void setLocalThreshold(bool enable) {
+        local_threshold_ = enable;
+    }
+
+    // Skip full frames without finder patterns on the decimated copy. A
+    // code whose modules vanish in the decimation is skipped as well, so
+    // this is only safe where no higher resolution could show it better.
+    void setCoarseReject(bool enable) {
+        coarse_reject_ = enable;
+    }
+
+    // Extract the grids of multi-code frames in parallel.
+    void setPool(WorkerPool *pool) {
+        pool_ = pool;
+    }
+
+  private:
+    bool coarseReject(const uint8_t *image, int width, int height);
+    bool load(QrDecoder &decoder, uint8_t *image, size_t len, int width,
+              int height, bool &bound);
+
+    int pyramid_factor_;
+    bool coarse_reject_ = true;
+    bool local_threshold_;
+    LocalThreshold threshold_;
+    QrScannerStats stats_ = {};
+    int capstones_ = 0;
+    uint32_t sharpness_ = 0;
+    // a window around a code measures much sharper than the full frame,
+    // so each keeps its own average
+    SharpnessGate frame_gate_;
+    SharpnessGate window_gate_;
+    bool was_windowed_ = false;
+    int width_ = 0;  // frame size the tracker's coordinates refer to
+    int height_ = 0;
+    QrDecoder coarse_;
+    QrDecoder full_;
+    QrDecoder windowed_;
+    RoiTracker tracker_;
+    Roi window_ = {0, 0, 0, 0};
+    WorkerPool *pool_ = nullptr;
+};
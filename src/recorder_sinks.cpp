@@ -0,0 +1,69 @@
+#include "recorder_sinks.h"
+
+#include <Arduino.h>
+#include <SD.h>
+#include <SPI.h>
+
+// CoreS3 microSD slot
+#define SD_SPI_CS_PIN 4
+#define SD_SPI_SCK_PIN 36
+#define SD_SPI_MISO_PIN 35
+#define SD_SPI_MOSI_PIN 37
+#define SD_SPI_FREQ 25000000
+#define SD_RECORD_DIR "/rec"
+#define SD_WRITE_CHUNK 4096
+
+bool SdFrameSink::open() {
+    std::lock_guard<std::mutex> lock(bus_);
+    if (!mounted_) {
+        SPI.begin(SD_SPI_SCK_PIN, SD_SPI_MISO_PIN, SD_SPI_MOSI_PIN, SD_SPI_CS_PIN);
+        mounted_ = SD.begin(SD_SPI_CS_PIN, SPI, SD_SPI_FREQ);
+        if (!mounted_) {
+            return false;
+        }
+        SD.mkdir(SD_RECORD_DIR);
+    }
+    for (int i = 1; i < 10000; i++) {
+        snprintf(path_, sizeof(path_), SD_RECORD_DIR "/%04d.qrr", i);
+        if (!SD.exists(path_)) {
+            file_ = SD.open(path_, FILE_WRITE);
+            return (bool)file_;
+        }
+    }
+    return false;
+}
+
+void SdFrameSink::close() {
+    std::lock_guard<std::mutex> lock(bus_);
+    if (file_) {
+        file_.close();
+    }
+}
+
+bool SdFrameSink::write(const uint8_t *data, size_t len) {
+    while (len) {
+        size_t n = len < SD_WRITE_CHUNK ? len : SD_WRITE_CHUNK;
+        std::lock_guard<std::mutex> lock(bus_);
+        if (!file_ || file_.write(data, n) != n) {
+            return false;
+        }
+        data += n;
+        len -= n;
+    }
+    return true;
+}
+
+void SdFrameSink::flush() {
+    std::lock_guard<std::mutex> lock(bus_);
+    if (file_) {
+        file_.flush();
+    }
+}
+
+bool SerialFrameSink::write(const uint8_t *data, size_t len) {
+    return Serial.write(data, len) == len;
+}
+
+void SerialFrameSink::flush() {
+    Serial.flush();
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <FS.h>
+#include <mutex>
+
+#include "frame_recorder.h"
+
+// Records to numbered files (/rec/0001.qrr, ...) on the microSD card. The
+// card shares its SPI bus with the display, so data goes out in chunks,
+// each under the display lock, and the preview is held up at most one
+// chunk at a time.
+class SdFrameSink : public FrameSink {
+  public:
+    explicit SdFrameSink(std::mutex &bus) : bus_(bus) {}
+
+    // Mounts the card if needed and opens the next free file.
+    bool open();
+    void close();
+    const char *path() const {
+        return path_;
+    }
+
+    bool write(const uint8_t *data, size_t len) override;
+    void flush() override;
+
+  private:
+    std::mutex &bus_;
+    bool mounted_ = false;
+    File file_;
+    char path_[32] = "";
+};
+
+// Streams records over the USB-CDC serial port. Log output may end up
+// between records; the unpacker skips it.
+class SerialFrameSink : public FrameSink {
+  public:
+    bool write(const uint8_t *data, size_t len) override;
+    void flush() override;
+};
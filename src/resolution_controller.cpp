@@ -0,0 +1,54 @@
+#include "resolution_controller.h"
+
+#include <cmath>
+
+#define UP_AFTER_FAILURES 4
+#define DOWN_AFTER_IDLE 60
+// quirc samples one pixel per module, below ~2.5 px that gets unreliable
+#define MIN_MODULE_PX 2.5f
+#define MAX_MODULE_PX 8.0f
+
+ResolutionController::ResolutionController(int num_levels)
+    : num_levels_(num_levels > 0 ? num_levels : 1) {}
+
+bool ResolutionController::update(const FrameOutcome &outcome) {
+    int prev = level_;
+
+    if (outcome.capstones == 0) {
+        failures_ = 0;
+        if (++idle_ >= DOWN_AFTER_IDLE && level_ > 0) {
+            level_--;
+            idle_ = 0;
+        }
+    } else if (outcome.decoded == 0) {
+        idle_ = 0;
+        bool too_small = outcome.codes > 0 && outcome.module_px > 0 &&
+                         outcome.module_px < MIN_MODULE_PX;
+        if ((too_small || ++failures_ >= UP_AFTER_FAILURES) &&
+                level_ < num_levels_ - 1) {
+            level_++;
+            failures_ = 0;
+        }
+    } else {
+        idle_ = 0;
+        failures_ = 0;
+        // a lower level still resolves this code comfortably
+        if (outcome.module_px > MAX_MODULE_PX && level_ > 0) {
+            level_--;
+        }
+    }
+    return level_ != prev;
+}
+
+float ResolutionController::modulePixels(const struct quirc_code &code) {
+    if (code.size <= 0) {
+        return 0;
+    }
+    float edges = 0;
+    for (int i = 0; i < 4; i++) {
+        const struct quirc_point &a = code.corners[i];
+        const struct quirc_point &b = code.corners[(i + 1) % 4];
+        edges += hypotf((float)(b.x - a.x), (float)(b.y - a.y));
+    }
+    return edges / 4 / code.size;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <quirc.h>
+
+// What the decode task saw in one frame.
+struct FrameOutcome {
+    int capstones;    // finder patterns found
+    int codes;        // grids sampled
+    int decoded;      // codes that decoded without error
+    float module_px;  // smallest module size of the sampled grids, 0 if none
+};
+
+// Picks the camera resolution from decode outcomes. Scanning starts at
+// level 0 (the cheapest); finder patterns that don't turn into decoded
+// codes, or modules too small to sample reliably, step the level up. Long
+// stretches with nothing in view, or modules much larger than needed,
+// step it back down.
+class ResolutionController {
+  public:
+    explicit ResolutionController(int num_levels);
+
+    int level() const {
+        return level_;
+    }
+
+    int levels() const {
+        return num_levels_;
+    }
+
+    // Feed the outcome of a frame taken at the current level. Returns
+    // true if the level changed.
+    bool update(const FrameOutcome &outcome);
+
+    // Module edge length in pixels of a sampled grid.
+    static float modulePixels(const struct quirc_code &code);
+
+  private:
+    int num_levels_;
+    int level_ = 0;
+    int failures_ = 0; // consecutive frames with capstones but no decode
+    int idle_ = 0;     // consecutive frames without any capstone
+};
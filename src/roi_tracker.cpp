@@ -0,0 +1,83 @@
+#include "roi_tracker.h"
+
+#include <algorithm>
+#include <cmath>
+
+#define ROI_ALIGN 32
+#define ROI_MIN_SIZE 96
+// a window this close to the full frame isn't worth the extra copy
+#define ROI_MAX_AREA_PCT 60
+
+RoiTracker::RoiTracker(int max_misses, float padding)
+    : max_misses_(max_misses), padding_(padding) {}
+
+static int alignUp(int v, int limit) {
+    v = (v + ROI_ALIGN - 1) / ROI_ALIGN * ROI_ALIGN;
+    return std::min(v, limit);
+}
+
+static int placeWindow(float center, int size, int limit) {
+    int start = (int)lroundf(center - size / 2.0f);
+    return std::max(0, std::min(start, limit - size));
+}
+
+Roi RoiTracker::predict(int width, int height) const {
+    Roi full = {0, 0, width, height};
+    if (!tracking_) {
+        return full;
+    }
+    // extrapolate across the frames we missed and widen the search
+    // window by the expected motion
+    float steps = (float)(misses_ + 1);
+    float cx = cx_ + vx_ * steps;
+    float cy = cy_ + vy_ * steps;
+    float grow = 1.0f + 2.0f * padding_ * steps;
+    int w = (int)(w_ * grow + fabsf(vx_) * 2.0f * steps);
+    int h = (int)(h_ * grow + fabsf(vy_) * 2.0f * steps);
+    w = alignUp(std::max(w, ROI_MIN_SIZE), width);
+    h = alignUp(std::max(h, ROI_MIN_SIZE), height);
+    if ((long)w * h * 100 > (long)width * height * ROI_MAX_AREA_PCT) {
+        return full;
+    }
+    Roi roi = {placeWindow(cx, w, width), placeWindow(cy, h, height), w, h};
+    return roi;
+}
+
+void RoiTracker::hit(const struct quirc_point corners[4]) {
+    int x0 = corners[0].x, x1 = corners[0].x;
+    int y0 = corners[0].y, y1 = corners[0].y;
+    for (int i = 1; i < 4; i++) {
+        x0 = std::min(x0, corners[i].x);
+        x1 = std::max(x1, corners[i].x);
+        y0 = std::min(y0, corners[i].y);
+        y1 = std::max(y1, corners[i].y);
+    }
+    float cx = (x0 + x1) / 2.0f;
+    float cy = (y0 + y1) / 2.0f;
+    if (tracking_) {
+        float steps = (float)(misses_ + 1);
+        vx_ = 0.5f * vx_ + 0.5f * (cx - cx_) / steps;
+        vy_ = 0.5f * vy_ + 0.5f * (cy - cy_) / steps;
+    } else {
+        vx_ = vy_ = 0;
+        track_++;
+    }
+    cx_ = cx;
+    cy_ = cy;
+    w_ = (float)(x1 - x0);
+    h_ = (float)(y1 - y0);
+    misses_ = 0;
+    tracking_ = true;
+}
+
+void RoiTracker::miss() {
+    if (tracking_ && ++misses_ > max_misses_) {
+        reset();
+    }
+}
+
+void RoiTracker::reset() {
+    tracking_ = false;
+    misses_ = 0;
+    vx_ = vy_ = 0;
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstdint>
+#include <quirc.h>
+
+// A rectangular window of a frame, in pixels.
+struct Roi {
+    int x;
+    int y;
+    int width;
+    int height;
+};
+
+// Follows a single code across frames. After a hit the next frame is
+// searched only in a padded window around the predicted position; after
+// max_misses consecutive misses tracking is dropped and predict() returns
+// the full frame again.
+class RoiTracker {
+  public:
+    explicit RoiTracker(int max_misses = 3, float padding = 0.5f);
+
+    // Window to search in the next width x height frame. Window sizes are
+    // multiples of 32 so the decoder following them resizes rarely.
+    Roi predict(int width, int height) const;
+
+    bool tracking() const {
+        return tracking_;
+    }
+
+    // Number of tracks started so far; changes when a hit starts
+    // following a code anew.
+    uint32_t track() const {
+        return track_;
+    }
+
+    // The code was found again, corners in frame coordinates.
+    void hit(const struct quirc_point corners[4]);
+    void miss();
+    void reset();
+
+  private:
+    int max_misses_;
+    float padding_;
+    bool tracking_ = false;
+    uint32_t track_ = 0;
+    int misses_ = 0;
+    float cx_ = 0, cy_ = 0;   // last bounding box center
+    float w_ = 0, h_ = 0;     // last bounding box size
+    float vx_ = 0, vy_ = 0;   // smoothed motion per frame
+};
@@ -0,0 +1,61 @@
+#include "scan_table.h"
+
+#include <cstring>
+
+ScanTable::ScanTable(size_t capacity, uint32_t max_age_ms)
+    : capacity_(capacity ? capacity : 1), max_age_ms_(max_age_ms) {
+    entries_.reserve(capacity_);
+}
+
+void ScanTable::update(const char *ssid, const uint8_t bssid[6],
+                       uint8_t channel, int8_t rssi, uint32_t now_ms) {
+    ScanEntry *slot = nullptr;
+    for (ScanEntry &e : entries_) {
+        if (memcmp(e.bssid, bssid, sizeof(e.bssid)) == 0) {
+            slot = &e;
+            break;
+        }
+    }
+    if (slot) {
+        // one scan's RSSI is noisy, average with the previous sightings
+        // unless those are stale
+        if (fresh(*slot, now_ms)) {
+            rssi = (int8_t)((slot->rssi + rssi) / 2);
+        }
+    } else if (entries_.size() < capacity_) {
+        entries_.push_back(ScanEntry());
+        slot = &entries_.back();
+    } else {
+        // make room from a stale entry, else the weakest one: a weak
+        // access point is the last one we'd want to join
+        for (ScanEntry &e : entries_) {
+            if (!fresh(e, now_ms)) {
+                slot = &e;
+                break;
+            }
+            if (!slot || e.rssi < slot->rssi) {
+                slot = &e;
+            }
+        }
+        if (fresh(*slot, now_ms) && rssi <= slot->rssi) {
+            return;
+        }
+    }
+    strncpy(slot->ssid, ssid, WIFI_SSID_MAX);
+    slot->ssid[WIFI_SSID_MAX] = '\0';
+    memcpy(slot->bssid, bssid, sizeof(slot->bssid));
+    slot->channel = channel;
+    slot->rssi = rssi;
+    slot->seen_ms = now_ms;
+}
+
+const ScanEntry *ScanTable::select(const char *ssid, uint32_t now_ms) const {
+    const ScanEntry *best = nullptr;
+    for (const ScanEntry &e : entries_) {
+        if (fresh(e, now_ms) && strncmp(e.ssid, ssid, WIFI_SSID_MAX) == 0 &&
+                (!best || e.rssi > best->rssi)) {
+            best = &e;
+        }
+    }
+    return best;
+}
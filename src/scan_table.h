@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "wifi_uri.h"
+
+// One access point seen by a background scan.
+struct ScanEntry {
+    char ssid[WIFI_SSID_MAX + 1];
+    uint8_t bssid[6];
+    uint8_t channel;
+    int8_t rssi;      // smoothed over sightings, dBm
+    uint32_t seen_ms; // last sighting
+};
+
+// Access points visible recently, one entry per BSSID, filled from scan
+// results as they trickle in. Once full, a stale or else the weakest
+// entry makes room. Entries older than max_age_ms are ignored.
+class ScanTable {
+  public:
+    explicit ScanTable(size_t capacity = 16, uint32_t max_age_ms = 60000);
+
+    void update(const char *ssid, const uint8_t bssid[6], uint8_t channel,
+                int8_t rssi, uint32_t now_ms);
+
+    // Strongest recently seen access point of a network, nullptr if none.
+    const ScanEntry *select(const char *ssid, uint32_t now_ms) const;
+
+    size_t size() const {
+        return entries_.size();
+    }
+
+    const ScanEntry &entry(size_t i) const {
+        return entries_[i];
+    }
+
+    void clear() {
+        entries_.clear();
+    }
+
+  private:
+    bool fresh(const ScanEntry &e, uint32_t now_ms) const {
+        return now_ms - e.seen_ms < max_age_ms_;
+    }
+
+    size_t capacity_;
+    uint32_t max_age_ms_;
+    std::vector<ScanEntry> entries_;
+};
@@ -0,0 +1,39 @@
+#include "sharpness.h"
+
+// weight of a new frame in the running average
+#define AVERAGE_ALPHA 0.1f
+
+uint32_t sharpness(const uint8_t *image, int width, int height, int stride,
+                   int step) {
+    if (step < 1) {
+        step = 1;
+    }
+    uint64_t energy = 0;
+    uint32_t samples = 0;
+    for (int y = 1; y < height - 1; y += step) {
+        const uint8_t *row = image + (size_t)y * stride;
+        for (int x = 1; x < width - 1; x += step) {
+            int gx = row[x + 1] - row[x - 1];
+            int gy = row[x + stride] - row[x - stride];
+            energy += (uint32_t)(gx * gx + gy * gy);
+            samples++;
+        }
+    }
+    return samples ? (uint32_t)(energy / samples) : 0;
+}
+
+SharpnessGate::SharpnessGate(float ratio, int warmup)
+    : ratio_(ratio), warmup_(warmup) {}
+
+bool SharpnessGate::pass(uint32_t measure) {
+    bool ok = seen_ < warmup_ || measure >= average_ * ratio_;
+    // rejected frames count too, or a steadily blurry scene would be
+    // locked out for good
+    if (seen_ == 0) {
+        average_ = (float)measure;
+    } else {
+        average_ += AVERAGE_ALPHA * ((float)measure - average_);
+    }
+    seen_++;
+    return ok;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Focus measure of a width x height window (row stride given): mean
+// squared central-difference gradient sampled every step pixels. Motion
+// blur and defocus both pull it down; it costs about 1/step^2 of a pass
+// over the window.
+uint32_t sharpness(const uint8_t *image, int width, int height, int stride,
+                   int step);
+
+// Drops frames that are much blurrier than the recent ones. The threshold
+// is a fraction of a running average of the measure, so it adapts to
+// scene contrast and lighting instead of needing a fixed cutoff.
+class SharpnessGate {
+  public:
+    // ratio: frames below ratio * average are rejected.
+    explicit SharpnessGate(float ratio = 0.6f, int warmup = 8);
+
+    // Record a frame's measure, returns true if it should be decoded.
+    bool pass(uint32_t measure);
+    // Forget the average, e.g. when what is measured changes.
+    void reset() {
+        seen_ = 0;
+    }
+
+    uint32_t threshold() const {
+        return (uint32_t)(average_ * ratio_);
+    }
+
+  private:
+    float ratio_;
+    int warmup_;
+    int seen_ = 0;
+    float average_ = 0;
+};
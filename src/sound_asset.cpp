@@ -0,0 +1,82 @@
+#include "sound_asset.h"
+
+static const int16_t ima_steps[89] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41,
+    45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209,
+    230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876,
+    963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749,
+    3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623,
+    27086, 29794, 32767,
+};
+
+static const int8_t ima_index_adjust[8] = {-1, -1, -1, -1, 2, 4, 6, 8};
+
+static int16_t ulawDecode(uint8_t u) {
+    u = ~u;
+    int t = ((u & 0x0f) << 3) + 0x84;
+    t <<= (u & 0x70) >> 4;
+    return (int16_t)((u & 0x80) ? 0x84 - t : t - 0x84);
+}
+
+void SoundStream::start(const SoundAsset *asset) {
+    asset_ = asset;
+    pos_ = 0;
+    predictor_ = 0;
+    index_ = 0;
+}
+
+size_t SoundStream::read(int16_t *out, size_t max) {
+    if (!active()) {
+        return 0;
+    }
+    size_t n = asset_->samples - pos_;
+    if (n > max) {
+        n = max;
+    }
+    const uint8_t *data = asset_->data;
+    switch (asset_->format) {
+        case SOUND_PCM8:
+            for (size_t i = 0; i < n; i++) {
+                out[i] = (int16_t)((data[pos_ + i] - 128) << 8);
+            }
+            break;
+        case SOUND_ULAW:
+            for (size_t i = 0; i < n; i++) {
+                out[i] = ulawDecode(data[pos_ + i]);
+            }
+            break;
+        case SOUND_IMA_ADPCM:
+            for (size_t i = 0; i < n; i++) {
+                uint32_t s = pos_ + i;
+                int nibble = (data[s >> 1] >> ((s & 1) * 4)) & 0x0f;
+                int step = ima_steps[index_];
+                int diff = step >> 3;
+                if (nibble & 4) {
+                    diff += step;
+                }
+                if (nibble & 2) {
+                    diff += step >> 1;
+                }
+                if (nibble & 1) {
+                    diff += step >> 2;
+                }
+                predictor_ += (nibble & 8) ? -diff : diff;
+                if (predictor_ > 32767) {
+                    predictor_ = 32767;
+                } else if (predictor_ < -32768) {
+                    predictor_ = -32768;
+                }
+                index_ += ima_index_adjust[nibble & 7];
+                if (index_ < 0) {
+                    index_ = 0;
+                } else if (index_ > 88) {
+                    index_ = 88;
+                }
+                out[i] = (int16_t)predictor_;
+            }
+            break;
+    }
+    pos_ += n;
+    return n;
+}
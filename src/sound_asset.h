@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Sample encodings produced by tools/wav2asset.py.
+enum SoundFormat : uint8_t {
+    SOUND_PCM8,       // unsigned 8 bit
+    SOUND_IMA_ADPCM,  // 4 bit IMA-ADPCM, first sample in the low nibble
+    SOUND_ULAW,       // G.711 mu-law
+};
+
+// A mono sound stored const (in flash) in one of the formats above.
+struct SoundAsset {
+    SoundFormat format;
+    uint32_t sample_rate;
+    uint32_t samples;
+    const uint8_t *data;
+    size_t len;
+};
+
+// Decodes an asset incrementally into signed 16 bit samples, so it can be
+// played through a small buffer instead of being expanded in RAM.
+class SoundStream {
+  public:
+    void start(const SoundAsset *asset);
+    void stop() {
+        asset_ = nullptr;
+    }
+
+    // Decode up to max samples into out, returns the number decoded; 0
+    // once the asset is exhausted.
+    size_t read(int16_t *out, size_t max);
+
+    bool active() const {
+        return asset_ != nullptr && pos_ < asset_->samples;
+    }
+    const SoundAsset *asset() const {
+        return asset_;
+    }
+
+  private:
+    const SoundAsset *asset_ = nullptr;
+    uint32_t pos_ = 0;
+    // IMA-ADPCM decoder state
+    int32_t predictor_ = 0;
+    int index_ = 0;
+};
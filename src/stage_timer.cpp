@@ -0,0 +1,117 @@
+#include "stage_timer.h"
+
+#include <cstdio>
+
+static const char *stage_names[NUM_STAGES] = {
+    "capture", "sharpness", "coarse", "load", "detect", "extract", "decode", "frame",
+};
+
+static StageHistogram histograms[NUM_STAGES];
+
+int StageHistogram::bucket(uint32_t cycles) {
+    if (cycles < 8) {
+        return (int)cycles;
+    }
+    int e = 31 - __builtin_clz(cycles);
+    int sub = (cycles >> (e - 2)) & 3;
+    return 8 + (e - 3) * 4 + sub;
+}
+
+// middle of a bucket
+static uint32_t bucketValue(int b) {
+    if (b < 8) {
+        return (uint32_t)b;
+    }
+    int e = (b - 8) / 4 + 3;
+    int sub = (b - 8) % 4;
+    uint64_t low = (uint64_t)(4 + sub) << (e - 2);
+    uint64_t width = 1ull << (e - 2);
+    return (uint32_t)(low + width / 2);
+}
+
+void StageHistogram::record(uint32_t cycles) {
+    counts_[bucket(cycles)].fetch_add(1, std::memory_order_relaxed);
+    uint32_t m = min_.load(std::memory_order_relaxed);
+    while (cycles < m && !min_.compare_exchange_weak(m, cycles, std::memory_order_relaxed)) {
+    }
+    m = max_.load(std::memory_order_relaxed);
+    while (cycles > m && !max_.compare_exchange_weak(m, cycles, std::memory_order_relaxed)) {
+    }
+}
+
+void StageHistogram::reset() {
+    for (auto &c : counts_) {
+        c.store(0, std::memory_order_relaxed);
+    }
+    min_.store(UINT32_MAX, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+uint32_t StageHistogram::count() const {
+    uint32_t n = 0;
+    for (const auto &c : counts_) {
+        n += c.load(std::memory_order_relaxed);
+    }
+    return n;
+}
+
+uint32_t StageHistogram::percentile(float p) const {
+    uint32_t n = count();
+    if (n == 0) {
+        return 0;
+    }
+    uint32_t rank = (uint32_t)(p * (n - 1)) + 1;
+    uint32_t seen = 0;
+    for (int b = 0; b < NUM_BUCKETS; b++) {
+        seen += counts_[b].load(std::memory_order_relaxed);
+        if (seen >= rank) {
+            // the exact extremes beat a bucket midpoint
+            uint32_t v = bucketValue(b);
+            return v < min() ? min() : v > max() ? max() : v;
+        }
+    }
+    return max();
+}
+
+void stageRecord(Stage stage, uint32_t cycles) {
+    histograms[stage].record(cycles);
+}
+
+const StageHistogram &stageHistogram(Stage stage) {
+    return histograms[stage];
+}
+
+const char *stageName(Stage stage) {
+    return stage_names[stage];
+}
+
+void stageReset() {
+    for (StageHistogram &h : histograms) {
+        h.reset();
+    }
+}
+
+static float toMs(uint32_t cycles) {
+    return cycles / (STAGE_CYCLES_PER_US * 1000.0f);
+}
+
+void stageReport(const std::function<void(const char *line)> &emit,
+                 bool compact) {
+    char line[96];
+    for (int s = 0; s < NUM_STAGES; s++) {
+        const StageHistogram &h = histograms[s];
+        uint32_t n = h.count();
+        if (n == 0) {
+            continue;
+        }
+        if (compact) {
+            snprintf(line, sizeof(line), "%s %.1f/%.1f ms", stage_names[s],
+                     toMs(h.percentile(0.5f)), toMs(h.percentile(0.99f)));
+        } else {
+            snprintf(line, sizeof(line), "%-9s n %6u min %6.2f p50 %6.2f p99 %6.2f ms",
+                     stage_names[s], (unsigned)n, toMs(h.min()),
+                     toMs(h.percentile(0.5f)), toMs(h.percentile(0.99f)));
+        }
+        emit(line);
+    }
+}
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+// Per-stage timing of the decode path. Recording a sample is a cycle
+// counter read, a bucket index and an atomic increment, cheap enough to
+// leave on in production; 0 compiles the probes out.
+#ifndef QR_STAGE_TIMING
+#define QR_STAGE_TIMING 1
+#endif
+
+#ifdef ESP_PLATFORM
+#include <esp_cpu.h>
+#include <sdkconfig.h>
+#define STAGE_CYCLES_PER_US CONFIG_ESP_DEFAULT_CPU_FREQ_MHZ
+static inline uint32_t stageCycles() {
+    return esp_cpu_get_cycle_count();
+}
+#else
+#include <chrono>
+// nanoseconds stand in for cycles on the host
+#define STAGE_CYCLES_PER_US 1000
+static inline uint32_t stageCycles() {
+    return (uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+#endif
+
+enum Stage {
+    STAGE_CAPTURE,   // waiting for the camera frame
+    STAGE_SHARPNESS, // focus measure
+    STAGE_COARSE,    // decimated finder pattern check
+    STAGE_LOAD,      // copy / threshold into quirc
+    STAGE_DETECT,    // quirc_end: binarize, label, find codes
+    STAGE_EXTRACT,   // sample the grids
+    STAGE_DECODE,    // quirc_decode, per code
+    STAGE_FRAME,     // whole decode callback
+    NUM_STAGES
+};
+
+// Log-linear histogram of durations in cycles: exact below 8, then four
+// buckets per power of two, so percentiles are within about 12%.
+// record() may be called from several threads at once.
+class StageHistogram {
+  public:
+    static const int NUM_BUCKETS = 8 + 29 * 4;
+
+    void record(uint32_t cycles);
+    void reset();
+
+    uint32_t count() const;
+    uint32_t min() const {
+        return min_.load(std::memory_order_relaxed);
+    }
+    uint32_t max() const {
+        return max_.load(std::memory_order_relaxed);
+    }
+    // Duration in cycles below which a fraction p of the samples fall.
+    uint32_t percentile(float p) const;
+
+    static int bucket(uint32_t cycles);
+
+  private:
+    std::atomic<uint32_t> counts_[NUM_BUCKETS] = {};
+    std::atomic<uint32_t> min_{UINT32_MAX};
+    std::atomic<uint32_t> max_{0};
+};
+
+void stageRecord(Stage stage, uint32_t cycles);
+const StageHistogram &stageHistogram(Stage stage);
+const char *stageName(Stage stage);
+void stageReset();
+
+// One line per stage that has samples: count, min, p50, p99 in ms, or
+// just p50/p99 when compact, for the display.
+void stageReport(const std::function<void(const char *line)> &emit,
+                 bool compact = false);
+
+// Times the enclosing scope.
+class ScopedStage {
+  public:
+#if QR_STAGE_TIMING
+    explicit ScopedStage(Stage stage) : stage_(stage), start_(stageCycles()) {}
+    ~ScopedStage() {
+        stageRecord(stage_, stageCycles() - start_);
+    }
+
+  private:
+    Stage stage_;
+    uint32_t start_;
+#else
+    explicit ScopedStage(Stage) {}
+#endif
+};
@@ -0,0 +1,56 @@
+#include "wifi_lease.h"
+
+#include <Preferences.h>
+#include <cstring>
+
+#define LEASE_NAMESPACE "wifi_lease"
+#define LEASE_KEY "lease"
+#define LEASE_VERSION 1
+
+struct StoredLease {
+    uint8_t version;
+    WiFiLease lease;
+};
+
+bool loadWiFiLease(WiFiLease &lease) {
+    Preferences prefs;
+    if (!prefs.begin(LEASE_NAMESPACE, true)) {
+        return false;
+    }
+    StoredLease stored;
+    size_t len = prefs.getBytes(LEASE_KEY, &stored, sizeof(stored));
+    prefs.end();
+    if (len != sizeof(stored) || stored.version != LEASE_VERSION ||
+            stored.lease.channel == 0) {
+        return false;
+    }
+    lease = stored.lease;
+    lease.ssid[WIFI_SSID_MAX] = '\0';
+    return true;
+}
+
+bool saveWiFiLease(const WiFiLease &lease) {
+    WiFiLease current;
+    if (loadWiFiLease(current) && memcmp(&current, &lease, sizeof(lease)) == 0) {
+        return true;
+    }
+    StoredLease stored;
+    memset(&stored, 0, sizeof(stored));
+    stored.version = LEASE_VERSION;
+    stored.lease = lease;
+    Preferences prefs;
+    if (!prefs.begin(LEASE_NAMESPACE, false)) {
+        return false;
+    }
+    bool ok = prefs.putBytes(LEASE_KEY, &stored, sizeof(stored)) == sizeof(stored);
+    prefs.end();
+    return ok;
+}
+
+void clearWiFiLease() {
+    Preferences prefs;
+    if (prefs.begin(LEASE_NAMESPACE, false)) {
+        prefs.remove(LEASE_KEY);
+        prefs.end();
+    }
+}
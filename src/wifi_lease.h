@@ -0,0 +1,23 @@
+#pragma once
+
+#include <cstdint>
+
+#include "wifi_uri.h"
+
+// How the device last got on the network: the access point and the
+// addresses DHCP handed out. Kept in NVS beside the credentials the WiFi
+// driver stores, so a reboot can connect without scanning or DHCP.
+struct WiFiLease {
+    char ssid[WIFI_SSID_MAX + 1]; // network the lease belongs to
+    uint8_t bssid[6];
+    uint8_t channel;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t netmask;
+    uint32_t dns;
+};
+
+bool loadWiFiLease(WiFiLease &lease);
+// Writes only if the lease changed, to spare the flash.
+bool saveWiFiLease(const WiFiLease &lease);
+void clearWiFiLease();
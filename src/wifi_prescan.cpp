@@ -0,0 +1,40 @@
+#include "wifi_prescan.h"
+
+#include <WiFi.h>
+#include <esp_wifi.h>
+
+void WiFiPrescan::poll(uint32_t now_ms, bool enabled) {
+    if (running_) {
+        int16_t n = WiFi.scanComplete();
+        if (n == WIFI_SCAN_RUNNING) {
+            return;
+        }
+        for (int16_t i = 0; i < n; i++) {
+            table_.update(WiFi.SSID(i).c_str(), WiFi.BSSID(i), WiFi.channel(i),
+                          WiFi.RSSI(i), now_ms);
+        }
+        WiFi.scanDelete();
+        running_ = false;
+        next_ms_ = now_ms + PRESCAN_INTERVAL_MS;
+        channel_ = channel_ % PRESCAN_CHANNELS + 1;
+    }
+    if (!enabled || (int32_t)(now_ms - next_ms_) < 0) {
+        return;
+    }
+    if (WiFi.scanNetworks(true, false, false, PRESCAN_CHANNEL_MS, channel_) ==
+            WIFI_SCAN_RUNNING) {
+        running_ = true;
+    } else {
+        // e.g. the driver is busy connecting, try the next channel later
+        next_ms_ = now_ms + PRESCAN_INTERVAL_MS;
+        channel_ = channel_ % PRESCAN_CHANNELS + 1;
+    }
+}
+
+void WiFiPrescan::stop() {
+    if (running_) {
+        esp_wifi_scan_stop();
+        WiFi.scanDelete();
+        running_ = false;
+    }
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+#include "scan_table.h"
+
+// One channel is scanned per interval, so the radio is busy for about
+// PRESCAN_CHANNEL_MS out of every PRESCAN_INTERVAL_MS.
+#define PRESCAN_INTERVAL_MS 1000
+#define PRESCAN_CHANNEL_MS 100
+#define PRESCAN_CHANNELS 13
+
+// Low duty background scan feeding a ScanTable while the device waits for
+// a code, so a WIFI: code can be joined on the right channel and access
+// point straight away. Driven from loop(), never blocks.
+class WiFiPrescan {
+  public:
+    // Collect finished scans and, if enabled, start the next one when due.
+    void poll(uint32_t now_ms, bool enabled);
+
+    // Abort a scan in progress, e.g. before connecting.
+    void stop();
+
+    const ScanTable &table() const {
+        return table_;
+    }
+
+  private:
+    ScanTable table_;
+    bool running_ = false;
+    uint8_t channel_ = 1;
+    uint32_t next_ms_ = 0;
+};
@@ -0,0 +1,107 @@
+#include "wifi_uri.h"
+
+#include <cstring>
+
+#define WIFI_PREFIX "WIFI:"
+#define WIFI_PREFIX_LEN 5
+
+// the scheme is case-insensitive, as in PayloadRouter's matchScheme()
+static bool hasWiFiPrefix(const char *text, size_t len) {
+    if (len < WIFI_PREFIX_LEN) {
+        return false;
+    }
+    for (int i = 0; i < WIFI_PREFIX_LEN; i++) {
+        char c = text[i] >= 'a' && text[i] <= 'z' ? text[i] - 'a' + 'A' : text[i];
+        if (c != WIFI_PREFIX[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool parseWiFiUri(const char *text, size_t len, WiFiConfig &config) {
+    memset(&config, 0, sizeof(config));
+    if (!hasWiFiPrefix(text, len)) {
+        return false;
+    }
+    const char *p = text + WIFI_PREFIX_LEN;
+    const char *end = text + len;
+
+    // room for a quoted value of the longest field
+    char value[WIFI_PASSWORD_MAX + 3];
+    // a long value only counts if no later one replaces it
+    bool ssid_long = false, type_long = false, password_long = false;
+    while (p < end) {
+        // key: everything up to the first colon of the field
+        const char *key = p;
+        while (p < end && *p != ':' && *p != ';') {
+            p++;
+        }
+        if (p == end || *p == ';') {
+            p++; // no colon, not a pair
+            continue;
+        }
+        size_t key_len = p - key;
+        p++;
+
+        char *dst = nullptr;
+        size_t limit = 0;
+        bool *too_long = nullptr;
+        if (key_len == 1 && *key == 'S') {
+            dst = config.ssid;
+            limit = WIFI_SSID_MAX;
+            too_long = &ssid_long;
+        } else if (key_len == 1 && *key == 'T') {
+            dst = config.type;
+            limit = WIFI_TYPE_MAX;
+            too_long = &type_long;
+        } else if (key_len == 1 && *key == 'P') {
+            dst = config.password;
+            limit = WIFI_PASSWORD_MAX;
+            too_long = &password_long;
+        }
+
+        // value: unescape up to the next unescaped semicolon
+        size_t n = 0;
+        while (p < end && *p != ';') {
+            char c = *p++;
+            if (c == '\\' && p < end) {
+                char next = *p++;
+                if (next != '\\' && next != ';' && next != ',' && next != '"' &&
+                        next != ':') {
+                    // unknown escape, keep both
+                    if (n < sizeof(value)) {
+                        value[n] = '\\';
+                    }
+                    n++;
+                }
+                c = next;
+            }
+            if (n < sizeof(value)) {
+                value[n] = c;
+            }
+            n++;
+        }
+        p++; // the semicolon
+
+        if (!dst) {
+            continue;
+        }
+        const char *v = value;
+        if (n <= sizeof(value) && n >= 2 && value[0] == '"' && value[n - 1] == '"') {
+            v++;
+            n -= 2;
+        }
+        *too_long = n > limit;
+        if (*too_long) {
+            n = 0;
+        }
+        memcpy(dst, v, n);
+        dst[n] = '\0';
+    }
+    if (ssid_long || type_long || password_long) {
+        memset(&config, 0, sizeof(config));
+        return false;
+    }
+    return true;
+}
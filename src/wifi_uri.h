@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstddef>
+
+// 802.11 limits; the buffers below hold one more byte for the NUL.
+#define WIFI_SSID_MAX 32
+#define WIFI_PASSWORD_MAX 64
+#define WIFI_TYPE_MAX 15
+
+// Network settings from a WIFI: URI, NUL-terminated. Empty fields were
+// not present in the code.
+struct WiFiConfig {
+    char ssid[WIFI_SSID_MAX + 1];
+    char type[WIFI_TYPE_MAX + 1];
+    char password[WIFI_PASSWORD_MAX + 1];
+};
+
+// Parse a WIFI:T:WPA;S:ssid;P:password;; URI in a single pass, without
+// allocating. Values are unescaped (\\ \; \, \" \:) and lose surrounding
+// double quotes; unknown keys are skipped and a repeated key overrides
+// the earlier one. The scheme matches in any case (wifi:, Wifi:), keys
+// only in upper case. Returns false if text is not a WIFI: URI or a value
+// does not fit, config is cleared either way.
+bool parseWiFiUri(const char *text, size_t len, WiFiConfig &config);
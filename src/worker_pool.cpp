@@ -0,0 +1,68 @@
+#include "worker_pool.h"
+
+#include "pipeline.h"
+
+WorkerPool::WorkerPool(int helpers, int core, size_t stack_size, int prio) {
+    for (int i = 0; i < helpers; i++) {
+        threads_.push_back(startPinnedThread("qr_worker", core, stack_size, prio,
+                                             [this, i] { helperLoop(i + 1); }));
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    start_.notify_all();
+    for (std::thread &t : threads_) {
+        t.join();
+    }
+}
+
+void WorkerPool::work(int worker) {
+    int index;
+    while ((index = next_.fetch_add(1)) < count_) {
+        (*job_)(index, worker);
+    }
+}
+
+void WorkerPool::run(int count, const std::function<void(int, int)> &fn) {
+    if (count <= 1 || threads_.empty()) {
+        for (int i = 0; i < count; i++) {
+            fn(i, 0);
+        }
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &fn;
+        count_ = count;
+        next_ = 0;
+        busy_ = (int)threads_.size();
+        generation_++;
+    }
+    start_.notify_all();
+    work(0);
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return busy_ == 0; });
+    job_ = nullptr;
+}
+
+void WorkerPool::helperLoop(int worker) {
+    unsigned seen = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        start_.wait(lock, [&] { return stopping_ || generation_ != seen; });
+        if (stopping_) {
+            return;
+        }
+        seen = generation_;
+        lock.unlock();
+        work(worker);
+        lock.lock();
+        if (--busy_ == 0) {
+            done_.notify_one();
+        }
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Fork-join helper threads for the decode task. run() spreads indices
+// over the calling thread (worker 0) and the helpers (workers 1..n), so
+// on the ESP32-S3 a frame with several codes uses both cores. Helpers are
+// pinned like the pipeline tasks and sleep between jobs.
+class WorkerPool {
+  public:
+    WorkerPool(int helpers, int core, size_t stack_size, int prio);
+    ~WorkerPool();
+
+    int workers() const {
+        return (int)threads_.size() + 1;
+    }
+
+    // Call fn(index, worker) for every index in [0, count) and return when
+    // all calls are done. worker selects per-worker scratch. Only one
+    // thread may call run() at a time.
+    void run(int count, const std::function<void(int, int)> &fn);
+
+  private:
+    void helperLoop(int worker);
+    void work(int worker);
+
+    std::mutex mutex_;
+    std::condition_variable start_;
+    std::condition_variable done_;
+    const std::function<void(int, int)> *job_ = nullptr;
+    int count_ = 0;
+    std::atomic<int> next_{0};
+    unsigned generation_ = 0;
+    int busy_ = 0;
+    bool stopping_ = false;
+    std::vector<std::thread> threads_;
+};
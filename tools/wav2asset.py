@@ -0,0 +1,166 @@
+#!/usr/bin/env python3
+"""Convert a WAV file into a compressed sound asset header for the firmware.
+
+The samples are mixed down to mono and stored as a const array (so they
+stay in flash) in one of the formats SoundStream decodes:
+
+  adpcm  IMA-ADPCM, 4 bits per sample (default)
+  ulaw   G.711 mu-law, 8 bits per sample
+  pcm8   unsigned 8-bit PCM, uncompressed
+
+usage: wav2asset.py [--format adpcm|ulaw|pcm8] [--speed F] [--rate HZ]
+                    [--name NAME] input.wav output.h
+
+--speed F plays the sound F times faster at the same sample rate.
+--rate HZ resamples to a lower rate to save space.
+"""
+
+import argparse
+import os
+import struct
+import sys
+import wave
+
+STEPS = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41,
+    45, 50, 55, 60, 66, 73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209,
+    230, 253, 279, 307, 337, 371, 408, 449, 494, 544, 598, 658, 724, 796, 876,
+    963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066, 2272, 2499, 2749,
+    3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623,
+    27086, 29794, 32767,
+]
+INDEX_ADJUST = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+FORMATS = {"pcm8": "SOUND_PCM8", "adpcm": "SOUND_IMA_ADPCM", "ulaw": "SOUND_ULAW"}
+
+
+def read_wav(path):
+    """Return (rate, mono samples as signed 16-bit ints)."""
+    with wave.open(path, "rb") as w:
+        channels = w.getnchannels()
+        width = w.getsampwidth()
+        rate = w.getframerate()
+        raw = w.readframes(w.getnframes())
+    if width == 1:
+        values = [(b - 128) << 8 for b in raw]
+    elif width == 2:
+        values = list(struct.unpack("<%dh" % (len(raw) // 2), raw))
+    else:
+        sys.exit("only 8 and 16 bit WAV files are supported")
+    mono = [sum(values[i:i + channels]) // channels
+            for i in range(0, len(values), channels)]
+    return rate, mono
+
+
+def resample(samples, factor):
+    """Resample by 1/factor: box filter for integer factors, else linear."""
+    if factor == 1:
+        return samples
+    if factor == int(factor):
+        n = int(factor)
+        return [sum(samples[i:i + n]) // len(samples[i:i + n])
+                for i in range(0, len(samples), n)]
+    out = []
+    pos = 0.0
+    while pos < len(samples) - 1:
+        i = int(pos)
+        frac = pos - i
+        out.append(int(samples[i] * (1 - frac) + samples[i + 1] * frac))
+        pos += factor
+    return out
+
+
+def encode_adpcm(samples):
+    predictor, index = 0, 0
+    nibbles = []
+    for s in samples:
+        step = STEPS[index]
+        diff = s - predictor
+        nibble = 0
+        if diff < 0:
+            nibble = 8
+            diff = -diff
+        vpdiff = step >> 3
+        if diff >= step:
+            nibble |= 4
+            diff -= step
+            vpdiff += step
+        step >>= 1
+        if diff >= step:
+            nibble |= 2
+            diff -= step
+            vpdiff += step
+        step >>= 1
+        if diff >= step:
+            nibble |= 1
+            vpdiff += step
+        predictor += -vpdiff if nibble & 8 else vpdiff
+        predictor = max(-32768, min(32767, predictor))
+        index = max(0, min(88, index + INDEX_ADJUST[nibble & 7]))
+        nibbles.append(nibble)
+    if len(nibbles) % 2:
+        nibbles.append(0)
+    # first sample in the low nibble
+    return bytes(nibbles[i] | (nibbles[i + 1] << 4) for i in range(0, len(nibbles), 2))
+
+
+def encode_ulaw(samples):
+    out = bytearray()
+    for s in samples:
+        sign = 0x80 if s < 0 else 0
+        magnitude = min(-s if s < 0 else s, 32635) + 0x84
+        exponent = 7
+        mask = 0x4000
+        while exponent > 0 and not magnitude & mask:
+            exponent -= 1
+            mask >>= 1
+        mantissa = (magnitude >> (exponent + 3)) & 0x0F
+        out.append(~(sign | (exponent << 4) | mantissa) & 0xFF)
+    return bytes(out)
+
+
+def encode_pcm8(samples):
+    return bytes((s >> 8) + 128 for s in samples)
+
+
+def write_header(path, name, fmt, rate, count, data, source):
+    with open(path, "w") as f:
+        f.write("// generated by tools/wav2asset.py from %s, do not edit\n" % source)
+        f.write("// %d samples at %d Hz, %s, %d bytes\n" % (count, rate, fmt, len(data)))
+        f.write("#pragma once\n\n#include \"sound_asset.h\"\n\n")
+        f.write("static const uint8_t %s_data[] = {\n" % name)
+        for i in range(0, len(data), 12):
+            f.write("  " + ", ".join("0x%02x" % b for b in data[i:i + 12]) + ",\n")
+        f.write("};\n\n")
+        f.write("static const SoundAsset %s = {\n" % name)
+        f.write("    %s, %d, %d, %s_data, sizeof(%s_data)\n};\n"
+                % (FORMATS[fmt], rate, count, name, name))
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("--format", choices=sorted(FORMATS), default="adpcm")
+    ap.add_argument("--speed", type=float, default=1.0)
+    ap.add_argument("--rate", type=int, default=0)
+    ap.add_argument("--name")
+    ap.add_argument("input")
+    ap.add_argument("output")
+    args = ap.parse_args()
+
+    rate, samples = read_wav(args.input)
+    samples = resample(samples, args.speed)
+    if args.rate and args.rate < rate:
+        samples = resample(samples, rate / args.rate)
+        rate = args.rate
+
+    encoders = {"pcm8": encode_pcm8, "adpcm": encode_adpcm, "ulaw": encode_ulaw}
+    data = encoders[args.format](samples)
+    name = args.name or "sound_" + os.path.splitext(os.path.basename(args.input))[0] \
+        .split("__")[-1].replace("-", "_")
+    write_header(args.output, name, args.format, rate, len(samples), data,
+                 os.path.basename(args.input))
+
+
+if __name__ == "__main__":
+    main()